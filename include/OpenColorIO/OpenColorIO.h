@@ -114,10 +114,59 @@ public:
  *
  * \note The method does not apply to instance specific caches such as the processor cache in a
  * config instance or the GPU and CPU processor caches in a processor instance. Here deleting the
- * instance flushes the cache.
+ * instance, or calling Config::clearProcessorCache(), Processor::clearCaches() or
+ * Context::clearCaches(), flushes the cache.
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/// Statistics of one cache (refer to \ref GetCacheStatistics).
+struct OCIOEXPORT CacheStatistics
+{
+    /// Name of the cache. The string is static.
+    const char * m_name{ nullptr };
+
+    size_t m_numEntries{ 0 };
+    /**
+     * Approximate memory used by the entries. The processors held by the processor caches are
+     * not accounted for as they are shared with the callers.
+     */
+    size_t m_approximateBytes{ 0 };
+
+    /// The hit & miss counters are never reset, even when the cache is cleared.
+    unsigned long long m_numHits{ 0 };
+    unsigned long long m_numMisses{ 0 };
+    /// Time (in seconds) spent to compute the missing entries.
+    double m_missTime{ 0. };
+};
+
+/**
+ * \brief Get the statistics of one of the global caches. Throws if the type is invalid.
+ *
+ * The instance specific caches are available from Config::getCacheStatistics(),
+ * Processor::getCacheStatistics() and Context::getCacheStatistics().
+ */
+extern OCIOEXPORT CacheStatistics GetCacheStatistics(GlobalCacheType type);
+
+/// Clear one of the global caches. Throws if the type is invalid.
+extern OCIOEXPORT void ClearCache(GlobalCacheType type);
+
+/**
+ * \brief Set the number of threads (including the calling one) used to process images and to
+ * build the processors. A value of 1 disables the internal worker threads and 0 restores the
+ * default i.e. the \ref OCIO_NUM_THREADS environment variable when present, otherwise the
+ * number of hardware threads.
+ *
+ * The worker threads are created on demand and shared by all the processors so a host with its
+ * own threading should call this method before any processing.
+ *
+ * \note The asynchronous processor creations (refer to \ref GetProcessorAsync) always run on a
+ * worker thread i.e. one worker thread is still created when the number of threads is 1. Use
+ * \ref SetAsyncTaskFunction to run them on the host threads instead.
+ */
+extern OCIOEXPORT void SetNumThreads(unsigned numThreads);
+/// Get the number of threads used to process images (refer to \ref SetNumThreads).
+extern OCIOEXPORT unsigned GetNumThreads();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -167,6 +216,51 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Timing and counters of the creation of one processor (refer to
+ * \ref SetProcessorProfilingFunction). All the times are in seconds.
+ *
+ * The phase times (i.e. building, finalizing and optimizing the ops, and creating the renderer)
+ * do not overlap. The file loading and LUT times are spent within the phases.
+ */
+struct OCIOEXPORT ProcessorProfile
+{
+    /// Type of the created processor i.e. Processor, OptimizedProcessor, CPUProcessor or
+    /// GPUProcessor. The string is static.
+    const char * m_type{ nullptr };
+    double m_totalTime{ 0. };
+
+    /// Conversion of the transforms into ops, including the file loading.
+    double m_buildOpsTime{ 0. };
+    double m_finalizeTime{ 0. };
+    double m_optimizeTime{ 0. };
+    double m_optimizeForBitDepthTime{ 0. };
+    /// Creation of the CPU ops. Note that the GPU shader program is created by
+    /// GPUProcessor::extractGpuShaderInfo().
+    double m_rendererTime{ 0. };
+
+    double m_fileLoadingTime{ 0. };
+    double m_lutCompositionTime{ 0. };
+    /// Creation of the fast forward LUTs approximating the inverse LUTs.
+    double m_inverseLutTime{ 0. };
+
+    /// Files read from the disk (or from the persistent file cache) versus found in memory.
+    unsigned m_numFilesLoaded{ 0 };
+    unsigned m_numFilesCached{ 0 };
+    unsigned m_numOptimizationPasses{ 0 };
+    unsigned m_numOpsCombined{ 0 };
+};
+
+/**
+ * \brief Set the function receiving the profile of each processor, optimized processor, CPU
+ * processor and GPU processor creation. The processors found in the caches are not reported.
+ * The profiling is disabled by default and an empty function disables it.
+ *
+ * \note
+ *     The function is called by the thread which created the processor.
+ */
+extern OCIOEXPORT void SetProcessorProfilingFunction(ProcessorProfilingFunction profilingFunction);
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -249,8 +343,23 @@ public:
      * \ref Config::CreateRaw .
      */
     static ConstConfigRcPtr CreateFromEnv();
-    /// Create a configuration using a specific config file.
+    /**
+     * \brief Create a configuration using a specific config file.
+     *
+     * The precompiled version of the config file (refer to \ref Config::PrecompileFile) is
+     * used instead when it exists and is up to date.
+     */
     static ConstConfigRcPtr CreateFromFile(const char * filename);
+    /**
+     * \brief Write the precompiled version of a config file.
+     *
+     * The precompiled config is a binary file, next to the config file and with the same name
+     * followed by 'c' (i.e. 'config.ocioc' for 'config.ocio'), which is faster to load as it
+     * avoids the parsing of the text. It is only used by \ref Config::CreateFromFile while the
+     * config file content is not modified and by the same library version, otherwise (or if the
+     * precompiled file is unreadable) the config file is parsed. The config must be valid.
+     */
+    static void PrecompileFile(const char * filename);
     /// Create a configuration using a stream.
     static ConstConfigRcPtr CreateFromStream(std::istream & istream);
 
@@ -1073,6 +1182,37 @@ public:
                                      const ConstTransformRcPtr & transform,
                                      TransformDirection direction) const;
 
+    /**
+     * \brief Get the processors of several transforms (e.g. all the views of a display to
+     * populate a menu).
+     *
+     * The processors are concurrently built and added to the processor cache so the later
+     * getProcessor() calls for the same transforms are immediate. The work common to several
+     * transforms is shared (e.g. a LUT file is only loaded once, the ops converting a color
+     * space to or from the reference space are only built once and identical processors are
+     * only cached once).
+     *
+     * The processors are written in the order of the transforms to the processors array, which
+     * must hold numTransforms elements. When some transforms fail to build, the processors of
+     * the other transforms are still written (and cached), the failed ones are null and the
+     * error of the first failing transform (in the transform order) is thrown.
+     */
+    void getProcessors(const ConstContextRcPtr & context,
+                       const ConstTransformRcPtr * transforms,
+                       size_t numTransforms,
+                       TransformDirection direction,
+                       ConstProcessorRcPtr * processors) const;
+    /// Also build the CPU processors for the bit-depths and optimization flags (refer to
+    /// Processor::getOptimizedCPUProcessor()) so the processors have them in cache.
+    void getProcessors(const ConstContextRcPtr & context,
+                       const ConstTransformRcPtr * transforms,
+                       size_t numTransforms,
+                       TransformDirection direction,
+                       BitDepth inBitDepth,
+                       BitDepth outBitDepth,
+                       OptimizationFlags oFlags,
+                       ConstProcessorRcPtr * processors) const;
+
     /**
      * \brief Get a processor to convert between color spaces in two separate
      *      configs.
@@ -1123,6 +1263,13 @@ public:
     /// properties are being used by the processor.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    /// Get the statistics of the processor cache i.e. "processor".
+    int getNumCacheStatistics() const noexcept;
+    /// Throws if the index is invalid.
+    CacheStatistics getCacheStatistics(int index) const;
+    /// Clear the processor cache.
+    void clearProcessorCache() const;
+
 private:
     Config();
 
@@ -2171,6 +2318,20 @@ public:
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
 
+    //
+    // Caches
+    //
+
+    /**
+     * Get the statistics of the caches holding the derived processors i.e.
+     * "optimized_processor", "cpu_processor" and "gpu_processor".
+     */
+    int getNumCacheStatistics() const noexcept;
+    /// Throws if the index is invalid.
+    CacheStatistics getCacheStatistics(int index) const;
+    /// Clear the caches holding the derived processors.
+    void clearCaches() const;
+
     Processor(const Processor &) = delete;
     Processor & operator= (const Processor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2195,6 +2356,20 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 // CPUProcessor
 
+/**
+ * Processing statistics of one step of a CPU processor (refer to
+ * CPUProcessor::enableStatistics()). The steps are the unpacking of the input pixels to 32-bit
+ * float RGBA, each op, and the packing to the output pixels. Note that the first (or last) op
+ * could be merged with the unpacking (or packing) step.
+ */
+struct OCIOEXPORT CPUOpStatistics
+{
+    /// Short description of the step, valid for the lifetime of the CPU processor.
+    const char * m_name{ nullptr };
+    double m_seconds{ 0. };         ///< Wall time accumulated by all the threads.
+    unsigned long long m_numPixels{ 0 }; ///< Number of processed pixels.
+};
+
 class OCIOEXPORT CPUProcessor
 {
 public:
@@ -2234,6 +2409,21 @@ public:
     void apply(ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Apply to several images at once, while respecting the input and output
+     * bit-depths.
+     *
+     * The images are processed in parallel and share the processing setup so it is much
+     * faster than applying to each image when the images are small (e.g. thumbnails). An entry
+     * of srcImgDescs and dstImgDescs may point to the same image to process it in place. An
+     * exception is thrown if one of the images is invalid, in which case some of the other
+     * images may be processed.
+     */
+    void apply(ImageDesc * const * imgDescs, size_t numImages) const;
+    void apply(const ImageDesc * const * srcImgDescs,
+               ImageDesc * const * dstImgDescs,
+               size_t numImages) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
@@ -2246,6 +2436,51 @@ public:
     void applyRGB(float * pixel) const;
     void applyRGBA(float * pixel) const;
 
+    /**
+     * Apply to a list of packed RGB or RGBA pixels (e.g. the colors of a color picker, a
+     * histogram or a point cloud) using the same processing as the images. The input and output
+     * bit-depths must be 32-bit float and the pixels are modified in place. The pixels are
+     * processed in parallel when there are many of them.
+     */
+    void applyRGB(float * pixels, size_t numPixels) const;
+    void applyRGBA(float * pixels, size_t numPixels) const;
+
+    /**
+     * Same as above but the pixels are pixelStrideBytes apart (e.g. the pixels are part of an
+     * array of structures). The stride must be a multiple of 4 bytes, or AutoStride for packed
+     * pixels.
+     */
+    void applyRGB(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const;
+    void applyRGBA(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const;
+
+    /**
+     * Engine used by the last apply call. It is always CPU_ENGINE_GENERIC unless the processor
+     * was created with the OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES flag.
+     *
+     * \note When several threads share the processor, it reports the most recent call.
+     */
+    CPUEngineType getLastEngineType() const;
+
+    /**
+     * Enable (or disable) the collection of the per step processing statistics. The collection
+     * is disabled by default as it adds some overhead to each apply call.
+     */
+    void enableStatistics(bool enable) const;
+    bool isStatisticsEnabled() const;
+
+    /**
+     * Number of steps having processed pixels since the last reset. The steps are listed in the
+     * processing order.
+     *
+     * \note A concurrent apply call could add a step so the statistics should be read while
+     * the processor is not in use.
+     */
+    int getNumStatistics() const;
+    /// Statistics accumulated by the apply calls since the last reset. Throw if the index is
+    /// invalid.
+    CPUOpStatistics getStatistics(int index) const;
+    void resetStatistics() const;
+
     CPUProcessor(const CPUProcessor &) = delete;
     CPUProcessor& operator= (const CPUProcessor &) = delete;
     /// Do not use (needed only for pybind11).
@@ -2302,6 +2537,141 @@ private:
 };
 
 
+///////////////////////////////////////////////////////////////////////////
+// Asynchronous processor creation
+
+/**
+ * \brief Handle of a processor created asynchronously (refer to \ref GetProcessorAsync).
+ *
+ * For example, an interactive application keeps drawing with the current processor until the
+ * new one is ready. The copies of the handle pointer share the same creation.
+ *
+ * Cancelling a creation not yet started skips it and cancelling a running creation stops it at
+ * the next step (e.g. before optimizing the ops or before inverting a LUT). The get() method then
+ * throws an exception.
+ */
+class OCIOEXPORT AsyncProcessor
+{
+public:
+    /// Return true if get() would not wait.
+    bool isReady() const;
+    void wait() const;
+    /// Wait for the processor. Throw if the creation failed or was cancelled.
+    ConstProcessorRcPtr get() const;
+
+    void cancel() const noexcept;
+    bool isCancelled() const noexcept;
+
+    AsyncProcessor(const AsyncProcessor &) = delete;
+    AsyncProcessor & operator=(const AsyncProcessor &) = delete;
+
+    /// Do not use (needed only for pybind11).
+    ~AsyncProcessor();
+
+private:
+    AsyncProcessor();
+
+    static void deleter(AsyncProcessor * p);
+
+    friend class AsyncCreation;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+/// Handle of a CPU processor created asynchronously (refer to \ref AsyncProcessor and
+/// \ref GetOptimizedCPUProcessorAsync).
+class OCIOEXPORT AsyncCPUProcessor
+{
+public:
+    bool isReady() const;
+    void wait() const;
+    ConstCPUProcessorRcPtr get() const;
+
+    void cancel() const noexcept;
+    bool isCancelled() const noexcept;
+
+    AsyncCPUProcessor(const AsyncCPUProcessor &) = delete;
+    AsyncCPUProcessor & operator=(const AsyncCPUProcessor &) = delete;
+
+    /// Do not use (needed only for pybind11).
+    ~AsyncCPUProcessor();
+
+private:
+    AsyncCPUProcessor();
+
+    static void deleter(AsyncCPUProcessor * p);
+
+    friend class AsyncCreation;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+/// Handle of a GPU processor created asynchronously (refer to \ref AsyncProcessor and
+/// \ref GetOptimizedGPUProcessorAsync).
+class OCIOEXPORT AsyncGPUProcessor
+{
+public:
+    bool isReady() const;
+    void wait() const;
+    ConstGPUProcessorRcPtr get() const;
+
+    void cancel() const noexcept;
+    bool isCancelled() const noexcept;
+
+    AsyncGPUProcessor(const AsyncGPUProcessor &) = delete;
+    AsyncGPUProcessor & operator=(const AsyncGPUProcessor &) = delete;
+
+    /// Do not use (needed only for pybind11).
+    ~AsyncGPUProcessor();
+
+private:
+    AsyncGPUProcessor();
+
+    static void deleter(AsyncGPUProcessor * p);
+
+    friend class AsyncCreation;
+
+    class Impl;
+    Impl * m_impl;
+    Impl * getImpl() { return m_impl; }
+    const Impl * getImpl() const { return m_impl; }
+};
+
+/// Asynchronous version of Config::getProcessor().
+extern OCIOEXPORT AsyncProcessorRcPtr GetProcessorAsync(
+    const ConstConfigRcPtr & config,
+    const ConstContextRcPtr & context,
+    const ConstTransformRcPtr & transform,
+    TransformDirection direction);
+
+/// Asynchronous version of Processor::getOptimizedCPUProcessor() which, for example, includes
+/// the preparation of the exact inverse of the LUTs.
+extern OCIOEXPORT AsyncCPUProcessorRcPtr GetOptimizedCPUProcessorAsync(
+    const ConstProcessorRcPtr & processor,
+    BitDepth inBitDepth,
+    BitDepth outBitDepth,
+    OptimizationFlags oFlags);
+
+/// Asynchronous version of Processor::getOptimizedGPUProcessor().
+extern OCIOEXPORT AsyncGPUProcessorRcPtr GetOptimizedGPUProcessorAsync(
+    const ConstProcessorRcPtr & processor,
+    OptimizationFlags oFlags);
+
+/**
+ * \brief Run the asynchronous processor creations using a host scheduler (e.g. the thread pool
+ * of the application) instead of the OCIO one. A null function restores the OCIO scheduler.
+ *
+ * \note The function must run the task exactly once (e.g. on a worker thread).
+ */
+extern OCIOEXPORT void SetAsyncTaskFunction(AsyncTaskFunction taskFunction);
+
+
 /**
  * \brief
  * 
@@ -2581,11 +2951,29 @@ public:
                     ptrdiff_t xStrideBytes,
                     ptrdiff_t yStrideBytes);
 
+    /**
+     * The integer channels are packed in words (e.g. 10-bit DPX images), and are unpacked line
+     * by line while processing the image. The bit-depth (i.e. UINT10 or UINT12) and the
+     * x stride are implied by the channel packing.
+     *
+     * \note
+     *    The 10-bit channel packings only support the RGB and BGR channel orderings. The lines
+     *    must start on a word boundary.
+     */
+    PackedImageDesc(void * data,
+                    long width, long height,
+                    ChannelOrdering chanOrder,
+                    ChannelPacking chanPacking,
+                    ptrdiff_t yStrideBytes);
+
     virtual ~PackedImageDesc();
 
     /// Get the channel ordering of all the pixels.
     ChannelOrdering getChannelOrder() const;
 
+    /// Get the channel packing i.e. CHANNEL_PACKING_NONE unless the channels are packed in words.
+    ChannelPacking getChannelPacking() const;
+
     /// Get the bit-depth.
     BitDepth getBitDepth() const override;
 
@@ -2601,6 +2989,11 @@ public:
     long getHeight() const override;
     long getNumChannels() const;
 
+    /**
+     * \note
+     *    The channel (or x) stride is 0 when the packed channels (or pixels) do not start on
+     *    a byte boundary (refer to ChannelPacking).
+     */
     ptrdiff_t getChanStrideBytes() const;
     ptrdiff_t getXStrideBytes() const override;
     ptrdiff_t getYStrideBytes() const override;
@@ -3214,6 +3607,9 @@ public:
     /// Resolve all the context variables from the string. It could be color space
     /// names or file names. Note that it recursively applies the context variable resolution.
     /// Returns the string unchanged if it does not contain any context variable.  
+    ///
+    /// \note The returned string is owned by the context cache and stays valid until the cache
+    /// is cleared i.e. by :cpp:func:`clearCaches` or by any context modification.
     const char * resolveStringVar(const char * string) const noexcept;
     /// Resolve all the context variables from the string and return all the context
     /// variables used to resolve the string (empty if no context variables were used).
@@ -3234,6 +3630,21 @@ public:
     /// used to resolve the filename (empty if no context variables were used).
     const char * resolveFileLocation(const char * filename, ContextRcPtr & usedContextVars) const;
 
+    /**
+     * Get the statistics of the caches holding the resolved strings and file paths i.e.
+     * "resolved_string" and "resolved_filepath".
+     */
+    int getNumCacheStatistics() const noexcept;
+    /// Throws if the index is invalid.
+    CacheStatistics getCacheStatistics(int index) const;
+    /**
+     * Clear the caches holding the resolved strings and file paths.
+     *
+     * \note The strings previously returned by :cpp:func:`resolveStringVar` and
+     * :cpp:func:`resolveFileLocation` are invalidated.
+     */
+    void clearCaches() const;
+
     Context(const Context &) = delete;
     Context& operator= (const Context &) = delete;
     /// Do not use (needed only for pybind11).
@@ -76,6 +76,15 @@ class OCIOEXPORT GPUProcessor;
 typedef OCIO_SHARED_PTR<const GPUProcessor> ConstGPUProcessorRcPtr;
 typedef OCIO_SHARED_PTR<GPUProcessor> GPUProcessorRcPtr;
 
+class OCIOEXPORT AsyncProcessor;
+typedef OCIO_SHARED_PTR<AsyncProcessor> AsyncProcessorRcPtr;
+
+class OCIOEXPORT AsyncCPUProcessor;
+typedef OCIO_SHARED_PTR<AsyncCPUProcessor> AsyncCPUProcessorRcPtr;
+
+class OCIOEXPORT AsyncGPUProcessor;
+typedef OCIO_SHARED_PTR<AsyncGPUProcessor> AsyncGPUProcessorRcPtr;
+
 class OCIOEXPORT ProcessorMetadata;
 typedef OCIO_SHARED_PTR<const ProcessorMetadata> ConstProcessorMetadataRcPtr;
 typedef OCIO_SHARED_PTR<ProcessorMetadata> ProcessorMetadataRcPtr;
@@ -260,6 +269,13 @@ inline OCIO_SHARED_PTR<T> DynamicPtrCast(OCIO_SHARED_PTR<U> const & ptr)
 /// Define the logging function signature.
 using LoggingFunction = std::function<void(const char*)>;
 
+struct ProcessorProfile;
+/// Define the processor profiling function signature.
+using ProcessorProfilingFunction = std::function<void(const ProcessorProfile &)>;
+
+/// Define the signature of the function running the asynchronous processor creations.
+using AsyncTaskFunction = std::function<void(std::function<void()> task)>;
+
 // Enums
 
 enum LoggingLevel
@@ -399,7 +415,7 @@ enum Interpolation
  * Used in a configuration file to indicate the bit-depth of a color space,
  * and by the \ref Processor to specify the input and output bit-depths of 
  * images to process.
- * Note that \ref Processor only supports: UINT8, UINT10, UINT12, UINT16, F16 and F32.
+ * Note that \ref Processor only supports: UINT8, UINT10, UINT12, UINT16, UINT32, F16 and F32.
  */
 enum BitDepth
 {
@@ -432,6 +448,24 @@ enum ChannelOrdering
     CHANNEL_ORDERING_BGR
 };
 
+/**
+ * Used by \ref PackedImageDesc to indicate how the integer channels are packed in words
+ * (e.g. DPX and Cineon images). The words are in the native byte order and the channels are
+ * in the channel ordering, the first channel being in the most significant bits.
+ */
+enum ChannelPacking
+{
+    CHANNEL_PACKING_NONE = 0,       ///< One channel per value of the bit-depth type
+    CHANNEL_PACKING_10BIT_FILLED_A, ///< Three 10-bit channels per 32-bit word, the 2 padding
+                                    ///< bits being the least significant ones (DPX method A)
+    CHANNEL_PACKING_10BIT_FILLED_B, ///< Three 10-bit channels per 32-bit word, the 2 padding
+                                    ///< bits being the most significant ones (DPX method B)
+    CHANNEL_PACKING_12BIT_FILLED_A, ///< One 12-bit channel per 16-bit word, the 4 padding bits
+                                    ///< being the least significant ones (DPX method A)
+    CHANNEL_PACKING_12BIT_PACKED    ///< Stream of 12-bit channels i.e. two channels per three
+                                    ///< bytes without any padding
+};
+
 enum Allocation {
     ALLOCATION_UNKNOWN = 0,
     ALLOCATION_UNIFORM,
@@ -610,8 +644,27 @@ enum OptimizationFlags : unsigned long
      */
     OPTIMIZATION_NO_DYNAMIC_PROPERTIES           = 0x10000000,
 
-    /// Apply all possible optimizations.
-    OPTIMIZATION_ALL                             = 0xFFFFFFFF,
+    /**
+     * For CPU processor with dynamic properties, build in the background an engine optimized
+     * for the current values once they stop changing, and use it until one of them changes
+     * (refer to CPUProcessor::getLastEngineType()).
+     */
+    OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES   = 0x20000000,
+
+    /**
+     * For CPU processor with 8, 10, 12 or 16-bit integer input and output bit-depths, replace
+     * the processing by look-ups indexed by the input code values. Without channel crosstalk,
+     * a 1D look-up of all the input values gives exactly the same results. Otherwise, a 3D LUT
+     * is used when its error, measured on a sampling of the input values, is at most one
+     * output code value (or one 10-bit code value for the 12-bit and 16-bit outputs).
+     *
+     * \note As the 3D LUT is lossy, the flag is not part of OPTIMIZATION_ALL nor of any
+     * optimization level and must be explicitly requested.
+     */
+    OPTIMIZATION_INTEGER_DOMAIN                  = 0x40000000,
+
+    /// Apply all possible optimizations, except OPTIMIZATION_INTEGER_DOMAIN.
+    OPTIMIZATION_ALL                             = 0xBFFFFFFF,
 
     // The following groupings of flags are provided as a convenient way to select an overall
     // optimization level.
@@ -666,6 +719,21 @@ enum ProcessorCacheFlags : unsigned int
     PROCESSOR_CACHE_DEFAULT = (PROCESSOR_CACHE_ENABLED | PROCESSOR_CACHE_SHARE_DYN_PROPERTIES)
 };
 
+/// Global caches (refer to \ref GetCacheStatistics and \ref ClearCache).
+enum GlobalCacheType
+{
+    GLOBAL_CACHE_FILE_HASH = 0,  ///< File identifications i.e. "file_hash".
+    GLOBAL_CACHE_FILE,           ///< Loaded LUT file content i.e. "file".
+    GLOBAL_CACHE_OP_COMPOSITION  ///< Composed LUTs i.e. "op_composition".
+};
+
+/// Engine used by a CPU processor apply call (refer to OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES).
+enum CPUEngineType
+{
+    CPU_ENGINE_GENERIC = 0, ///< Reads the dynamic property values at each apply call.
+    CPU_ENGINE_SPECIALIZED  ///< Optimized for the current dynamic property values.
+};
+
 // Conversion
 
 extern OCIOEXPORT const char * BoolToString(bool val);
@@ -767,6 +835,14 @@ extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_USER_CATEGORIES_ENVVAR;
 
+/**
+ * The envvar 'OCIO_LAZY_LOADING' enables the lazy loading of the config files. When present, the
+ * transforms of the color spaces and of the looks are only built (and validated) on first access
+ * of the element instead of when reading the config file. That reduces the time to get the first
+ * processor from a large config file.
+ */
+extern OCIOEXPORT const char * OCIO_LAZY_LOADING_ENVVAR;
+
 /** @}*/
 
 /** \defgroup VarsRoles
@@ -954,6 +1030,14 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_FILE_CACHE_DIR
+//
+// Directory of the persistent file cache. When set, the parsed LUT files are stored in the
+// directory so other processes reading the same files skip the parsing. Only some file formats
+// (i.e. cube, spi1d, spi3d and 3dl) support the persistent file cache.
+extern OCIOEXPORT const char * OCIO_FILE_CACHE_DIR;
+
 /** @}*/
 
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "AsyncProcessor.h"
+#include "Mutex.h"
+#include "TaskScheduler.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// Cancellation flag of the asynchronous creation running on the current thread, if any.
+thread_local const std::atomic<bool> * t_cancelled = nullptr;
+
+// Make the cancellation flag visible to ThrowIfCancelled() for the duration of the task.
+class CancellationScope
+{
+public:
+    CancellationScope() = delete;
+    CancellationScope(const CancellationScope &) = delete;
+    CancellationScope & operator=(const CancellationScope &) = delete;
+
+    explicit CancellationScope(const std::atomic<bool> * cancelled) noexcept
+        :   m_previous(t_cancelled)
+    {
+        t_cancelled = cancelled;
+    }
+
+    ~CancellationScope()
+    {
+        t_cancelled = m_previous;
+    }
+
+private:
+    const std::atomic<bool> * m_previous;
+};
+
+Mutex g_asyncTaskMutex;
+AsyncTaskFunction g_asyncTaskFunction;
+
+void PostTask(std::function<void()> && task)
+{
+    AsyncTaskFunction taskFunction;
+    {
+        AutoMutex lock(g_asyncTaskMutex);
+        taskFunction = g_asyncTaskFunction;
+    }
+
+    if (taskFunction)
+    {
+        taskFunction(std::move(task));
+    }
+    else
+    {
+        RunAsync(std::move(task));
+    }
+}
+
+} // anon.
+
+// State of an asynchronous creation shared by its handle.
+template<typename T>
+class AsyncState
+{
+public:
+    bool isReady() const
+    {
+        return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    void wait() const { m_future.wait(); }
+
+    T get() const { return m_future.get(); }
+
+    void cancel() const noexcept { m_cancelled->store(true); }
+
+    bool isCancelled() const noexcept { return m_cancelled->load(); }
+
+    std::shared_future<T> m_future;
+    // The task also holds the flag as it could outlive the handle.
+    std::shared_ptr<std::atomic<bool>> m_cancelled;
+};
+
+class AsyncProcessor::Impl : public AsyncState<ConstProcessorRcPtr>
+{
+};
+
+class AsyncCPUProcessor::Impl : public AsyncState<ConstCPUProcessorRcPtr>
+{
+};
+
+class AsyncGPUProcessor::Impl : public AsyncState<ConstGPUProcessorRcPtr>
+{
+};
+
+// Create the handles and post the tasks (friend of the handle classes).
+class AsyncCreation
+{
+public:
+    template<typename Handle, typename T>
+    static OCIO_SHARED_PTR<Handle> Create(std::function<T()> && create)
+    {
+        auto promise   = std::make_shared<std::promise<T>>();
+        auto cancelled = std::make_shared<std::atomic<bool>>(false);
+
+        OCIO_SHARED_PTR<Handle> handle(new Handle(), &Handle::deleter);
+        handle->getImpl()->m_future    = promise->get_future().share();
+        handle->getImpl()->m_cancelled = cancelled;
+
+        PostTask([promise, cancelled, create]()
+        {
+            try
+            {
+                CancellationScope scope(cancelled.get());
+                ThrowIfCancelled();
+                promise->set_value(create());
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        });
+
+        return handle;
+    }
+};
+
+void ThrowIfCancelled()
+{
+    if (t_cancelled && t_cancelled->load())
+    {
+        throw Exception("The processor creation was cancelled.");
+    }
+}
+
+AsyncProcessor::AsyncProcessor()
+    :   m_impl(new AsyncProcessor::Impl())
+{
+}
+
+AsyncProcessor::~AsyncProcessor()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void AsyncProcessor::deleter(AsyncProcessor * p)
+{
+    delete p;
+}
+
+bool AsyncProcessor::isReady() const
+{
+    return getImpl()->isReady();
+}
+
+void AsyncProcessor::wait() const
+{
+    getImpl()->wait();
+}
+
+ConstProcessorRcPtr AsyncProcessor::get() const
+{
+    return getImpl()->get();
+}
+
+void AsyncProcessor::cancel() const noexcept
+{
+    getImpl()->cancel();
+}
+
+bool AsyncProcessor::isCancelled() const noexcept
+{
+    return getImpl()->isCancelled();
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+AsyncCPUProcessor::AsyncCPUProcessor()
+    :   m_impl(new AsyncCPUProcessor::Impl())
+{
+}
+
+AsyncCPUProcessor::~AsyncCPUProcessor()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void AsyncCPUProcessor::deleter(AsyncCPUProcessor * p)
+{
+    delete p;
+}
+
+bool AsyncCPUProcessor::isReady() const
+{
+    return getImpl()->isReady();
+}
+
+void AsyncCPUProcessor::wait() const
+{
+    getImpl()->wait();
+}
+
+ConstCPUProcessorRcPtr AsyncCPUProcessor::get() const
+{
+    return getImpl()->get();
+}
+
+void AsyncCPUProcessor::cancel() const noexcept
+{
+    getImpl()->cancel();
+}
+
+bool AsyncCPUProcessor::isCancelled() const noexcept
+{
+    return getImpl()->isCancelled();
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+AsyncGPUProcessor::AsyncGPUProcessor()
+    :   m_impl(new AsyncGPUProcessor::Impl())
+{
+}
+
+AsyncGPUProcessor::~AsyncGPUProcessor()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+void AsyncGPUProcessor::deleter(AsyncGPUProcessor * p)
+{
+    delete p;
+}
+
+bool AsyncGPUProcessor::isReady() const
+{
+    return getImpl()->isReady();
+}
+
+void AsyncGPUProcessor::wait() const
+{
+    getImpl()->wait();
+}
+
+ConstGPUProcessorRcPtr AsyncGPUProcessor::get() const
+{
+    return getImpl()->get();
+}
+
+void AsyncGPUProcessor::cancel() const noexcept
+{
+    getImpl()->cancel();
+}
+
+bool AsyncGPUProcessor::isCancelled() const noexcept
+{
+    return getImpl()->isCancelled();
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+AsyncProcessorRcPtr GetProcessorAsync(const ConstConfigRcPtr & config,
+                                      const ConstContextRcPtr & context,
+                                      const ConstTransformRcPtr & transform,
+                                      TransformDirection direction)
+{
+    if (!config || !context || !transform)
+    {
+        throw Exception("GetProcessorAsync failed. The config, the context and the transform "
+                        "must not be null.");
+    }
+
+    return AsyncCreation::Create<AsyncProcessor, ConstProcessorRcPtr>(
+        [config, context, transform, direction]()
+        {
+            return config->getProcessor(context, transform, direction);
+        });
+}
+
+AsyncCPUProcessorRcPtr GetOptimizedCPUProcessorAsync(
+    const ConstProcessorRcPtr & processor,
+    BitDepth inBitDepth,
+    BitDepth outBitDepth,
+    OptimizationFlags oFlags)
+{
+    if (!processor)
+    {
+        throw Exception("GetOptimizedCPUProcessorAsync failed. The processor is null.");
+    }
+
+    return AsyncCreation::Create<AsyncCPUProcessor, ConstCPUProcessorRcPtr>(
+        [processor, inBitDepth, outBitDepth, oFlags]()
+        {
+            return processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
+        });
+}
+
+AsyncGPUProcessorRcPtr GetOptimizedGPUProcessorAsync(
+    const ConstProcessorRcPtr & processor,
+    OptimizationFlags oFlags)
+{
+    if (!processor)
+    {
+        throw Exception("GetOptimizedGPUProcessorAsync failed. The processor is null.");
+    }
+
+    return AsyncCreation::Create<AsyncGPUProcessor, ConstGPUProcessorRcPtr>(
+        [processor, oFlags]()
+        {
+            return processor->getOptimizedGPUProcessor(oFlags);
+        });
+}
+
+void SetAsyncTaskFunction(AsyncTaskFunction taskFunction)
+{
+    AutoMutex lock(g_asyncTaskMutex);
+    g_asyncTaskFunction = taskFunction;
+}
+
+} // namespace OCIO_NAMESPACE
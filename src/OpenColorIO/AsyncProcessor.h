@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_ASYNCPROCESSOR_H
+#define INCLUDED_OCIO_ASYNCPROCESSOR_H
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Throw if the asynchronous processor creation running on the current thread was cancelled
+// (refer to AsyncProcessor::cancel()). Call it between the costly steps of the creation.
+void ThrowIfCancelled();
+
+} // namespace OCIO_NAMESPACE
+
+#endif
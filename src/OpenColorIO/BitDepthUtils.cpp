@@ -27,6 +27,8 @@ double GetBitDepthMaxValue(BitDepth in)
             return (double)BitDepthInfo<BIT_DEPTH_UINT12>::maxValue;
         case BIT_DEPTH_UINT16:
             return (double)BitDepthInfo<BIT_DEPTH_UINT16>::maxValue;
+        case BIT_DEPTH_UINT32:
+            return (double)BitDepthInfo<BIT_DEPTH_UINT32>::maxValue;
         case BIT_DEPTH_F16:
             return (double)BitDepthInfo<BIT_DEPTH_F16>::maxValue;
         case BIT_DEPTH_F32:
@@ -34,7 +36,6 @@ double GetBitDepthMaxValue(BitDepth in)
 
         case BIT_DEPTH_UNKNOWN:
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         default:
         {
             std::string err(errBDNotSupported);
@@ -99,6 +100,8 @@ bool IsFloatBitDepth(BitDepth in)
             return BitDepthInfo<BIT_DEPTH_UINT12>::isFloat;
         case BIT_DEPTH_UINT16:
             return BitDepthInfo<BIT_DEPTH_UINT16>::isFloat;
+        case BIT_DEPTH_UINT32:
+            return BitDepthInfo<BIT_DEPTH_UINT32>::isFloat;
         case BIT_DEPTH_F16:
             return BitDepthInfo<BIT_DEPTH_F16>::isFloat;
         case BIT_DEPTH_F32:
@@ -106,7 +109,6 @@ bool IsFloatBitDepth(BitDepth in)
 
         case BIT_DEPTH_UNKNOWN:
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         default:
         {
             std::string err(errBDNotSupported);
@@ -130,12 +132,13 @@ unsigned GetChannelSizeInBytes(BitDepth in)
             return sizeof(BitDepthInfo<BIT_DEPTH_UINT12>::Type);
         case BIT_DEPTH_UINT16:
             return sizeof(BitDepthInfo<BIT_DEPTH_UINT16>::Type);
+        case BIT_DEPTH_UINT32:
+            return sizeof(BitDepthInfo<BIT_DEPTH_UINT32>::Type);
         case BIT_DEPTH_F16:
             return sizeof(BitDepthInfo<BIT_DEPTH_F16>::Type);
         case BIT_DEPTH_F32:
             return sizeof(BitDepthInfo<BIT_DEPTH_F32>::Type);
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_UNKNOWN:
         default:
         {
@@ -59,6 +59,13 @@ template<> struct BitDepthInfo<BIT_DEPTH_UINT16>
     static const unsigned maxValue = 65535;
 };
 
+template<> struct BitDepthInfo<BIT_DEPTH_UINT32>
+{
+    typedef uint32_t Type;
+    static const bool isFloat = false;
+    static const unsigned maxValue = 4294967295u;
+};
+
 template<> struct BitDepthInfo<BIT_DEPTH_F16>
 {
     typedef half Type;
@@ -139,6 +146,20 @@ struct Converter<BIT_DEPTH_UINT16>
     }
 };
 
+template<>
+struct Converter<BIT_DEPTH_UINT32>
+{
+    typedef typename BitDepthInfo<BIT_DEPTH_UINT32>::Type Type;
+
+    static Type CastValue(float value)
+    {
+        // The max value is not exactly representable by a float so the clamping is done
+        // using doubles.
+        const double v = double(value) + 0.5;
+        return (Type)CLAMP(v, 0.0, double(BitDepthInfo<BIT_DEPTH_UINT32>::maxValue));
+    }
+};
+
 template<>
 struct Converter<BIT_DEPTH_F16>
 {
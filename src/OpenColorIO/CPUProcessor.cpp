@@ -1,24 +1,46 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <sstream>
 #include <string.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "CPUProcessor.h"
+#include "HalfConversion.h"
+#include "Logging.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
+#include "ops/lut3d/Lut3DOp.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOpCPU.h"
+#include "Profiling.h"
 #include "ScanlineHelper.h"
+#include "ScratchArena.h"
+#include "TaskScheduler.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+// Base class of the ops only converting the bit-depth.
+class BitDepthCastOpCPU : public OpCPU
+{
+public:
+    bool hasApplyRGB() const override { return true; }
+};
+
 template<BitDepth inBD, BitDepth outBD>
-class BitDepthCast : public OpCPU
+class BitDepthCast : public BitDepthCastOpCPU
 {
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
@@ -44,13 +66,25 @@ public:
         }
     }
 
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        const InType * in = reinterpret_cast<const InType*>(inImg);
+        OutType * out = reinterpret_cast<OutType*>(outImg);
+
+        const long numValues = 3 * numPixels;
+        for(long idx=0; idx<numValues; ++idx)
+        {
+            out[idx] = Converter<outBD>::CastValue(in[idx] * m_scale);
+        }
+    }
+
 protected:
     const float m_scale = float(BitDepthInfo<outBD>::maxValue)
                             / float(BitDepthInfo<inBD>::maxValue);
 };
 
 template<>
-class BitDepthCast<BIT_DEPTH_F32, BIT_DEPTH_F32> : public OpCPU
+class BitDepthCast<BIT_DEPTH_F32, BIT_DEPTH_F32> : public BitDepthCastOpCPU
 {
 public:
     BitDepthCast() = default;
@@ -63,8 +97,89 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 3*numPixels*sizeof(float));
+        }
+    }
+};
+
+template<>
+class BitDepthCast<BIT_DEPTH_F16, BIT_DEPTH_F16> : public BitDepthCastOpCPU
+{
+public:
+    BitDepthCast() = default;
+    ~BitDepthCast() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 4*numPixels*sizeof(half));
+        }
+    }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        if(inImg!=outImg)
+        {
+            memcpy(outImg, inImg, 3*numPixels*sizeof(half));
+        }
+    }
+};
+
+template<>
+class BitDepthCast<BIT_DEPTH_F16, BIT_DEPTH_F32> : public BitDepthCastOpCPU
+{
+public:
+    BitDepthCast() = default;
+    ~BitDepthCast() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        ConvertHalfToFloat(reinterpret_cast<const half *>(inImg),
+                           reinterpret_cast<float *>(outImg),
+                           4 * size_t(numPixels));
+    }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        ConvertHalfToFloat(reinterpret_cast<const half *>(inImg),
+                           reinterpret_cast<float *>(outImg),
+                           3 * size_t(numPixels));
+    }
+};
+
+template<>
+class BitDepthCast<BIT_DEPTH_F32, BIT_DEPTH_F16> : public BitDepthCastOpCPU
+{
+public:
+    BitDepthCast() = default;
+    ~BitDepthCast() override {};
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override
+    {
+        ConvertFloatToHalf(reinterpret_cast<const float *>(inImg),
+                           reinterpret_cast<half *>(outImg),
+                           4 * size_t(numPixels));
+    }
+
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override
+    {
+        ConvertFloatToHalf(reinterpret_cast<const float *>(inImg),
+                           reinterpret_cast<half *>(outImg),
+                           3 * size_t(numPixels));
+    }
 };
 
+bool IsBitDepthCast(const ConstOpCPURcPtr & op) noexcept
+{
+    return dynamic_cast<const BitDepthCastOpCPU *>(op.get()) != nullptr;
+}
+
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
 {
 
@@ -84,10 +199,10 @@ case in:                                              \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT10)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT12)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT16)       \
+        ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT32)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_F16)          \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_F32)          \
         case BIT_DEPTH_UINT14:                        \
-        case BIT_DEPTH_UINT32:                        \
         case BIT_DEPTH_UNKNOWN:                       \
         default:                                      \
             throw Exception("Unsupported bit-depth"); \
@@ -104,10 +219,10 @@ case in:                                              \
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT10)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT12)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT16)
+        ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT32)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_F16)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_F32)
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_UNKNOWN:
         default:
             throw Exception("Unsupported bit-depth");
@@ -119,17 +234,103 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+CPUStatistics::Entry * CPUStatistics::getEntry(const std::string & name)
+{
+    AutoMutex lock(m_mutex);
+
+    for (const auto & entry : m_entries)
+    {
+        if (entry->m_name == name)
+        {
+            return entry.get();
+        }
+    }
+
+    m_entries.emplace_back(new Entry(name));
+    return m_entries.back().get();
+}
+
+int CPUStatistics::getNum() const
+{
+    AutoMutex lock(m_mutex);
+
+    int num = 0;
+    for (const auto & entry : m_entries)
+    {
+        if (entry->m_numPixels.load() != 0)
+        {
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+CPUOpStatistics CPUStatistics::get(int index) const
+{
+    AutoMutex lock(m_mutex);
+
+    int num = 0;
+    for (const auto & entry : m_entries)
+    {
+        const uint64_t numPixels = entry->m_numPixels.load();
+        if (numPixels != 0 && num++ == index)
+        {
+            // Note: The entries are never removed so the name stays valid.
+            CPUOpStatistics stats;
+            stats.m_name      = entry->m_name.c_str();
+            stats.m_seconds   = double(entry->m_nanoseconds.load()) * 1e-9;
+            stats.m_numPixels = numPixels;
+            return stats;
+        }
+    }
+
+    std::ostringstream oss;
+    oss << "Invalid CPU processor statistics index " << index << ".";
+    throw Exception(oss.str().c_str());
+}
+
+void CPUStatistics::reset()
+{
+    AutoMutex lock(m_mutex);
+
+    for (const auto & entry : m_entries)
+    {
+        entry->m_nanoseconds = 0;
+        entry->m_numPixels   = 0;
+    }
+}
+
+namespace
+{
+
+// Name of the statistics entry of the op at the index in the optimized op list.
+std::string GetOpEntryName(const ConstOpRcPtr & op, size_t idx)
+{
+    std::ostringstream oss;
+    oss << idx << ": " << op->getInfo();
+    return oss.str();
+}
+
+} // anon.
+
 void CreateCPUEngine(const OpRcPtrVec & ops, 
                      BitDepth in, 
                      BitDepth out,
                      OptimizationFlags oFlags,
-                     // The bit-depth 'cast' or the first CPU Op.
-                     ConstOpCPURcPtr & inBitDepthOp,
-                     // The remaining CPU Ops.
-                     ConstOpCPURcPtrVec & cpuOps,
-                     // The bit-depth 'cast' or the last CPU Op.
-                     ConstOpCPURcPtr & outBitDepthOp)
+                     CPUStatistics & statistics,
+                     CPUEngine & engine)
 {
+    // The in (and out) bit-depth conversion could be done by the first (and last) op.
+    std::string inEntryName  = std::string("unpack ") + BitDepthToString(in);
+    std::string outEntryName = std::string("pack ") + BitDepthToString(out);
+    std::vector<std::string> cpuOpEntryNames;
+
+    // The 1D LUT renderers do not support the 32-bit integers (i.e. far too many values for
+    // a look-up table).
+    const bool inLut1D  = in!=BIT_DEPTH_UINT32;
+    const bool outLut1D = out!=BIT_DEPTH_UINT32;
+
     const size_t maxOps = ops.size();
     const bool fastLogExpPow = HasFlag(oFlags, OPTIMIZATION_FAST_LOG_EXP_POW);
     for(size_t idx=0; idx<maxOps; ++idx)
@@ -139,61 +340,104 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
 
         if(idx==0)
         {
-            if(opData->getType()==OpData::Lut1DType)
+            if(inLut1D && opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                engine.m_inBitDepthOp = GetLut1DRenderer(lut, in, BIT_DEPTH_F32);
+                inEntryName += " + " + GetOpEntryName(op, idx);
             }
             else if(in==BIT_DEPTH_F32)
             {
-                inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                engine.m_inBitDepthOp = op->getCPUOp(fastLogExpPow);
+                inEntryName += " + " + GetOpEntryName(op, idx);
             }
             else
             {
-                inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                engine.m_inBitDepthOp = CreateGenericBitDepthHelper(in, BIT_DEPTH_F32);
+                engine.m_cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOpEntryNames.push_back(GetOpEntryName(op, idx));
             }
 
             if(maxOps==1)
             {
-                outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                engine.m_outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
             }
         }
         else if(idx==(maxOps-1))
         {
-            if(opData->getType()==OpData::Lut1DType)
+            if(outLut1D && opData->getType()==OpData::Lut1DType)
             {
                 ConstLut1DOpDataRcPtr lut = DynamicPtrCast<const Lut1DOpData>(opData);
-                outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                engine.m_outBitDepthOp = GetLut1DRenderer(lut, BIT_DEPTH_F32, out);
+                outEntryName = GetOpEntryName(op, idx) + " + " + outEntryName;
             }
             else if(out==BIT_DEPTH_F32)
             {
-                outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                engine.m_outBitDepthOp = op->getCPUOp(fastLogExpPow);
+                outEntryName = GetOpEntryName(op, idx) + " + " + outEntryName;
             }
             else
             {
-                outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
-                cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                engine.m_outBitDepthOp = CreateGenericBitDepthHelper(BIT_DEPTH_F32, out);
+                engine.m_cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+                cpuOpEntryNames.push_back(GetOpEntryName(op, idx));
             }
         }
         else
         {
-            cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            engine.m_cpuOps.push_back(op->getCPUOp(fastLogExpPow));
+            cpuOpEntryNames.push_back(GetOpEntryName(op, idx));
         }
     }
+
+    engine.m_hasApplyRGB
+        = engine.m_inBitDepthOp->hasApplyRGB() && engine.m_outBitDepthOp->hasApplyRGB()
+            && std::all_of(engine.m_cpuOps.begin(), engine.m_cpuOps.end(),
+                           [](const ConstOpCPURcPtr & op) { return op->hasApplyRGB(); });
+
+    engine.m_hasApplyPlanar
+        = (IsBitDepthCast(engine.m_inBitDepthOp) || engine.m_inBitDepthOp->hasApplyPlanar())
+            && (IsBitDepthCast(engine.m_outBitDepthOp) || engine.m_outBitDepthOp->hasApplyPlanar())
+            && std::all_of(engine.m_cpuOps.begin(), engine.m_cpuOps.end(),
+                           [](const ConstOpCPURcPtr & op) { return op->hasApplyPlanar(); });
+
+    // Add the entries in the processing order.
+    engine.m_inBitDepthEntry = statistics.getEntry(inEntryName);
+    for (const auto & name : cpuOpEntryNames)
+    {
+        engine.m_cpuOpEntries.push_back(statistics.getEntry(name));
+    }
+    engine.m_outBitDepthEntry = statistics.getEntry(outEntryName);
+}
+
+namespace
+{
+
+// Build the helper in the memory block of the scratch buffer.
+template<typename InType, typename OutType>
+ScanlineHelper * BuildScanlineHelper(ScratchBuffer & memory,
+                                     BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
+                                     BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+{
+    typedef GenericScanlineHelper<InType, OutType> Helper;
+    static_assert(alignof(Helper) <= SCRATCH_ALIGNMENT, "Misaligned scanline helper.");
+
+    return new (memory.reserve(sizeof(Helper))) Helper(in, inBitDepthOp, out, outBitDepthOp);
 }
 
+} // anon.
 
 ScanlineHelper * CreateScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
-                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp,
+                                      ScratchBuffer & memory)
 {
 
 #define ADD_OUT_BIT_DEPTH(in, out)                    \
 case out:                                             \
 {                                                     \
-    return new GenericScanlineHelper<BitDepthInfo<in>::Type,                      \
-                                     BitDepthInfo<out>::Type>(in, inBitDepthOp,   \
-                                                              out, outBitDepthOp);\
+    return BuildScanlineHelper<BitDepthInfo<in>::Type,                            \
+                               BitDepthInfo<out>::Type>(memory, in, inBitDepthOp, \
+                                                        out, outBitDepthOp);      \
     break;                                            \
 }
 
@@ -206,10 +450,10 @@ case in:                                              \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT10)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT12)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT16)       \
+        ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_UINT32)       \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_F16)          \
         ADD_OUT_BIT_DEPTH(in, BIT_DEPTH_F32)          \
         case BIT_DEPTH_UINT14:                        \
-        case BIT_DEPTH_UINT32:                        \
         case BIT_DEPTH_UNKNOWN:                       \
         default:                                      \
             throw Exception("Unsupported bit-depth"); \
@@ -224,10 +468,10 @@ case in:                                              \
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT10)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT12)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT16)
+        ADD_IN_BIT_DEPTH(BIT_DEPTH_UINT32)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_F16)
         ADD_IN_BIT_DEPTH(BIT_DEPTH_F32)
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_UNKNOWN:
         default:
             throw Exception("Unsupported bit-depth");
@@ -239,14 +483,40 @@ case in:                                              \
     throw Exception("Unsupported bit-depths");
 }
 
+// The scanline helper of one processing. Like its line buffers, the helper lives in the scratch
+// memory of the thread so the apply calls do not allocate once the memory is warm.
+class ScopedScanlineHelper
+{
+public:
+    ScopedScanlineHelper() = delete;
+    ScopedScanlineHelper(const ScopedScanlineHelper &) = delete;
+    ScopedScanlineHelper & operator=(const ScopedScanlineHelper &) = delete;
+
+    ScopedScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
+                         BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+        :   m_helper(CreateScanlineHelper(in, inBitDepthOp, out, outBitDepthOp, m_memory))
+    {
+    }
+
+    ~ScopedScanlineHelper() { m_helper->~ScanlineHelper(); }
+
+    ScanlineHelper & operator*() const noexcept { return *m_helper; }
+    ScanlineHelper * operator->() const noexcept { return m_helper; }
+
+private:
+    // Note: Declared first as the helper is built in its memory.
+    ScratchBuffer m_memory;
+    ScanlineHelper * m_helper;
+};
+
 DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType type) const
 {
-    if (m_inBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_inBitDepthOp->hasDynamicProperty(type))
     {
-        return m_inBitDepthOp->getDynamicProperty(type);
+        return m_engine.m_inBitDepthOp->getDynamicProperty(type);
     }
 
-    for (const auto & op : m_cpuOps)
+    for (const auto & op : m_engine.m_cpuOps)
     {
         if (op->hasDynamicProperty(type))
         {
@@ -254,9 +524,9 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
         }
     }
 
-    if (m_outBitDepthOp->hasDynamicProperty(type))
+    if (m_engine.m_outBitDepthOp->hasDynamicProperty(type))
     {
-        return m_outBitDepthOp->getDynamicProperty(type);
+        return m_engine.m_outBitDepthOp->getDynamicProperty(type);
     }
 
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
@@ -304,6 +574,187 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
     }
 }
 
+namespace
+{
+
+// Copy the current value of a CPU processor dynamic property into a dynamic property of an op.
+void CopyDynamicPropertyValue(const DynamicPropertyImpl & src, DynamicPropertyRcPtr & dst)
+{
+    switch (src.getType())
+    {
+    case DYNAMIC_PROPERTY_EXPOSURE:
+    case DYNAMIC_PROPERTY_CONTRAST:
+    case DYNAMIC_PROPERTY_GAMMA:
+    {
+        const auto & prop = dynamic_cast<const DynamicPropertyDoubleImpl &>(src);
+        DynamicPropertyValue::AsDouble(dst)->setValue(prop.getValue());
+        break;
+    }
+    case DYNAMIC_PROPERTY_GRADING_PRIMARY:
+    {
+        const auto & prop = dynamic_cast<const DynamicPropertyGradingPrimaryImpl &>(src);
+        const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(prop.getRenderBuffer());
+        DynamicPropertyValue::AsGradingPrimary(dst)->setValue(values->m_value);
+        break;
+    }
+    case DYNAMIC_PROPERTY_GRADING_RGBCURVE:
+    {
+        const auto & prop = dynamic_cast<const DynamicPropertyGradingRGBCurveImpl &>(src);
+        const DynamicPropertyGradingRGBCurveImpl::RenderBuffer::Reader values(prop.getRenderBuffer());
+        DynamicPropertyValue::AsGradingRGBCurve(dst)->setValue(values->m_value);
+        break;
+    }
+    case DYNAMIC_PROPERTY_GRADING_TONE:
+    {
+        const auto & prop = dynamic_cast<const DynamicPropertyGradingToneImpl &>(src);
+        const DynamicPropertyGradingToneImpl::RenderBuffer::Reader values(prop.getRenderBuffer());
+        DynamicPropertyValue::AsGradingTone(dst)->setValue(values->m_value);
+        break;
+    }
+    }
+}
+
+} // anon.
+
+// Builds, in the background, an engine optimized for the current values of the dynamic
+// properties once they stop changing i.e. two consecutive apply calls see the same values. The
+// engine is only used while the values do not change.
+class CPUSpecialization : public std::enable_shared_from_this<CPUSpecialization>
+{
+public:
+    CPUSpecialization() = delete;
+    CPUSpecialization(const CPUSpecialization &) = delete;
+    CPUSpecialization & operator=(const CPUSpecialization &) = delete;
+
+    CPUSpecialization(const OpRcPtrVec & rawOps,
+                      BitDepth in,
+                      BitDepth out,
+                      OptimizationFlags oFlags,
+                      const std::vector<DynamicPropertyImplRcPtr> & dynamicProperties,
+                      const CPUStatisticsRcPtr & statistics)
+        :   m_rawOps(rawOps)
+        ,   m_inBitDepth(in)
+        ,   m_outBitDepth(out)
+        ,   m_oFlags(oFlags)
+        ,   m_dynamicProperties(dynamicProperties)
+        ,   m_statistics(statistics)
+    {
+    }
+
+    ~CPUSpecialization() = default;
+
+    // Return the specialized engine if it matches the current dynamic property values, or null.
+    ConstCPUEngineRcPtr getEngine()
+    {
+        const uint64_t version = getVersion();
+
+        std::shared_ptr<const SpecializedEngine> specialized = std::atomic_load(&m_specialized);
+        if (specialized && specialized->m_version == version)
+        {
+            return ConstCPUEngineRcPtr(specialized, &specialized->m_engine);
+        }
+
+        if (m_lastVersion.exchange(version) == version && !m_failed && !m_building.exchange(true))
+        {
+            // Note: The processor could be destroyed before the build starts.
+            std::weak_ptr<CPUSpecialization> weakThis = shared_from_this();
+            RunAsync([weakThis, version]()
+            {
+                if (auto self = weakThis.lock())
+                {
+                    self->build(version);
+                }
+            });
+        }
+
+        return ConstCPUEngineRcPtr();
+    }
+
+private:
+    struct SpecializedEngine
+    {
+        CPUEngine m_engine;
+        uint64_t  m_version = 0;
+    };
+
+    // The sum of the dynamic property versions changes each time one of the values changes.
+    uint64_t getVersion() const noexcept
+    {
+        uint64_t version = 0;
+        for (const auto & prop : m_dynamicProperties)
+        {
+            version += prop->getVersion();
+        }
+        return version;
+    }
+
+    void build(uint64_t version) noexcept
+    {
+        try
+        {
+            // Skip the build if the values changed meanwhile.
+            if (getVersion() == version)
+            {
+                // Bake the current values in a copy of the ops and then optimize them as
+                // ops without dynamic properties.
+                OpRcPtrVec rawOps = m_rawOps.clone();
+                for (auto & op : rawOps)
+                {
+                    for (const auto & prop : m_dynamicProperties)
+                    {
+                        if (op->hasDynamicProperty(prop->getType()))
+                        {
+                            DynamicPropertyRcPtr dst = op->getDynamicProperty(prop->getType());
+                            CopyDynamicPropertyValue(*prop, dst);
+                        }
+                    }
+                }
+
+                const OptimizationFlags oFlags
+                    = OptimizationFlags(m_oFlags | OPTIMIZATION_NO_DYNAMIC_PROPERTIES);
+
+                OpRcPtrVec ops;
+                FinalizeOpsForCPU(ops, rawOps, m_inBitDepth, m_outBitDepth, oFlags);
+
+                auto specialized = std::make_shared<SpecializedEngine>();
+                CreateCPUEngine(ops, m_inBitDepth, m_outBitDepth, oFlags,
+                                *m_statistics, specialized->m_engine);
+                OptimizeIntegerDomain(ops, m_inBitDepth, m_outBitDepth, oFlags,
+                                      *m_statistics, specialized->m_engine);
+                specialized->m_version = version;
+
+                std::atomic_store(&m_specialized,
+                                  std::shared_ptr<const SpecializedEngine>(specialized));
+            }
+        }
+        catch (const std::exception & e)
+        {
+            // Keep using the generic engine.
+            m_failed = true;
+
+            std::ostringstream oss;
+            oss << "Could not specialize the CPU processor: " << e.what();
+            LogDebug(oss.str());
+        }
+
+        m_building = false;
+    }
+
+    const OpRcPtrVec  m_rawOps;
+    const BitDepth    m_inBitDepth;
+    const BitDepth    m_outBitDepth;
+    const OptimizationFlags m_oFlags;
+    const std::vector<DynamicPropertyImplRcPtr> m_dynamicProperties;
+    const CPUStatisticsRcPtr m_statistics;
+
+    std::atomic<uint64_t> m_lastVersion{ 0 }; // Version seen by the last apply call.
+    std::atomic<bool> m_building{ false };
+    std::atomic<bool> m_failed{ false };
+
+    // Note: Use the atomic shared pointer functions.
+    std::shared_ptr<const SpecializedEngine> m_specialized;
+};
+
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
                                   OptimizationFlags oFlags)
@@ -324,10 +775,64 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
 
     // Get the CPU Ops while taking care of the input and output bit-depths.
 
-    m_cpuOps.clear();
-    m_inBitDepthOp = nullptr;
-    m_outBitDepthOp = nullptr;
-    CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
+    m_engine = CPUEngine();
+    {
+        ProfilingTimer timer(&ProcessorProfile::m_rendererTime, ProfilingTimer::PHASE);
+        CreateCPUEngine(ops, in, out, oFlags, *m_statistics, m_engine);
+        OptimizeIntegerDomain(ops, in, out, oFlags, *m_statistics, m_engine);
+    }
+
+    // Collect the dynamic properties the specialized engine depends on.
+
+    m_specialization = nullptr;
+    m_lastEngineType = CPU_ENGINE_GENERIC;
+
+    if (HasFlag(oFlags, OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES)
+        && !HasFlag(oFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+    {
+        std::vector<DynamicPropertyImplRcPtr> dynamicProperties;
+        bool uniqueProperties = true;
+
+        for (const auto type : { DYNAMIC_PROPERTY_EXPOSURE,
+                                 DYNAMIC_PROPERTY_CONTRAST,
+                                 DYNAMIC_PROPERTY_GAMMA,
+                                 DYNAMIC_PROPERTY_GRADING_PRIMARY,
+                                 DYNAMIC_PROPERTY_GRADING_RGBCURVE,
+                                 DYNAMIC_PROPERTY_GRADING_TONE })
+        {
+            size_t numProperties = 0;
+            for (const auto & op : { m_engine.m_inBitDepthOp, m_engine.m_outBitDepthOp })
+            {
+                if (op->hasDynamicProperty(type))
+                {
+                    ++numProperties;
+                }
+            }
+            for (const auto & op : m_engine.m_cpuOps)
+            {
+                if (op->hasDynamicProperty(type))
+                {
+                    ++numProperties;
+                }
+            }
+
+            if (numProperties == 1)
+            {
+                dynamicProperties.push_back(
+                    DynamicPtrCast<DynamicPropertyImpl>(getDynamicProperty(type)));
+            }
+            // Several ops of the same type are not synchronized (refer to
+            // OpRcPtrVec::validateDynamicProperties()) so the values cannot be baked by type.
+            uniqueProperties = uniqueProperties && numProperties <= 1;
+        }
+
+        if (!dynamicProperties.empty() && uniqueProperties)
+        {
+            m_specialization = std::make_shared<CPUSpecialization>(rawOps, in, out, oFlags,
+                                                                   dynamicProperties,
+                                                                   m_statistics);
+        }
+    }
 
     // Compute the cache id.
 
@@ -340,93 +845,903 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+const CPUEngine & CPUProcessor::Impl::getEngine(ConstCPUEngineRcPtr & specialized) const
+{
+    if (m_specialization)
+    {
+        specialized = m_specialization->getEngine();
+    }
 
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+    m_lastEngineType = specialized ? CPU_ENGINE_SPECIALIZED : CPU_ENGINE_GENERIC;
 
-    float * rgbaBuffer = nullptr;
+    return specialized ? *specialized : m_engine;
+}
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+// Process the packed RGB images without expanding the pixels to RGBA.
+void ProcessRGBScanlines(const CPUEngine & engine, ScanlineHelper & scanlineBuilder)
+{
+    float * rgbBuffer = nullptr;
     long numPixels = 0;
 
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        scanlineBuilder.prepRGBScanline(&rgbBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
+        const size_t numOps = engine.m_cpuOps.size();
         for(size_t i = 0; i<numOps; ++i)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            engine.m_cpuOps[i]->applyRGB(rgbBuffer, rgbBuffer, numPixels);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        scanlineBuilder.finishRGBScanline();
     }
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
+// Same as ProcessRGBScanlines() but also measures each step.
+void ProcessRGBScanlinesWithStatistics(const CPUEngine & engine, ScanlineHelper & scanlineBuilder)
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
-
-    // Prepare the processing.
-    scanlineBuilder->init(srcImgDesc, dstImgDesc);
-
-    float * rgbaBuffer = nullptr;
+    float * rgbBuffer = nullptr;
     long numPixels = 0;
 
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        Clock::time_point start = Clock::now();
+
+        scanlineBuilder.prepRGBScanline(&rgbBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
+        Clock::time_point end = Clock::now();
+        engine.m_inBitDepthEntry->add(end - start, numPixels);
+
+        const size_t numOps = engine.m_cpuOps.size();
         for(size_t i = 0; i<numOps; ++i)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            start = end;
+            engine.m_cpuOps[i]->applyRGB(rgbBuffer, rgbBuffer, numPixels);
+            end = Clock::now();
+            engine.m_cpuOpEntries[i]->add(end - start, numPixels);
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        start = end;
+        scanlineBuilder.finishRGBScanline();
+        engine.m_outBitDepthEntry->add(Clock::now() - start, numPixels);
     }
 }
 
-void CPUProcessor::Impl::applyRGB(float * pixel) const
+// Process the planar images without interleaving the channels.
+void ProcessPlanarScanlines(const CPUEngine & engine, ScanlineHelper & scanlineBuilder)
 {
-    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
-
-    m_inBitDepthOp->apply(v, v, 1);
+    float * planes[4] = { nullptr, nullptr, nullptr, nullptr };
+    long numPixels = 0;
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+    while(true)
     {
-        m_cpuOps[i]->apply(v, v, 1);
-    }
+        scanlineBuilder.prepPlanarScanline(planes, numPixels);
+        if(numPixels == 0) break;
 
-    m_outBitDepthOp->apply(v, v, 1);
+        const size_t numOps = engine.m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            engine.m_cpuOps[i]->applyPlanar(planes[0], planes[1], planes[2], planes[3], numPixels);
+        }
 
-    pixel[0] = v[0];
-    pixel[1] = v[1];
-    pixel[2] = v[2];
+        scanlineBuilder.finishPlanarScanline();
+    }
 }
 
-void CPUProcessor::Impl::applyRGBA(float * pixel) const
+// Same as ProcessPlanarScanlines() but also measures each step.
+void ProcessPlanarScanlinesWithStatistics(const CPUEngine & engine,
+                                          ScanlineHelper & scanlineBuilder)
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
+    float * planes[4] = { nullptr, nullptr, nullptr, nullptr };
+    long numPixels = 0;
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+    while(true)
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
-    }
+        Clock::time_point start = Clock::now();
 
-    m_outBitDepthOp->apply(pixel, pixel, 1);
-}
+        scanlineBuilder.prepPlanarScanline(planes, numPixels);
+        if(numPixels == 0) break;
+
+        Clock::time_point end = Clock::now();
+        engine.m_inBitDepthEntry->add(end - start, numPixels);
+
+        const size_t numOps = engine.m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            start = end;
+            engine.m_cpuOps[i]->applyPlanar(planes[0], planes[1], planes[2], planes[3], numPixels);
+            end = Clock::now();
+            engine.m_cpuOpEntries[i]->add(end - start, numPixels);
+        }
+
+        start = end;
+        scanlineBuilder.finishPlanarScanline();
+        engine.m_outBitDepthEntry->add(Clock::now() - start, numPixels);
+    }
+}
+
+void ProcessScanlines(const CPUEngine & engine, ScanlineHelper & scanlineBuilder)
+{
+    if (engine.m_hasApplyRGB && scanlineBuilder.isPackedRGB())
+    {
+        ProcessRGBScanlines(engine, scanlineBuilder);
+        return;
+    }
+
+    if (engine.m_hasApplyPlanar && scanlineBuilder.isPlanar())
+    {
+        ProcessPlanarScanlines(engine, scanlineBuilder);
+        return;
+    }
+
+    float * rgbaBuffer = nullptr;
+    long numPixels = 0;
+
+    while(true)
+    {
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
+        if(numPixels == 0) break;
+
+        const size_t numOps = engine.m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            engine.m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+        }
+
+        scanlineBuilder.finishRGBAScanline();
+    }
+}
+
+// Same as ProcessScanlines() but also measures each step.
+void ProcessScanlinesWithStatistics(const CPUEngine & engine, ScanlineHelper & scanlineBuilder)
+{
+    if (engine.m_hasApplyRGB && scanlineBuilder.isPackedRGB())
+    {
+        ProcessRGBScanlinesWithStatistics(engine, scanlineBuilder);
+        return;
+    }
+
+    if (engine.m_hasApplyPlanar && scanlineBuilder.isPlanar())
+    {
+        ProcessPlanarScanlinesWithStatistics(engine, scanlineBuilder);
+        return;
+    }
+
+    float * rgbaBuffer = nullptr;
+    long numPixels = 0;
+
+    while(true)
+    {
+        Clock::time_point start = Clock::now();
+
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
+        if(numPixels == 0) break;
+
+        Clock::time_point end = Clock::now();
+        engine.m_inBitDepthEntry->add(end - start, numPixels);
+
+        const size_t numOps = engine.m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            start = end;
+            engine.m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            end = Clock::now();
+            engine.m_cpuOpEntries[i]->add(end - start, numPixels);
+        }
+
+        start = end;
+        scanlineBuilder.finishRGBAScanline();
+        engine.m_outBitDepthEntry->add(Clock::now() - start, numPixels);
+    }
+}
+
+// Process packed RGBA F32 pixels in place.
+void ProcessPixels(const CPUEngine & engine, float * rgba, long numPixels)
+{
+    engine.m_inBitDepthOp->apply(rgba, rgba, numPixels);
+
+    const size_t numOps = engine.m_cpuOps.size();
+    for(size_t i = 0; i<numOps; ++i)
+    {
+        engine.m_cpuOps[i]->apply(rgba, rgba, numPixels);
+    }
+
+    engine.m_outBitDepthOp->apply(rgba, rgba, numPixels);
+}
+
+// Same as ProcessPixels() but also measures each step.
+void ProcessPixelsWithStatistics(const CPUEngine & engine, float * rgba, long numPixels)
+{
+    Clock::time_point start = Clock::now();
+    engine.m_inBitDepthOp->apply(rgba, rgba, numPixels);
+    Clock::time_point end = Clock::now();
+    engine.m_inBitDepthEntry->add(end - start, numPixels);
+
+    const size_t numOps = engine.m_cpuOps.size();
+    for(size_t i = 0; i<numOps; ++i)
+    {
+        start = end;
+        engine.m_cpuOps[i]->apply(rgba, rgba, numPixels);
+        end = Clock::now();
+        engine.m_cpuOpEntries[i]->add(end - start, numPixels);
+    }
+
+    start = end;
+    engine.m_outBitDepthOp->apply(rgba, rgba, numPixels);
+    engine.m_outBitDepthEntry->add(Clock::now() - start, numPixels);
+}
+
+// Process packed RGB F32 pixels in place (i.e. the engine must support OpCPU::applyRGB()).
+void ProcessRGBPixels(const CPUEngine & engine, float * rgb, long numPixels)
+{
+    engine.m_inBitDepthOp->applyRGB(rgb, rgb, numPixels);
+
+    const size_t numOps = engine.m_cpuOps.size();
+    for(size_t i = 0; i<numOps; ++i)
+    {
+        engine.m_cpuOps[i]->applyRGB(rgb, rgb, numPixels);
+    }
+
+    engine.m_outBitDepthOp->applyRGB(rgb, rgb, numPixels);
+}
+
+// Same as ProcessRGBPixels() but also measures each step.
+void ProcessRGBPixelsWithStatistics(const CPUEngine & engine, float * rgb, long numPixels)
+{
+    Clock::time_point start = Clock::now();
+    engine.m_inBitDepthOp->applyRGB(rgb, rgb, numPixels);
+    Clock::time_point end = Clock::now();
+    engine.m_inBitDepthEntry->add(end - start, numPixels);
+
+    const size_t numOps = engine.m_cpuOps.size();
+    for(size_t i = 0; i<numOps; ++i)
+    {
+        start = end;
+        engine.m_cpuOps[i]->applyRGB(rgb, rgb, numPixels);
+        end = Clock::now();
+        engine.m_cpuOpEntries[i]->add(end - start, numPixels);
+    }
+
+    start = end;
+    engine.m_outBitDepthOp->applyRGB(rgb, rgb, numPixels);
+    engine.m_outBitDepthEntry->add(Clock::now() - start, numPixels);
+}
+
+// Number of pixels processed at once by the lists of pixels, to stay in the cache between the ops.
+constexpr size_t PIXEL_BATCH_SIZE = 1024;
+
+// Min number of pixels per thread, as the pixels are cheap to process compared to the cost of
+// dispatching the work.
+constexpr size_t MIN_PIXELS_PER_THREAD = 16 * PIXEL_BATCH_SIZE;
+
+// Process the RGBA pixels of integer values by the engine.
+template<typename InType, typename OutType>
+void ProcessIntegerPixels(const CPUEngine & engine, BitDepth in, BitDepth out,
+                          std::vector<InType> & src, std::vector<OutType> & dst)
+{
+    const long numPixels = long(src.size() / 4);
+    dst.resize(src.size());
+
+    PackedImageDesc srcImg(src.data(), numPixels, 1, 4, in,
+                           AutoStride, AutoStride, AutoStride);
+    PackedImageDesc dstImg(dst.data(), numPixels, 1, 4, out,
+                           AutoStride, AutoStride, AutoStride);
+
+    ScopedScanlineHelper scanlineBuilder(in, engine.m_inBitDepthOp, out, engine.m_outBitDepthOp);
+    scanlineBuilder->init(srcImg, dstImg);
+
+    ProcessScanlines(engine, *scanlineBuilder);
+}
+
+template<typename InType, typename OutType>
+class IntegerDomainLutImpl : public IntegerDomainLut
+{
+public:
+    IntegerDomainLutImpl() = delete;
+    IntegerDomainLutImpl(const IntegerDomainLutImpl &) = delete;
+    IntegerDomainLutImpl & operator=(const IntegerDomainLutImpl &) = delete;
+
+    // The look-up tables hold the results of the engine for all the values the input type
+    // could hold i.e. including the out-of-range ones (e.g. above 1023 for 10-bit) so the
+    // look-up processes them exactly as the engine does.
+    IntegerDomainLutImpl(BitDepth in, BitDepth out, const CPUEngine & engine)
+        :   m_inBitDepth(in)
+        ,   m_outBitDepth(out)
+    {
+        const size_t numValues = size_t(std::numeric_limits<InType>::max()) + 1;
+
+        // All the channels of a pixel hold the same input value.
+        std::vector<InType> domain(4 * numValues);
+        for (size_t idx = 0; idx < numValues; ++idx)
+        {
+            std::fill_n(&domain[4 * idx], 4, static_cast<InType>(idx));
+        }
+
+        std::vector<OutType> values;
+        ProcessIntegerPixels(engine, in, out, domain, values);
+
+        for (size_t chan = 0; chan < 4; ++chan)
+        {
+            m_luts[chan].resize(numValues);
+            for (size_t idx = 0; idx < numValues; ++idx)
+            {
+                m_luts[chan][idx] = values[4 * idx + chan];
+            }
+        }
+    }
+
+    ~IntegerDomainLutImpl() override = default;
+
+    bool apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const override
+    {
+        GenericImageDesc srcImg;
+        srcImg.init(srcImgDesc, m_inBitDepth, ConstOpCPURcPtr());
+        GenericImageDesc dstImg;
+        dstImg.init(dstImgDesc, m_outBitDepth, ConstOpCPURcPtr());
+
+        if (srcImg.m_chanPacking != CHANNEL_PACKING_NONE
+            || dstImg.m_chanPacking != CHANNEL_PACKING_NONE
+            || srcImg.m_width != dstImg.m_width
+            || srcImg.m_height != dstImg.m_height)
+        {
+            return false;
+        }
+
+        const OutType * lutR = m_luts[0].data();
+        const OutType * lutG = m_luts[1].data();
+        const OutType * lutB = m_luts[2].data();
+        const OutType * lutA = m_luts[3].data();
+
+        const ptrdiff_t srcXStride = srcImg.m_xStrideBytes;
+        const ptrdiff_t dstXStride = dstImg.m_xStrideBytes;
+
+        for (long y = 0; y < dstImg.m_height; ++y)
+        {
+            const ptrdiff_t srcOffset = srcImg.m_yStrideBytes * y;
+            const ptrdiff_t dstOffset = dstImg.m_yStrideBytes * y;
+
+            const char * rIn = srcImg.m_rData + srcOffset;
+            const char * gIn = srcImg.m_gData + srcOffset;
+            const char * bIn = srcImg.m_bData + srcOffset;
+            const char * aIn = srcImg.m_aData ? srcImg.m_aData + srcOffset : nullptr;
+
+            char * rOut = dstImg.m_rData + dstOffset;
+            char * gOut = dstImg.m_gData + dstOffset;
+            char * bOut = dstImg.m_bData + dstOffset;
+            char * aOut = dstImg.m_aData ? dstImg.m_aData + dstOffset : nullptr;
+
+            for (long x = 0; x < dstImg.m_width; ++x)
+            {
+                // Read the whole pixel first for the in-place processing.
+                const unsigned r = index(rIn);
+                const unsigned g = index(gIn);
+                const unsigned b = index(bIn);
+                const unsigned a = aIn ? index(aIn) : 0;
+
+                *reinterpret_cast<OutType *>(rOut) = lutR[r];
+                *reinterpret_cast<OutType *>(gOut) = lutG[g];
+                *reinterpret_cast<OutType *>(bOut) = lutB[b];
+
+                rIn += srcXStride;
+                gIn += srcXStride;
+                bIn += srcXStride;
+
+                rOut += dstXStride;
+                gOut += dstXStride;
+                bOut += dstXStride;
+
+                if (aIn)
+                {
+                    aIn += srcXStride;
+                }
+                if (aOut)
+                {
+                    *reinterpret_cast<OutType *>(aOut) = lutA[a];
+                    aOut += dstXStride;
+                }
+            }
+        }
+
+        return true;
+    }
+
+private:
+    static unsigned index(const char * value) noexcept
+    {
+        return unsigned(*reinterpret_cast<const InType *>(value));
+    }
+
+    const BitDepth m_inBitDepth;
+    const BitDepth m_outBitDepth;
+
+    std::vector<OutType> m_luts[4];
+};
+
+// Is the processing worth replacing by a 3D LUT i.e. not already a single cheap op or 3D LUT?
+bool IsWorthLut3D(const OpRcPtrVec & ops)
+{
+    if (ops.size() != 1)
+    {
+        return true;
+    }
+
+    ConstOpRcPtr op = ops[0];
+    const OpData::Type type = op->data()->getType();
+    return type != OpData::MatrixType && type != OpData::RangeType && type != OpData::Lut3DType;
+}
+
+// Number of pseudo-random input values sampled in addition to the ones of each grid cell.
+constexpr size_t NUM_RANDOM_LUT3D_SAMPLES = 1 << 18;
+
+// Return the max difference between the output values of the two engines for a sampling of the
+// input values of the 3D LUT grid i.e. the center of each cell (where the interpolation error is
+// expected to be the largest), the first code value past each vertex (to catch the
+// discontinuities close to the vertices) and a deterministic pseudo-random sampling of the whole
+// domain.
+template<typename InType, typename OutType>
+double GetMaxLut3DError(const CPUEngine & engine, const CPUEngine & lutEngine,
+                        BitDepth in, BitDepth out, unsigned long gridSize)
+{
+    const double inMax = GetBitDepthMaxValue(in);
+    const unsigned long numCells = gridSize - 1;
+
+    std::vector<InType> centers(numCells);
+    std::vector<InType> vertices(numCells);
+    for (unsigned long idx = 0; idx < numCells; ++idx)
+    {
+        centers[idx]  = static_cast<InType>(std::floor((idx + 0.5) * inMax / numCells + 0.5));
+        vertices[idx] = static_cast<InType>(std::floor(idx * inMax / numCells + 0.5) + 1.);
+    }
+
+    std::vector<InType> src;
+    src.reserve(4 * (2 * numCells * numCells * numCells + NUM_RANDOM_LUT3D_SAMPLES));
+    for (const auto & values : { centers, vertices })
+    {
+        for (unsigned long r = 0; r < numCells; ++r)
+        {
+            for (unsigned long g = 0; g < numCells; ++g)
+            {
+                for (unsigned long b = 0; b < numCells; ++b)
+                {
+                    src.push_back(values[r]);
+                    src.push_back(values[g]);
+                    src.push_back(values[b]);
+                    src.push_back(values[(r + g + b) % numCells]);
+                }
+            }
+        }
+    }
+
+    // A linear congruential generator keeps the sampling (and the decision) reproducible.
+    const uint32_t numValues = uint32_t(inMax) + 1;
+    uint32_t seed = 12345u;
+    for (size_t idx = 0; idx < 4 * NUM_RANDOM_LUT3D_SAMPLES; ++idx)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        src.push_back(static_cast<InType>((seed >> 8) % numValues));
+    }
+
+    std::vector<OutType> ref;
+    ProcessIntegerPixels(engine, in, out, src, ref);
+
+    std::vector<OutType> res;
+    ProcessIntegerPixels(lutEngine, in, out, src, res);
+
+    double maxError = 0.;
+    for (size_t idx = 0; idx < ref.size(); ++idx)
+    {
+        maxError = std::max(maxError, std::fabs(double(ref[idx]) - double(res[idx])));
+    }
+
+    return maxError;
+}
+
+template<typename InType, typename OutType>
+void BuildIntegerDomainEngine(const OpRcPtrVec & ops,
+                              BitDepth in,
+                              BitDepth out,
+                              OptimizationFlags oFlags,
+                              CPUStatistics & statistics,
+                              CPUEngine & engine)
+{
+    if (!ops.hasChannelCrosstalk())
+    {
+        // The output value of a channel only depends on its input value so the look-up of
+        // the results of all the input values is exact.
+        engine.m_integerLut
+            = std::make_shared<IntegerDomainLutImpl<InType, OutType>>(in, out, engine);
+        engine.m_integerLutEntry
+            = statistics.getEntry(std::string("lookup ") + BitDepthToString(in)
+                                  + " to " + BitDepthToString(out));
+        return;
+    }
+
+    if (!IsWorthLut3D(ops))
+    {
+        return;
+    }
+
+    // The error bound is one output code value, or one 10-bit code value for larger outputs.
+    const double maxError = std::max(1., std::floor(GetBitDepthMaxValue(out) / 1023.));
+
+    // Use the smallest grid meeting the error bound.
+    for (const unsigned long gridSize : { 33ul, 65ul })
+    {
+        Lut3DOpDataRcPtr lut = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, gridSize);
+
+        // Process the grid values (i.e. the identity domain) in 32-bit float.
+        Array::Values & values = lut->getArray().getValues();
+        OpRcPtrVec evalOps = ops.clone();
+        EvalTransform(values.data(), values.data(),
+                      long(gridSize * gridSize * gridSize), evalOps);
+
+        OpRcPtrVec lutOps;
+        CreateLut3DOp(lutOps, lut, TRANSFORM_DIR_FORWARD);
+        lutOps.finalize();
+
+        CPUEngine lutEngine;
+        CreateCPUEngine(lutOps, in, out, oFlags, statistics, lutEngine);
+
+        if (GetMaxLut3DError<InType, OutType>(engine, lutEngine, in, out, gridSize) <= maxError)
+        {
+            engine = lutEngine;
+            return;
+        }
+    }
+
+    // Keep the processing of all the ops.
+}
+
+// Process the images using the look-up of the integer input values, if any. Return false if
+// the engine has none or if the image layouts are not supported.
+bool ApplyIntegerLut(const CPUEngine & engine,
+                     const CPUStatistics & statistics,
+                     const ImageDesc & srcImgDesc,
+                     ImageDesc & dstImgDesc)
+{
+    if (!engine.m_integerLut)
+    {
+        return false;
+    }
+
+    const Clock::time_point start = Clock::now();
+
+    if (!engine.m_integerLut->apply(srcImgDesc, dstImgDesc))
+    {
+        return false;
+    }
+
+    if (statistics.isEnabled())
+    {
+        engine.m_integerLutEntry->add(Clock::now() - start,
+                                      dstImgDesc.getWidth() * dstImgDesc.getHeight());
+    }
+
+    return true;
+}
+
+} // anon.
+
+void OptimizeIntegerDomain(const OpRcPtrVec & ops,
+                           BitDepth in,
+                           BitDepth out,
+                           OptimizationFlags oFlags,
+                           CPUStatistics & statistics,
+                           CPUEngine & engine)
+{
+    // Only the inputs of up to 16 bits could be enumerated, and the error bound of the 3D LUT
+    // is in output code values.
+    auto isSmallInteger = [](BitDepth bitDepth)
+    {
+        return bitDepth == BIT_DEPTH_UINT8 || bitDepth == BIT_DEPTH_UINT10
+            || bitDepth == BIT_DEPTH_UINT12 || bitDepth == BIT_DEPTH_UINT16;
+    };
+
+    // The dynamic properties must stay adjustable.
+    if (!HasFlag(oFlags, OPTIMIZATION_INTEGER_DOMAIN)
+        || !isSmallInteger(in) || !isSmallInteger(out) || ops.isDynamic())
+    {
+        return;
+    }
+
+    if (in == BIT_DEPTH_UINT8 && out == BIT_DEPTH_UINT8)
+    {
+        BuildIntegerDomainEngine<uint8_t, uint8_t>(ops, in, out, oFlags, statistics, engine);
+    }
+    else if (in == BIT_DEPTH_UINT8)
+    {
+        BuildIntegerDomainEngine<uint8_t, uint16_t>(ops, in, out, oFlags, statistics, engine);
+    }
+    else if (out == BIT_DEPTH_UINT8)
+    {
+        BuildIntegerDomainEngine<uint16_t, uint8_t>(ops, in, out, oFlags, statistics, engine);
+    }
+    else
+    {
+        BuildIntegerDomainEngine<uint16_t, uint16_t>(ops, in, out, oFlags, statistics, engine);
+    }
+}
+
+void CPUProcessor::Impl::apply(ImageDesc & imgDesc) const
+{   
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    if (ApplyIntegerLut(engine, *m_statistics, imgDesc, imgDesc))
+    {
+        return;
+    }
+
+    // Get the ScanlineHelper for this thread (no allocation once the scratch memory is warm).
+    ScopedScanlineHelper scanlineBuilder(m_inBitDepth, engine.m_inBitDepthOp,
+                                         m_outBitDepth, engine.m_outBitDepthOp);
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    if (m_statistics->isEnabled())
+    {
+        ProcessScanlinesWithStatistics(engine, *scanlineBuilder);
+    }
+    else
+    {
+        ProcessScanlines(engine, *scanlineBuilder);
+    }
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
+{
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    if (ApplyIntegerLut(engine, *m_statistics, srcImgDesc, dstImgDesc))
+    {
+        return;
+    }
+
+    // Get the ScanlineHelper for this thread (no allocation once the scratch memory is warm).
+    ScopedScanlineHelper scanlineBuilder(m_inBitDepth, engine.m_inBitDepthOp,
+                                         m_outBitDepth, engine.m_outBitDepthOp);
+
+    // Prepare the processing.
+    scanlineBuilder->init(srcImgDesc, dstImgDesc);
+
+    if (m_statistics->isEnabled())
+    {
+        ProcessScanlinesWithStatistics(engine, *scanlineBuilder);
+    }
+    else
+    {
+        ProcessScanlines(engine, *scanlineBuilder);
+    }
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc * const * srcImgDescs,
+                               ImageDesc * const * dstImgDescs,
+                               size_t numImages) const
+{
+    if (numImages == 0)
+    {
+        return;
+    }
+
+    if (!srcImgDescs || !dstImgDescs)
+    {
+        throw Exception("CPUProcessor: The list of images is null.");
+    }
+
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    // The images are expected to be small so each thread processes a whole image, and reuses the
+    // same ScanlineHelper (i.e. the same line buffers) for all the images of its chunk.
+    ParallelFor(numImages, 1, [&](size_t begin, size_t end)
+    {
+        ScopedScanlineHelper scanlineBuilder(m_inBitDepth, engine.m_inBitDepthOp,
+                                             m_outBitDepth, engine.m_outBitDepthOp);
+
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            const ImageDesc * srcImgDesc = srcImgDescs[idx];
+            ImageDesc * dstImgDesc       = dstImgDescs[idx];
+
+            if (!srcImgDesc || !dstImgDesc)
+            {
+                std::ostringstream oss;
+                oss << "CPUProcessor: The list of images contains a null image at index "
+                    << idx << ".";
+                throw Exception(oss.str().c_str());
+            }
+
+            if (ApplyIntegerLut(engine, *m_statistics, *srcImgDesc, *dstImgDesc))
+            {
+                continue;
+            }
+
+            if (srcImgDesc == dstImgDesc)
+            {
+                scanlineBuilder->init(*dstImgDesc);
+            }
+            else
+            {
+                scanlineBuilder->init(*srcImgDesc, *dstImgDesc);
+            }
+
+            if (m_statistics->isEnabled())
+            {
+                ProcessScanlinesWithStatistics(engine, *scanlineBuilder);
+            }
+            else
+            {
+                ProcessScanlines(engine, *scanlineBuilder);
+            }
+        }
+    });
+}
+
+void CPUProcessor::Impl::applyRGB(float * pixel) const
+{
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+
+    if (m_statistics->isEnabled())
+    {
+        ProcessPixelsWithStatistics(engine, v, 1);
+    }
+    else
+    {
+        ProcessPixels(engine, v, 1);
+    }
+
+    pixel[0] = v[0];
+    pixel[1] = v[1];
+    pixel[2] = v[2];
+}
+
+void CPUProcessor::Impl::applyRGBA(float * pixel) const
+{
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    if (m_statistics->isEnabled())
+    {
+        ProcessPixelsWithStatistics(engine, pixel, 1);
+    }
+    else
+    {
+        ProcessPixels(engine, pixel, 1);
+    }
+}
+
+void CPUProcessor::Impl::applyRGB(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    applyPixels(pixels, numPixels, 3, pixelStrideBytes);
+}
+
+void CPUProcessor::Impl::applyRGBA(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    applyPixels(pixels, numPixels, 4, pixelStrideBytes);
+}
+
+void CPUProcessor::Impl::applyPixels(float * pixels,
+                                     size_t numPixels,
+                                     long numChannels,
+                                     ptrdiff_t pixelStrideBytes) const
+{
+    if (m_inBitDepth != BIT_DEPTH_F32 || m_outBitDepth != BIT_DEPTH_F32)
+    {
+        throw Exception("CPUProcessor: The list of pixels requires 32-bit float input and "
+                        "output bit-depths.");
+    }
+
+    const ptrdiff_t packedStrideBytes = numChannels * ptrdiff_t(sizeof(float));
+    if (pixelStrideBytes == AutoStride)
+    {
+        pixelStrideBytes = packedStrideBytes;
+    }
+
+    if (pixelStrideBytes < packedStrideBytes || pixelStrideBytes % ptrdiff_t(sizeof(float)) != 0)
+    {
+        std::ostringstream oss;
+        oss << "CPUProcessor: Invalid pixel stride of " << pixelStrideBytes
+            << " bytes, it must be a multiple of " << sizeof(float)
+            << " and at least " << packedStrideBytes << " bytes.";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (numPixels == 0)
+    {
+        return;
+    }
+
+    if (!pixels)
+    {
+        throw Exception("CPUProcessor: The list of pixels is null.");
+    }
+
+    ConstCPUEngineRcPtr specialized;
+    const CPUEngine & engine = getEngine(specialized);
+
+    const bool withStatistics = m_statistics->isEnabled();
+    const bool isPacked       = pixelStrideBytes == packedStrideBytes;
+    const size_t pixelStride  = size_t(pixelStrideBytes) / sizeof(float);
+
+    ParallelFor(numPixels, MIN_PIXELS_PER_THREAD, [&](size_t begin, size_t end)
+    {
+        // Packed pixels are processed in place, the others go through an RGBA buffer.
+        const bool inPlace = isPacked && (numChannels == 4 || engine.m_hasApplyRGB);
+
+        ScratchBuffer scratch;
+        float * rgbaBuffer = inPlace ? nullptr : scratch.reserve<float>(4 * PIXEL_BATCH_SIZE);
+
+        for (size_t first = begin; first < end; first += PIXEL_BATCH_SIZE)
+        {
+            const long numBatchPixels = long(std::min(PIXEL_BATCH_SIZE, end - first));
+            float * batch = pixels + first * pixelStride;
+
+            if (inPlace)
+            {
+                if (numChannels == 4 && withStatistics)
+                {
+                    ProcessPixelsWithStatistics(engine, batch, numBatchPixels);
+                }
+                else if (numChannels == 4)
+                {
+                    ProcessPixels(engine, batch, numBatchPixels);
+                }
+                else if (withStatistics)
+                {
+                    ProcessRGBPixelsWithStatistics(engine, batch, numBatchPixels);
+                }
+                else
+                {
+                    ProcessRGBPixels(engine, batch, numBatchPixels);
+                }
+                continue;
+            }
+
+            // Gather the pixels in the RGBA buffer (i.e. alpha is zero for the RGB pixels as for
+            // the single pixel methods).
+            for (long idx = 0; idx < numBatchPixels; ++idx)
+            {
+                const float * pixel = batch + idx * pixelStride;
+                float * rgba = rgbaBuffer + 4 * idx;
+
+                rgba[0] = pixel[0];
+                rgba[1] = pixel[1];
+                rgba[2] = pixel[2];
+                rgba[3] = numChannels == 4 ? pixel[3] : 0.0f;
+            }
+
+            if (withStatistics)
+            {
+                ProcessPixelsWithStatistics(engine, rgbaBuffer, numBatchPixels);
+            }
+            else
+            {
+                ProcessPixels(engine, rgbaBuffer, numBatchPixels);
+            }
+
+            // Scatter the results, leaving untouched the data between the pixels.
+            for (long idx = 0; idx < numBatchPixels; ++idx)
+            {
+                float * pixel = batch + idx * pixelStride;
+                const float * rgba = rgbaBuffer + 4 * idx;
+
+                std::copy_n(rgba, numChannels, pixel);
+            }
+        }
+    });
+}
 
 
 
@@ -497,6 +1812,18 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(ImageDesc * const * imgDescs, size_t numImages) const
+{
+    getImpl()->apply(imgDescs, imgDescs, numImages);
+}
+
+void CPUProcessor::apply(const ImageDesc * const * srcImgDescs,
+                         ImageDesc * const * dstImgDescs,
+                         size_t numImages) const
+{
+    getImpl()->apply(srcImgDescs, dstImgDescs, numImages);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
@@ -507,5 +1834,55 @@ void CPUProcessor::applyRGBA(float * pixel) const
     getImpl()->applyRGBA(pixel);
 }
 
+void CPUProcessor::applyRGB(float * pixels, size_t numPixels) const
+{
+    getImpl()->applyRGB(pixels, numPixels, AutoStride);
+}
+
+void CPUProcessor::applyRGBA(float * pixels, size_t numPixels) const
+{
+    getImpl()->applyRGBA(pixels, numPixels, AutoStride);
+}
+
+void CPUProcessor::applyRGB(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    getImpl()->applyRGB(pixels, numPixels, pixelStrideBytes);
+}
+
+void CPUProcessor::applyRGBA(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const
+{
+    getImpl()->applyRGBA(pixels, numPixels, pixelStrideBytes);
+}
+
+CPUEngineType CPUProcessor::getLastEngineType() const
+{
+    return getImpl()->getLastEngineType();
+}
+
+void CPUProcessor::enableStatistics(bool enable) const
+{
+    getImpl()->enableStatistics(enable);
+}
+
+bool CPUProcessor::isStatisticsEnabled() const
+{
+    return getImpl()->isStatisticsEnabled();
+}
+
+int CPUProcessor::getNumStatistics() const
+{
+    return getImpl()->getNumStatistics();
+}
+
+CPUOpStatistics CPUProcessor::getStatistics(int index) const
+{
+    return getImpl()->getStatistics(index);
+}
+
+void CPUProcessor::resetStatistics() const
+{
+    getImpl()->resetStatistics();
+}
+
 } // namespace OCIO_NAMESPACE
 
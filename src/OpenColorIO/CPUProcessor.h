@@ -6,8 +6,14 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Mutex.h"
 #include "Op.h"
 
 
@@ -16,6 +22,114 @@ namespace OCIO_NAMESPACE
 
 class ScanlineHelper;
 
+// Per step processing statistics of a CPU processor (refer to CPUProcessor::enableStatistics()).
+// The entries are never removed so the engines could keep raw pointers on them.
+class CPUStatistics
+{
+public:
+    struct Entry
+    {
+        Entry() = delete;
+        Entry(const Entry &) = delete;
+        Entry & operator=(const Entry &) = delete;
+
+        explicit Entry(const std::string & name) : m_name(name) {}
+
+        void add(std::chrono::steady_clock::duration duration, long numPixels) noexcept
+        {
+            m_nanoseconds += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+            m_numPixels += static_cast<uint64_t>(numPixels);
+        }
+
+        const std::string m_name;
+        std::atomic<uint64_t> m_nanoseconds{ 0 };
+        std::atomic<uint64_t> m_numPixels{ 0 };
+    };
+
+    CPUStatistics() = default;
+    CPUStatistics(const CPUStatistics &) = delete;
+    CPUStatistics & operator=(const CPUStatistics &) = delete;
+
+    ~CPUStatistics() = default;
+
+    // Note: Only one atomic load as it is checked by all the apply calls.
+    bool isEnabled() const noexcept { return m_enabled.load(std::memory_order_relaxed); }
+    void enable(bool enable) noexcept { m_enabled.store(enable, std::memory_order_relaxed); }
+
+    // Find or add the entry. Steps having the same name share the same entry.
+    Entry * getEntry(const std::string & name);
+
+    // Access the entries having processed pixels since the last reset.
+    int getNum() const;
+    CPUOpStatistics get(int index) const;
+    void reset();
+
+private:
+    std::atomic<bool> m_enabled{ false };
+
+    mutable Mutex m_mutex;
+    std::vector<std::unique_ptr<Entry>> m_entries;
+};
+
+typedef OCIO_SHARED_PTR<CPUStatistics> CPUStatisticsRcPtr;
+
+// Direct look-up of the output values from the integer input values (refer to
+// OPTIMIZATION_INTEGER_DOMAIN).
+class IntegerDomainLut
+{
+public:
+    virtual ~IntegerDomainLut() = default;
+
+    // Process the images and return true, or return false if the image layouts are not
+    // supported (e.g. channels packed in words).
+    virtual bool apply(const ImageDesc & srcImg, ImageDesc & dstImg) const = 0;
+};
+
+typedef OCIO_SHARED_PTR<const IntegerDomainLut> ConstIntegerDomainLutRcPtr;
+
+// The CPU ops processing the pixels while taking care of the input and output bit-depths.
+struct CPUEngine
+{
+    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
+    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
+                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
+    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
+
+    // All the above CPU ops could process packed RGB pixels (refer to OpCPU::applyRGB()).
+    bool m_hasApplyRGB = false;
+    // All the above CPU ops could process planar pixels (refer to OpCPU::applyPlanar()). The
+    // bit-depth ops are either casts (done while unpacking the planes) or ops processing F32.
+    bool m_hasApplyPlanar = false;
+
+    // Replaces all the above CPU ops for the image layouts it supports, if any.
+    ConstIntegerDomainLutRcPtr m_integerLut;
+
+    // The statistics entries of the above CPU ops.
+    CPUStatistics::Entry *              m_inBitDepthEntry = nullptr;
+    std::vector<CPUStatistics::Entry *> m_cpuOpEntries;
+    CPUStatistics::Entry *              m_outBitDepthEntry = nullptr;
+    CPUStatistics::Entry *              m_integerLutEntry = nullptr;
+};
+
+typedef OCIO_SHARED_PTR<const CPUEngine> ConstCPUEngineRcPtr;
+
+// Return true if the op only converts the bit-depth (i.e. no color processing) so the conversion
+// could be merged with the packing of the pixels.
+bool IsBitDepthCast(const ConstOpCPURcPtr & op) noexcept;
+
+// Replace the processing of the engine by look-ups of the integer input values when the
+// OPTIMIZATION_INTEGER_DOMAIN flag is on and the bit-depths allow it.
+void OptimizeIntegerDomain(const OpRcPtrVec & ops,
+                           BitDepth in,
+                           BitDepth out,
+                           OptimizationFlags oFlags,
+                           CPUStatistics & statistics,
+                           CPUEngine & engine);
+
+class CPUSpecialization;
+typedef OCIO_SHARED_PTR<CPUSpecialization> CPUSpecializationRcPtr;
+
 class CPUProcessor::Impl
 {
 public:
@@ -44,11 +158,29 @@ public:
     void apply(ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    // Process the images in parallel. An image is processed in place when its source and
+    // destination are the same.
+    void apply(const ImageDesc * const * srcImgDescs,
+               ImageDesc * const * dstImgDescs,
+               size_t numImages) const;
+
     // Note that the method only accepts one packed RGB and 32-bit float pixel.
     void applyRGB(float * pixel) const;
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
     void applyRGBA(float * pixel) const;
 
+    // Process in place a list of 32-bit float pixels, in parallel when there are many of them.
+    void applyRGB(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const;
+    void applyRGBA(float * pixels, size_t numPixels, ptrdiff_t pixelStrideBytes) const;
+
+    CPUEngineType getLastEngineType() const noexcept { return m_lastEngineType.load(); }
+
+    void enableStatistics(bool enable) const noexcept { m_statistics->enable(enable); }
+    bool isStatisticsEnabled() const noexcept { return m_statistics->isEnabled(); }
+    int getNumStatistics() const { return m_statistics->getNum(); }
+    CPUOpStatistics getStatistics(int index) const { return m_statistics->get(index); }
+    void resetStatistics() const { m_statistics->reset(); }
+
     ////////////////////////////////////////////
     //
     // Functions not exposed to the OCIO public API.
@@ -56,10 +188,25 @@ public:
     void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
 
 private:
-    ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
-    ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
-                                       // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
-    ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
+    // Return the engine to use for one apply call. The specialized engine, if any, is kept
+    // alive by the specialized argument for the duration of the call.
+    const CPUEngine & getEngine(ConstCPUEngineRcPtr & specialized) const;
+
+    // Process the pixels of three (RGB) or four (RGBA) channels.
+    void applyPixels(float * pixels,
+                     size_t numPixels,
+                     long numChannels,
+                     ptrdiff_t pixelStrideBytes) const;
+
+    CPUEngine          m_engine;
+
+    // Only used when the OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES flag is on and the processor
+    // has dynamic properties.
+    CPUSpecializationRcPtr m_specialization;
+    mutable std::atomic<CPUEngineType> m_lastEngineType{ CPU_ENGINE_GENERIC };
+
+    // Note: Shared with the specialized engines.
+    CPUStatisticsRcPtr m_statistics = std::make_shared<CPUStatistics>();
 
     BitDepth           m_inBitDepth = BIT_DEPTH_F32;
     BitDepth           m_outBitDepth = BIT_DEPTH_F32;
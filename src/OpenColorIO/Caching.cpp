@@ -2,9 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <sstream>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "ops/OpTools.h"
 #include "transforms/CDLTransform.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
@@ -16,6 +19,7 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_FILE_CACHE_DIR           = "OCIO_FILE_CACHE_DIR";
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -25,5 +29,60 @@ void ClearAllCaches()
 {
     ClearPathCaches();
     ClearFileTransformCaches();
+    ClearOpCompositionCaches();
+}
+
+namespace
+{
+
+void ThrowInvalidCacheType(GlobalCacheType type)
+{
+    std::ostringstream oss;
+    oss << "Invalid global cache type " << int(type) << ".";
+    throw Exception(oss.str().c_str());
 }
+
+} // anon.
+
+CacheStatistics GetCacheStatistics(GlobalCacheType type)
+{
+    switch (type)
+    {
+        case GLOBAL_CACHE_FILE_HASH:
+            return GetPathCacheStatistics();
+        case GLOBAL_CACHE_FILE:
+            return GetFileTransformCacheStatistics();
+        case GLOBAL_CACHE_OP_COMPOSITION:
+            return GetOpCompositionCacheStatistics();
+    }
+
+    ThrowInvalidCacheType(type);
+    return CacheStatistics();
+}
+
+void ClearCache(GlobalCacheType type)
+{
+    switch (type)
+    {
+        case GLOBAL_CACHE_FILE_HASH:
+            ClearPathCaches();
+            return;
+        case GLOBAL_CACHE_FILE:
+            ClearFileTransformCaches();
+            return;
+        case GLOBAL_CACHE_OP_COMPOSITION:
+            ClearOpCompositionCaches();
+            return;
+    }
+
+    ThrowInvalidCacheType(type);
+}
+
+void ThrowInvalidCacheStatisticsIndex(int index)
+{
+    std::ostringstream oss;
+    oss << "Invalid cache statistics index " << index << ".";
+    throw Exception(oss.str().c_str());
+}
+
 } // namespace OCIO_NAMESPACE
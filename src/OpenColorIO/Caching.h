@@ -6,6 +6,10 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <map>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -17,6 +21,68 @@
 namespace OCIO_NAMESPACE
 {
 
+// Throw the exception of the instance specific getCacheStatistics() methods.
+void ThrowInvalidCacheStatisticsIndex(int index);
+
+// Hit & miss counters of a cache (refer to CacheStatistics). The counters are never reset, even
+// when the cache is cleared, so they could be exported as monotonic metrics.
+class CacheCounters
+{
+public:
+    CacheCounters(const CacheCounters &) = delete;
+    CacheCounters & operator=(const CacheCounters &) = delete;
+
+    CacheCounters() = default;
+    ~CacheCounters() = default;
+
+    void addHit() noexcept { ++m_numHits; }
+
+    void addMiss(std::chrono::steady_clock::duration missTime) noexcept
+    {
+        ++m_numMisses;
+        m_missNanoseconds
+            += std::chrono::duration_cast<std::chrono::nanoseconds>(missTime).count();
+    }
+
+    // Fill the hit & miss statistics.
+    void fill(CacheStatistics & stats) const noexcept
+    {
+        stats.m_numHits   = m_numHits.load();
+        stats.m_numMisses = m_numMisses.load();
+        stats.m_missTime  = double(m_missNanoseconds.load()) * 1e-9;
+    }
+
+private:
+    std::atomic<uint64_t> m_numHits{ 0 };
+    std::atomic<uint64_t> m_numMisses{ 0 };
+    std::atomic<uint64_t> m_missNanoseconds{ 0 };
+};
+
+// Measure the time to compute a missing cache entry i.e. from the instance creation to its
+// destruction, even if the computation throws.
+class CacheMissTimer
+{
+public:
+    CacheMissTimer() = delete;
+    CacheMissTimer(const CacheMissTimer &) = delete;
+    CacheMissTimer & operator=(const CacheMissTimer &) = delete;
+
+    explicit CacheMissTimer(CacheCounters & counters) noexcept
+        :   m_counters(counters)
+        ,   m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~CacheMissTimer()
+    {
+        m_counters.addMiss(std::chrono::steady_clock::now() - m_start);
+    }
+
+private:
+    CacheCounters & m_counters;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
 // Generic cache mechanism where EntryType is the instance type to cache and KeyType is the
 // instance type of the key. Note that having efficient key generation & comparison are critical.
 // For example integer comparison is efficent but string one could be far less efficient depending
@@ -47,6 +113,19 @@ public:
         AutoMutex lock(m_mutex);
 
         m_entries.clear();
+        m_insertionOrder.clear();
+    }
+
+    // Limit the number of entries where 0 means no limit. When the cache is full, the oldest
+    // entry is evicted to make room for a new one. The limit is meant to be set before adding
+    // any entry as the entries already in the cache are removed.
+    void setMaxEntries(size_t maxEntries) noexcept
+    {
+        AutoMutex lock(m_mutex);
+
+        m_maxEntries = maxEntries;
+        m_entries.clear();
+        m_insertionOrder.clear();
     }
 
     inline void enable(bool enable) noexcept
@@ -58,6 +137,7 @@ public:
         if (!isEnabled())
         {
             m_entries.clear();
+            m_insertionOrder.clear();
         }
     }
 
@@ -73,17 +153,55 @@ public:
         return isEnabled() && m_entries.end() != m_entries.find(key);
     }
 
-    // Get a cache entry. It creates the cache entry if not existing.
+    // Get a cache entry. It creates the cache entry if not existing, possibly evicting the
+    // oldest one (refer to setMaxEntries()).
     // To only use when lock is on to protect the cache access.
     EntryType & operator[](const KeyType & key) noexcept
     {
         static EntryType dummy;
-        return isEnabled() ? m_entries[key] : dummy;
+        if (!isEnabled())
+        {
+            return dummy;
+        }
+
+        if (m_maxEntries != 0 && m_entries.find(key) == m_entries.end())
+        {
+            while (m_insertionOrder.size() >= m_maxEntries)
+            {
+                m_entries.erase(m_insertionOrder.front());
+                m_insertionOrder.pop_front();
+            }
+            m_insertionOrder.push_back(key);
+        }
+
+        return m_entries[key];
     }
 
     Iterator begin() noexcept { return m_entries.begin(); }
     Iterator end()   noexcept { return m_entries.end();   }
 
+    CacheCounters & counters() noexcept { return m_counters; }
+
+    // Return the statistics of the cache where entryBytes(key, entry) approximates the memory
+    // used by one cache entry.
+    template<typename EntryBytes>
+    CacheStatistics getStatistics(const char * name, EntryBytes entryBytes)
+    {
+        CacheStatistics stats;
+        stats.m_name = name;
+        m_counters.fill(stats);
+
+        AutoMutex lock(m_mutex);
+
+        stats.m_numEntries = m_entries.size();
+        for (const auto & entry : m_entries)
+        {
+            stats.m_approximateBytes += entryBytes(entry.first, entry.second);
+        }
+
+        return stats;
+    }
+
 protected:
     explicit GenericCache(bool disableCaches)
         :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES) || disableCaches)
@@ -96,6 +214,11 @@ protected:
 private:
     Mutex m_mutex;
     Entries m_entries;
+    CacheCounters m_counters;
+
+    size_t m_maxEntries = 0;
+    // Keys of the entries from the oldest to the newest one, only when the size is limited.
+    std::deque<KeyType> m_insertionOrder;
 };
 
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
@@ -113,6 +236,17 @@ public:
     ~ProcessorCache() = default;
 };
 
+// Approximate the memory used by a processor cache entry. The processors are shared with the
+// callers so only the cache entry itself is accounted for.
+struct ProcessorEntryBytes
+{
+    template<typename KeyType, typename ProcessorType>
+    size_t operator()(const KeyType & key, const ProcessorType & processor) const noexcept
+    {
+        return sizeof(key) + sizeof(processor);
+    }
+};
+
 
 } // namespace OCIO_NAMESPACE
 
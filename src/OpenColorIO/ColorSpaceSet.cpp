@@ -6,6 +6,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "NameIndex.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
 
@@ -31,6 +32,7 @@ public:
             {
                 m_colorSpaces.push_back(cs->createEditableCopy());
             }
+            m_index = rhs.m_index;
         }
         return *this;
     }
@@ -89,27 +91,8 @@ public:
     int getIndex(const char * csName) const 
     {
         // Search for name and aliases.
-        if (csName && *csName)
-        {
-            const std::string str = StringUtils::Lower(csName);
-            for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
-            {
-                if (StringUtils::Compare(m_colorSpaces[idx]->getName(), str))
-                {
-                    return static_cast<int>(idx);
-                }
-                const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
-                for (size_t aidx = 0; aidx < numAliases; ++aidx)
-                {
-                    if (StringUtils::Compare(m_colorSpaces[idx]->getAlias(aidx), str))
-                    {
-                        return static_cast<int>(idx);
-                    }
-                }
-            }
-        }
-
-        return -1;
+        const size_t idx = m_index.find(csName);
+        return idx == NameIndex::NotFound ? -1 : static_cast<int>(idx);
     }
 
     bool isPresent(const char * csName) const
@@ -163,11 +146,14 @@ public:
         if (replaceIdx != (size_t)-1)
         {
             // The color space replaces the existing one.
+            m_index.removeWithAliases(*m_colorSpaces[replaceIdx], replaceIdx);
             m_colorSpaces[replaceIdx] = cs->createEditableCopy();
+            m_index.addWithAliases(*m_colorSpaces[replaceIdx], replaceIdx);
             return;
         }
 
         m_colorSpaces.push_back(cs->createEditableCopy());
+        m_index.addWithAliases(*m_colorSpaces.back(), m_colorSpaces.size() - 1);
     }
 
     void add(const Impl & rhs)
@@ -188,6 +174,8 @@ public:
             if (StringUtils::Lower((*itr)->getName())==name)
             {
                 m_colorSpaces.erase(itr);
+                // The positions of the following color spaces changed.
+                m_index.rebuildWithAliases(m_colorSpaces);
                 return;
             }
         }
@@ -204,11 +192,14 @@ public:
     void clear()
     {
         m_colorSpaces.clear();
+        m_index.clear();
     }
 
 private:
     typedef std::vector<ColorSpaceRcPtr> ColorSpaceVec;
     ColorSpaceVec m_colorSpaces;
+    // Case-insensitive index of the color space names and aliases.
+    NameIndex m_index;
 };
 
 
@@ -2,11 +2,17 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <set>
 #include <sstream>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
 #include <utility>
 #include <vector>
 
@@ -21,6 +27,7 @@
 #include "LookParse.h"
 #include "MathUtils.h"
 #include "Mutex.h"
+#include "NameIndex.h"
 #include "NamedTransform.h"
 #include "OCIOYaml.h"
 #include "OpBuilders.h"
@@ -29,9 +36,12 @@
 #include "Platform.h"
 #include "PrivateTypes.h"
 #include "Processor.h"
+#include "Profiling.h"
+#include "pystring/pystring.h"
 #include "utils/StringUtils.h"
 #include "ViewingRules.h"
 #include "SystemMonitor.h"
+#include "TaskScheduler.h"
 
 
 namespace OCIO_NAMESPACE
@@ -43,6 +53,7 @@ const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
+const char * OCIO_LAZY_LOADING_ENVVAR         = "OCIO_LAZY_LOADING";
 
 // A shared view using this for the color space name will use a display color space that
 // has the same name as the display the shared view is used by.
@@ -77,6 +88,16 @@ constexpr char INTERNAL_RAW_PROFILE[] =
     "      allocation: uniform\n"
     "      description: 'A raw color space. Conversions to and from this space are no-ops.'\n";
 
+// Identify the content of a config file in the header of its precompiled version (refer to
+// Config::PrecompileFile()). The modification time is not used as its resolution could be too
+// coarse (e.g. one second) to detect a quick edit.
+std::string GetConfigSourceStamp(const std::string & content)
+{
+    std::ostringstream stamp;
+    stamp << content.size() << ":" << CacheIDHash(content.data(), static_cast<int>(content.size()));
+    return stamp.str();
+}
+
 } // anon.
 
 
@@ -277,6 +298,7 @@ public:
 
     StringMap m_roles;
     LookVec m_looksList;
+    NameIndex m_looksIndex; // Case-insensitive index of the look names.
 
     DisplayMap m_displays;
     StringUtils::StringVec m_activeDisplays;
@@ -290,6 +312,7 @@ public:
     Display m_virtualDisplay;
 
     std::vector<ViewTransformRcPtr> m_viewTransforms;
+    NameIndex m_viewTransformsIndex; // Case-insensitive index of the view transform names.
     std::string m_defaultViewTransform;
 
     mutable std::string m_activeDisplaysStr;
@@ -298,6 +321,8 @@ public:
 
     // All the named transforms(i.e. no filtering).
     std::vector<ConstNamedTransformRcPtr> m_allNamedTransforms;
+    // Case-insensitive index of the named transform names and aliases.
+    NameIndex m_allNamedTransformsIndex;
     // Active named transform names.
     StringUtils::StringVec m_activeNamedTransformNames;
     // Inactive named transform names.
@@ -318,6 +343,13 @@ public:
     ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
     mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
 
+    // When the config is lazily loaded (refer to OCIO_LAZY_LOADING_ENVVAR), the transforms of
+    // the color spaces and of the looks are only built on first access. The loaders are keyed
+    // by the element they build.
+    mutable std::map<const void *, std::function<void()>> m_deferredTransforms;
+    mutable std::atomic<bool> m_hasDeferredTransforms{ false };
+    mutable Mutex m_deferredTransformsMutex;
+
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
         m_minorVersion(LastSupportedMinorVersion[LastSupportedMajorVersion - 1]),
@@ -369,6 +401,10 @@ public:
             m_majorVersion = rhs.m_majorVersion;
             m_minorVersion = rhs.m_minorVersion;
 
+            // The copies must have all their transforms.
+            rhs.loadAllDeferredTransforms();
+            dropAllDeferredTransforms();
+
             m_env = rhs.m_env;
             m_context = rhs.m_context->createEditableCopy();
             m_name = rhs.m_name;
@@ -390,6 +426,7 @@ public:
             {
                 m_looksList.push_back(look->createEditableCopy());
             }
+            m_looksIndex = rhs.m_looksIndex;
 
             // Assignment operator will suffice for these.
             m_roles = rhs.m_roles;
@@ -400,6 +437,7 @@ public:
             {
                 m_allNamedTransforms.push_back(nt->createEditableCopy());
             }
+            m_allNamedTransformsIndex = rhs.m_allNamedTransformsIndex;
             m_activeNamedTransformNames = rhs.m_activeNamedTransformNames;
             m_inactiveNamedTransformNames = rhs.m_inactiveNamedTransformNames;
 
@@ -422,6 +460,7 @@ public:
             {
                 m_viewTransforms.push_back(vt->createEditableCopy());
             }
+            m_viewTransformsIndex = rhs.m_viewTransformsIndex;
 
             m_defaultLumaCoefs = rhs.m_defaultLumaCoefs;
             m_strictParsing = rhs.m_strictParsing;
@@ -481,26 +520,8 @@ public:
 
     size_t getNamedTransformIndex(const char * name) const noexcept
     {
-        if (name && *name)
-        {
-            const std::string str = StringUtils::Lower(name);
-            for (size_t idx = 0; idx < m_allNamedTransforms.size(); ++idx)
-            {
-                if (StringUtils::Lower(m_allNamedTransforms[idx]->getName()) == str)
-                {
-                    return idx;
-                }
-                const auto numAliases = m_allNamedTransforms[idx]->getNumAliases();
-                for (size_t alias = 0; alias < numAliases; ++alias)
-                {
-                    if (StringUtils::Lower(m_allNamedTransforms[idx]->getAlias(alias)) == str)
-                    {
-                        return idx;
-                    }
-                }
-            }
-        }
-        return static_cast<size_t>(-1);
+        // Search for name and aliases.
+        return m_allNamedTransformsIndex.find(name);
     }
 
     enum InactiveType
@@ -514,14 +535,10 @@ public:
 
     ConstViewTransformRcPtr getViewTransform(const char * name) const noexcept
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & vt : m_viewTransforms)
+        const size_t idx = m_viewTransformsIndex.find(name);
+        if (idx < m_viewTransforms.size())
         {
-            if (StringUtils::Lower(vt->getName()) == namelower)
-            {
-                return vt;
-            }
+            return m_viewTransforms[idx];
         }
 
         return ConstViewTransformRcPtr();
@@ -529,14 +546,10 @@ public:
 
     ConstLookRcPtr getLook(const char * name) const
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & look : m_looksList)
+        const size_t idx = m_looksIndex.find(name);
+        if (idx < m_looksList.size())
         {
-            if (StringUtils::Lower(look->getName()) == namelower)
-            {
-                return look;
-            }
+            return m_looksList[idx];
         }
 
         return ConstLookRcPtr();
@@ -571,7 +584,8 @@ public:
     // This currently crawls colorspaces + looks + view transforms.
     void getAllInternalTransforms(ConstTransformVec & transformVec) const;
 
-    static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
+    // Read a config from a text or a precompiled (refer to Config::PrecompileFile()) stream.
+    static ConstConfigRcPtr Read(std::istream & istream, const char * filename, bool precompiled);
 
     // Validate view object that can be a config defined shared view or a display-defined view.
     void validateView(const std::string & display, const View & view, bool checkUseDisplayName) const
@@ -766,6 +780,24 @@ public:
     void checkVersionConsistency(ConstTransformRcPtr & transform) const;
     void checkVersionConsistency() const;
 
+    // Confirm that transforms are valid and only reference existing color spaces.
+    void validateTransforms(const ConstTransformVec & transforms) const;
+
+    // Build the transforms of an element (i.e. color space or look) if the loading was
+    // deferred. Per-element validation is done at the same time.
+    void loadDeferredTransforms(const void * element) const;
+    // Build all the deferred transforms (i.e. needed by copies, serialization, etc.).
+    void loadAllDeferredTransforms() const;
+    // The element is removed from the config.
+    void dropDeferredTransforms(const void * element);
+    void dropAllDeferredTransforms();
+
+    // Record the deferred transforms of a config just read (see Config::Impl::Read()).
+    void setDeferredTransforms(const OCIOYaml::DeferredTransforms & deferred,
+                               const char * filename);
+    // Per-element checks of the transforms built on first access.
+    void checkDeferredTransforms(const ConstTransformVec & transforms) const;
+
     const View * getView(const char * display, const char * view) const
     {
         if (!view || !*view) return nullptr;
@@ -970,9 +1002,7 @@ public:
             if (iter == m_displays.end())
             {
                 const size_t curSize = m_displays.size();
-                m_displays.resize(curSize + 1);
-                m_displays[curSize].first  = colorSpaceName;
-                m_displays[curSize].second = m_virtualDisplay;
+                m_displays.add(colorSpaceName, m_virtualDisplay);
 
                 absoluteDisplayIndex = static_cast<int>(curSize);
             }
@@ -1126,12 +1156,132 @@ ConstConfigRcPtr Config::CreateFromFile(const char * filename)
         throw Exception (os.str().c_str());
     }
 
-    return Config::Impl::Read(istream, filename);
+    // Use the precompiled config if it is up to date.
+    const std::string precompiledFilename = std::string(filename) + "c";
+    std::ifstream pstream(precompiledFilename.c_str(), std::ios_base::in | std::ios_base::binary);
+    std::string sourceStamp;
+    if (pstream.good() && OCIOYaml::ReadPrecompiledHeader(pstream, sourceStamp))
+    {
+        const std::string content{ std::istreambuf_iterator<char>(istream),
+                                   std::istreambuf_iterator<char>() };
+
+        if (sourceStamp == GetConfigSourceStamp(content))
+        {
+            try
+            {
+                return Config::Impl::Read(pstream, filename, true);
+            }
+            catch (const Exception & e)
+            {
+                // A broken precompiled config must never prevent the config from loading.
+                std::ostringstream os;
+                os << "Ignoring the precompiled OCIO profile '" << precompiledFilename
+                   << "'. " << e.what();
+                LogWarning(os.str());
+            }
+        }
+
+        std::istringstream sstream(content);
+        return Config::Impl::Read(sstream, filename, false);
+    }
+
+    return Config::Impl::Read(istream, filename, false);
+}
+
+void Config::PrecompileFile(const char * filename)
+{
+    if (!filename || !*filename)
+    {
+        throw ExceptionMissingFile ("The config filepath is missing.");
+    }
+
+    std::ifstream fstream(filename);
+    if (fstream.fail())
+    {
+        std::ostringstream os;
+        os << "Error could not read '" << filename;
+        os << "' OCIO profile.";
+        throw Exception (os.str().c_str());
+    }
+
+    const std::string content{ std::istreambuf_iterator<char>(fstream),
+                               std::istreambuf_iterator<char>() };
+    const std::string sourceStamp = GetConfigSourceStamp(content);
+
+    // Only precompile valid configs.
+    std::istringstream istream(content);
+    ConstConfigRcPtr config = Config::Impl::Read(istream, filename, false);
+    config->validate();
+
+    istream.clear();
+    istream.seekg(0);
+
+    // Write a temporary file first so concurrent readers never see a partial file.
+    const std::string precompiledFilename = std::string(filename) + "c";
+    const std::string tmpFilename
+        = precompiledFilename + "."
+          + pystring::os::path::basename(Platform::CreateTempFilename(""));
+
+    {
+        std::ofstream ostream(tmpFilename.c_str(),
+                              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (ostream.fail())
+        {
+            std::ostringstream os;
+            os << "Error could not write '" << tmpFilename << "'.";
+            throw Exception (os.str().c_str());
+        }
+
+        try
+        {
+            OCIOYaml::WritePrecompiled(istream, sourceStamp, ostream);
+
+            // Check that everything reached the disk (e.g. the disk could be full) before
+            // replacing the previous precompiled config.
+            ostream.flush();
+            if (!ostream.good())
+            {
+                throw Exception("Error writing the data.");
+            }
+
+            ostream.close();
+            if (ostream.fail())
+            {
+                throw Exception("Error closing the file.");
+            }
+        }
+        catch (const std::exception & e)
+        {
+            if (ostream.is_open())
+            {
+                ostream.close();
+            }
+            std::remove(tmpFilename.c_str());
+
+            std::ostringstream os;
+            os << "Error: Precompiling the OCIO profile '" << filename << "' failed. " << e.what();
+            throw Exception (os.str().c_str());
+        }
+    }
+
+    // Note: On Windows, the rename fails if the destination exists.
+    if (std::rename(tmpFilename.c_str(), precompiledFilename.c_str()) != 0)
+    {
+        std::remove(precompiledFilename.c_str());
+        if (std::rename(tmpFilename.c_str(), precompiledFilename.c_str()) != 0)
+        {
+            std::remove(tmpFilename.c_str());
+
+            std::ostringstream os;
+            os << "Error could not write '" << precompiledFilename << "'.";
+            throw Exception (os.str().c_str());
+        }
+    }
 }
 
 ConstConfigRcPtr Config::CreateFromStream(std::istream & istream)
 {
-    return Config::Impl::Read(istream, nullptr);
+    return Config::Impl::Read(istream, nullptr, false);
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -1552,58 +1702,19 @@ void Config::validate() const
 
     // Confirm for all transforms that reference internal color spaces,
     // the named color space exists and that all transforms are valid.
+    // Note: The transforms of a lazily loaded config are validated on first access.
     {
         ConstTransformVec allTransforms;
         getImpl()->getAllInternalTransforms(allTransforms);
 
-        ConstContextRcPtr context = getCurrentContext();
-
-        std::set<std::string> colorSpaceNames;
-        for (const auto & transform : allTransforms)
+        try
         {
-            transform->validate();
-            GetColorSpaceReferences(colorSpaceNames, transform, context);
+            getImpl()->validateTransforms(allTransforms);
         }
-
-        for (const auto & name : colorSpaceNames)
+        catch (const Exception & e)
         {
-            // Check to see if the name is a color space.
-            if (!getImpl()->hasColorSpace(name.c_str()))
-            {
-                // As a role name forbids the use of context variable keywords and
-                // GetColorSpaceReferences() should expand context variables, throw if a context
-                // variable keyword is still present.
-                if (ContainsContextVariables(name.c_str()))
-                {
-                    std::ostringstream oss;
-                    oss << "Config failed sanitycheck. "
-                        << "This config references a color space '"
-                        << name << "' using an unknown context variable.";
-
-                    getImpl()->m_validationtext = oss.str();
-                    throw Exception(getImpl()->m_validationtext.c_str());
-                }
-
-                // Check to see if the name is a role.
-                const char * csname = LookupRole(getImpl()->m_roles, name);
-
-                std::ostringstream os;
-                os << "Config failed validation. ";
-                os << "This config references a color space, '";
-
-                if (!csname || !*csname)
-                {
-                    os << name << "', which is not defined.";
-                    getImpl()->m_validationtext = os.str();
-                    throw Exception(getImpl()->m_validationtext.c_str());
-                }
-                else if(!getImpl()->hasColorSpace(csname))
-                {
-                    os << csname << "' (for role '" << name << "'), which is not defined.";
-                    getImpl()->m_validationtext = os.str();
-                    throw Exception(getImpl()->m_validationtext.c_str());
-                }
-            }
+            getImpl()->m_validationtext = e.what();
+            throw;
         }
     }
 
@@ -1814,7 +1925,7 @@ void Config::validate() const
         // AddColorSpace, addNamedTransform & setRole already check there is not name
         // conflict.
 
-        if (getLook(name))
+        if (getImpl()->getLook(name))
         {
             std::ostringstream os;
             os << "Config failed validation. NamedTransform can't be named '";
@@ -2045,6 +2156,7 @@ ColorSpaceSetRcPtr Config::getColorSpaces(const char * category) const
         ConstColorSpaceRcPtr cs = getImpl()->m_allColorSpaces->getColorSpace(csName);
         if(!category || !*category || cs->hasCategory(category))
         {
+            getImpl()->loadDeferredTransforms(cs.get());
             res->addColorSpace(cs);
         }
     }
@@ -2101,7 +2213,7 @@ int Config::getNumColorSpaces(SearchReferenceSpaceType searchReferenceType,
         }
         for (auto csname : getImpl()->m_activeColorSpaceNames)
         {
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 ++res;
@@ -2118,7 +2230,7 @@ int Config::getNumColorSpaces(SearchReferenceSpaceType searchReferenceType,
         }
         for (auto csname : getImpl()->m_inactiveColorSpaceNames)
         {
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 ++res;
@@ -2187,7 +2299,7 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
         for (int i = 0; i < nbCS; ++i)
         {
             auto csname = getImpl()->m_activeColorSpaceNames[i];
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 if (current == index)
@@ -2216,7 +2328,7 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
         for (int i = 0; i < nbCS; ++i)
         {
             auto csname = getImpl()->m_inactiveColorSpaceNames[i];
-            auto cs = getColorSpace(csname.c_str());
+            auto cs = getImpl()->getColorSpace(csname.c_str());
             if (MatchReferenceType(searchReferenceType, cs->getReferenceSpaceType()))
             {
                 if (current == index)
@@ -2236,12 +2348,14 @@ const char * Config::getColorSpaceNameByIndex(SearchReferenceSpaceType searchRef
 // Note: works from the list of all color spaces.
 ConstColorSpaceRcPtr Config::getColorSpace(const char * name) const
 {
-    return getImpl()->getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
+    getImpl()->loadDeferredTransforms(cs.get());
+    return cs;
 }
 
 const char * Config::getCanonicalName(const char * name) const
 {
-    ConstColorSpaceRcPtr cs = getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
     if (cs)
     {
         return cs->getName();
@@ -2266,7 +2380,7 @@ const char * Config::getColorSpaceNameByIndex(int index) const
 
 int Config::getIndexForColorSpace(const char * name) const
 {
-    ConstColorSpaceRcPtr cs = getColorSpace(name);
+    ConstColorSpaceRcPtr cs = getImpl()->getColorSpace(name);
     if (!cs)
     {
         return -1;
@@ -2363,6 +2477,9 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
         }
     }
 
+    // The color space could replace an existing one.
+    getImpl()->dropDeferredTransforms(getImpl()->m_allColorSpaces->getColorSpace(name.c_str()).get());
+
     // This is verifying that name and aliases are fine with other color spaces.
     getImpl()->m_allColorSpaces->addColorSpace(original);
 
@@ -2373,6 +2490,7 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
 
 void Config::removeColorSpace(const char * name)
 {
+    getImpl()->dropDeferredTransforms(getImpl()->m_allColorSpaces->getColorSpace(name).get());
     getImpl()->m_allColorSpaces->removeColorSpace(name);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -2390,6 +2508,15 @@ bool Config::isColorSpaceUsed(const char * name) const noexcept
 
     // Check for all color spaces, looks and view transforms.
 
+    try
+    {
+        getImpl()->loadAllDeferredTransforms();
+    }
+    catch (const Exception &)
+    {
+        // A transform which cannot be loaded cannot use the color space.
+    }
+
     ConstTransformVec allTransforms;
     getImpl()->getAllInternalTransforms(allTransforms);
 
@@ -2496,6 +2623,11 @@ bool Config::isColorSpaceUsed(const char * name) const noexcept
 
 void Config::clearColorSpaces()
 {
+    for (int idx = 0; idx < getImpl()->m_allColorSpaces->getNumColorSpaces(); ++idx)
+    {
+        getImpl()->dropDeferredTransforms(
+            getImpl()->m_allColorSpaces->getColorSpaceByIndex(idx).get());
+    }
     getImpl()->m_allColorSpaces->clearColorSpaces();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -2560,7 +2692,7 @@ void Config::setRole(const char * role, const char * colorSpaceName)
     {
         if (!hasRole(role))
         {
-            if (getColorSpace(role))
+            if (getImpl()->getColorSpace(role))
             {
                 std::ostringstream os;
                 os << "Cannot add '" << role << "' role, there is already a color space using this "
@@ -2757,7 +2889,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
               "name.";
         throw Exception(os.str().c_str());
     }
-    auto cs = getColorSpace(name.c_str());
+    auto cs = getImpl()->getColorSpace(name.c_str());
     if (cs)
     {
         std::ostringstream os;
@@ -2806,7 +2938,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
                << "' and there is already a role with this name.";
             throw Exception(os.str().c_str());
         }
-        auto cs = getColorSpace(alias);
+        auto cs = getImpl()->getColorSpace(alias);
         if (cs)
         {
             std::ostringstream os;
@@ -2850,14 +2982,20 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
         }
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
+        getImpl()->m_allNamedTransformsIndex.removeWithAliases(
+            *getImpl()->m_allNamedTransforms[replaceIdx], replaceIdx);
         // Safe to swap, copy is not used after.
         getImpl()->m_allNamedTransforms[replaceIdx].swap(namedTransformCopy);
+        getImpl()->m_allNamedTransformsIndex.addWithAliases(
+            *getImpl()->m_allNamedTransforms[replaceIdx], replaceIdx);
     }
     else
     {
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         getImpl()->m_allNamedTransforms.push_back(namedTransformCopy);
+        getImpl()->m_allNamedTransformsIndex.addWithAliases(
+            *getImpl()->m_allNamedTransforms.back(), getImpl()->m_allNamedTransforms.size() - 1);
     }
 
     getImpl()->resetCacheIDs();
@@ -2867,6 +3005,7 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
 void Config::clearNamedTransforms()
 {
     getImpl()->m_allNamedTransforms.clear();
+    getImpl()->m_allNamedTransformsIndex.clear();
 
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
@@ -3127,10 +3266,7 @@ void Config::addDisplaySharedView(const char * display, const char * sharedView)
     DisplayMap::iterator iter = FindDisplay(getImpl()->m_displays, display);
     if (iter == getImpl()->m_displays.end())
     {
-        const auto curSize = getImpl()->m_displays.size();
-        getImpl()->m_displays.resize(curSize + 1);
-        getImpl()->m_displays[curSize].first = display;
-        iter = std::prev(getImpl()->m_displays.end());
+        iter = getImpl()->m_displays.add(display, Display());
         invalidateCache = true;
     }
 
@@ -3190,12 +3326,9 @@ void Config::addDisplayView(const char * display, const char * view, const char
     DisplayMap::iterator iter = FindDisplay(getImpl()->m_displays, display);
     if (iter == getImpl()->m_displays.end())
     {
-        const auto curSize = getImpl()->m_displays.size();
-        getImpl()->m_displays.resize(curSize + 1);
-        getImpl()->m_displays[curSize].first = display;
-        getImpl()->m_displays[curSize].second.m_views.push_back(View(view, viewTransform,
-                                                                     colorSpace, looks, rule,
-                                                                     description));
+        iter = getImpl()->m_displays.add(display, Display());
+        iter->second.m_views.push_back(View(view, viewTransform, colorSpace, looks, rule,
+                                            description));
         getImpl()->m_displayCache.clear();
     }
     else
@@ -3671,7 +3804,9 @@ void Config::setDefaultLumaCoefs(const double * c3)
 
 ConstLookRcPtr Config::getLook(const char * name) const
 {
-    return getImpl()->getLook(name);
+    ConstLookRcPtr look = getImpl()->getLook(name);
+    getImpl()->loadDeferredTransforms(look.get());
+    return look;
 }
 
 int Config::getNumLooks() const
@@ -3695,20 +3830,18 @@ void Config::addLook(const ConstLookRcPtr & look)
     if(name.empty())
         throw Exception("Cannot addLook with an empty name.");
 
-    const std::string namelower = StringUtils::Lower(name);
-
     // If the look exists, replace it
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const size_t idx = getImpl()->m_looksIndex.find(name.c_str());
+    if (idx < getImpl()->m_looksList.size())
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            getImpl()->m_looksList[i] = look->createEditableCopy();
-            return;
-        }
+        getImpl()->dropDeferredTransforms(getImpl()->m_looksList[idx].get());
+        getImpl()->m_looksList[idx] = look->createEditableCopy();
+        return;
     }
 
     // Otherwise, add it
     getImpl()->m_looksList.push_back(look->createEditableCopy());
+    getImpl()->m_looksIndex.add(name.c_str(), getImpl()->m_looksList.size() - 1);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -3716,7 +3849,12 @@ void Config::addLook(const ConstLookRcPtr & look)
 
 void Config::clearLooks()
 {
+    for (const auto & look : getImpl()->m_looksList)
+    {
+        getImpl()->dropDeferredTransforms(look.get());
+    }
     getImpl()->m_looksList.clear();
+    getImpl()->m_looksIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -3800,25 +3938,17 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
         throw Exception(os.str().c_str());
     }
 
-    const std::string namelower = StringUtils::Lower(name);
-
-    bool addIt = true;
-
     // If the view transform exists, replace it.
-    for (auto && vt : getImpl()->m_viewTransforms)
+    const size_t idx = getImpl()->m_viewTransformsIndex.find(name.c_str());
+    if (idx < getImpl()->m_viewTransforms.size())
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            vt = viewTransform->createEditableCopy();
-            addIt = false;
-            break;
-        }
+        getImpl()->m_viewTransforms[idx] = viewTransform->createEditableCopy();
     }
-
     // Otherwise, add it.
-    if (addIt)
+    else
     {
         getImpl()->m_viewTransforms.push_back(viewTransform->createEditableCopy());
+        getImpl()->m_viewTransformsIndex.add(name.c_str(), getImpl()->m_viewTransforms.size() - 1);
     }
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -3828,6 +3958,7 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 void Config::clearViewTransforms()
 {
     getImpl()->m_viewTransforms.clear();
+    getImpl()->m_viewTransformsIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -3981,17 +4112,19 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                               const ConstTransformRcPtr & transform,
                               TransformDirection direction) -> ProcessorRcPtr
     {
+        ProfilingScope profiling("Processor");
+
         ProcessorRcPtr processor = Processor::Create();
         processor->getImpl()->setProcessorCacheFlags(config.getImpl()->m_cacheFlags);
         processor->getImpl()->setTransform(config, context, transform, direction);
         processor->getImpl()->computeMetadata();
+
+        profiling.report();
         return processor;
     };
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
-
         // Note that the key includes a string description of the transform which does not include
         // all the LUT entries (just the arguments of the FileTransforms for LUTs).
         std::ostringstream oss;
@@ -4001,13 +4134,36 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
         const std::size_t key = std::hash<std::string>{}(oss.str());
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
+        {
+            AutoMutex guard(getImpl()->m_processorCache.lock());
+
+            // As the entry is a shared pointer instance, having an empty one means that the entry
+            // does not exist in the cache.
+            if (getImpl()->m_processorCache.exists(key))
+            {
+                const ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
+                if (processor)
+                {
+                    getImpl()->m_processorCache.counters().addHit();
+                    return processor;
+                }
+            }
+        }
+
+        // The processor is created without holding the cache lock so several threads could
+        // concurrently create processors (e.g. ociocheck). When two threads create the same
+        // processor, the first one added to the cache wins.
+        ProcessorRcPtr proc;
+        {
+            CacheMissTimer timer(getImpl()->m_processorCache.counters());
+            proc = CreateProcessor(*this, context, transform, direction);
+        }
+
+        AutoMutex guard(getImpl()->m_processorCache.lock());
+
         ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
         if (!processor)
         {
-            ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
-
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
             if (doFallback)
             {
@@ -4047,6 +4203,98 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
     }
 }
 
+namespace
+{
+
+// Concurrently get the processors, and call prefetch for each of them (if not empty).
+void GetProcessors(const Config & config,
+                   const ConstContextRcPtr & context,
+                   const ConstTransformRcPtr * transforms,
+                   size_t numTransforms,
+                   TransformDirection direction,
+                   const std::function<void(const ConstProcessorRcPtr &)> & prefetch,
+                   ConstProcessorRcPtr * processors)
+{
+    if (!context)
+    {
+        throw Exception("Config::getProcessors failed. Context is null.");
+    }
+
+    if (numTransforms != 0 && (!transforms || !processors))
+    {
+        throw Exception("Config::getProcessors failed. Transform or processor array is null.");
+    }
+
+    // The ops converting the color spaces to or from the reference space are typically common
+    // to several transforms (e.g. the source color space of all the views of a display).
+    SharedColorSpaceOps sharedOps;
+
+    std::vector<std::exception_ptr> errors(numTransforms);
+
+    ParallelFor(numTransforms, 1, [&](size_t begin, size_t end)
+    {
+        SharedColorSpaceOpsScope scope(sharedOps);
+
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            processors[idx].reset();
+
+            try
+            {
+                ConstProcessorRcPtr processor
+                    = config.getProcessor(context, transforms[idx], direction);
+
+                if (prefetch)
+                {
+                    prefetch(processor);
+                }
+
+                processors[idx] = processor;
+            }
+            catch (...)
+            {
+                errors[idx] = std::current_exception();
+            }
+        }
+    });
+
+    for (const auto & error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // anon.
+
+void Config::getProcessors(const ConstContextRcPtr & context,
+                           const ConstTransformRcPtr * transforms,
+                           size_t numTransforms,
+                           TransformDirection direction,
+                           ConstProcessorRcPtr * processors) const
+{
+    GetProcessors(*this, context, transforms, numTransforms, direction, nullptr, processors);
+}
+
+void Config::getProcessors(const ConstContextRcPtr & context,
+                           const ConstTransformRcPtr * transforms,
+                           size_t numTransforms,
+                           TransformDirection direction,
+                           BitDepth inBitDepth,
+                           BitDepth outBitDepth,
+                           OptimizationFlags oFlags,
+                           ConstProcessorRcPtr * processors) const
+{
+    GetProcessors(*this, context, transforms, numTransforms, direction,
+                  [inBitDepth, outBitDepth, oFlags](const ConstProcessorRcPtr & processor)
+                  {
+                      processor->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
+                  },
+                  processors);
+}
+
 ConstProcessorRcPtr Config::GetProcessorFromConfigs(const ConstConfigRcPtr & srcConfig,
                                                     const char * srcName,
                                                     const ConstConfigRcPtr & dstConfig,
@@ -4264,6 +4512,8 @@ const char * Config::getCacheID(const ConstContextRcPtr & context) const
 
 void Config::serialize(std::ostream& os) const
 {
+    getImpl()->loadAllDeferredTransforms();
+
     try
     {
         getImpl()->checkVersionConsistency();
@@ -4283,6 +4533,26 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     getImpl()->setProcessorCacheFlags(flags);
 }
 
+int Config::getNumCacheStatistics() const noexcept
+{
+    return 1;
+}
+
+CacheStatistics Config::getCacheStatistics(int index) const
+{
+    if (index != 0)
+    {
+        ThrowInvalidCacheStatisticsIndex(index);
+    }
+
+    return getImpl()->m_processorCache.getStatistics("processor", ProcessorEntryBytes());
+}
+
+void Config::clearProcessorCache() const
+{
+    getImpl()->m_processorCache.clear();
+}
+
 
 ///////////////////////////////////////////////////////////////////////////
 //  Config::Impl
@@ -4412,6 +4682,112 @@ void Config::Impl::resetCacheIDs()
     m_processorCache.clear();
 }
 
+void Config::Impl::validateTransforms(const ConstTransformVec & transforms) const
+{
+    std::set<std::string> colorSpaceNames;
+    for (const auto & transform : transforms)
+    {
+        transform->validate();
+        GetColorSpaceReferences(colorSpaceNames, transform, m_context);
+    }
+
+    for (const auto & name : colorSpaceNames)
+    {
+        // Check to see if the name is a color space.
+        if (!hasColorSpace(name.c_str()))
+        {
+            // As a role name forbids the use of context variable keywords and
+            // GetColorSpaceReferences() should expand context variables, throw if a context
+            // variable keyword is still present.
+            if (ContainsContextVariables(name.c_str()))
+            {
+                std::ostringstream oss;
+                oss << "Config failed sanitycheck. "
+                    << "This config references a color space '"
+                    << name << "' using an unknown context variable.";
+                throw Exception(oss.str().c_str());
+            }
+
+            // Check to see if the name is a role.
+            const char * csname = LookupRole(m_roles, name);
+
+            std::ostringstream os;
+            os << "Config failed validation. ";
+            os << "This config references a color space, '";
+
+            if (!csname || !*csname)
+            {
+                os << name << "', which is not defined.";
+                throw Exception(os.str().c_str());
+            }
+            else if (!hasColorSpace(csname))
+            {
+                os << csname << "' (for role '" << name << "'), which is not defined.";
+                throw Exception(os.str().c_str());
+            }
+        }
+    }
+}
+
+void Config::Impl::loadDeferredTransforms(const void * element) const
+{
+    if (!element || !m_hasDeferredTransforms)
+    {
+        return;
+    }
+
+    AutoMutex lock(m_deferredTransformsMutex);
+
+    auto it = m_deferredTransforms.find(element);
+    if (it != m_deferredTransforms.end())
+    {
+        // On failure, the loader is kept so the next access throws again.
+        it->second();
+
+        m_deferredTransforms.erase(it);
+        m_hasDeferredTransforms = !m_deferredTransforms.empty();
+    }
+}
+
+void Config::Impl::loadAllDeferredTransforms() const
+{
+    if (!m_hasDeferredTransforms)
+    {
+        return;
+    }
+
+    AutoMutex lock(m_deferredTransformsMutex);
+
+    while (!m_deferredTransforms.empty())
+    {
+        auto it = m_deferredTransforms.begin();
+        it->second();
+        m_deferredTransforms.erase(it);
+    }
+    m_hasDeferredTransforms = false;
+}
+
+void Config::Impl::dropDeferredTransforms(const void * element)
+{
+    if (!element || !m_hasDeferredTransforms)
+    {
+        return;
+    }
+
+    AutoMutex lock(m_deferredTransformsMutex);
+
+    m_deferredTransforms.erase(element);
+    m_hasDeferredTransforms = !m_deferredTransforms.empty();
+}
+
+void Config::Impl::dropAllDeferredTransforms()
+{
+    AutoMutex lock(m_deferredTransformsMutex);
+
+    m_deferredTransforms.clear();
+    m_hasDeferredTransforms = false;
+}
+
 void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
 {
     // Grab all transforms from the ColorSpaces.
@@ -4484,13 +4860,31 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
     }
 }
 
-ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
+ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename,
+                                    bool precompiled)
 {
     ConfigRcPtr config = Config::Create();
-    OCIOYaml::Read(istream, config, filename);
 
+    const bool lazyLoading = Platform::isEnvPresent(OCIO_LAZY_LOADING_ENVVAR);
+
+    OCIOYaml::DeferredTransforms deferred;
+    if (precompiled)
+    {
+        OCIOYaml::ReadPrecompiled(istream, config, filename, lazyLoading ? &deferred : nullptr);
+    }
+    else
+    {
+        OCIOYaml::Read(istream, config, filename, lazyLoading ? &deferred : nullptr);
+    }
+
+    // Note: The deferred transforms are checked on first access.
     config->getImpl()->checkVersionConsistency();
 
+    if (lazyLoading)
+    {
+        config->getImpl()->setDeferredTransforms(deferred, filename);
+    }
+
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
     // env. variable and the config contents are valid after a config file read.
@@ -4500,6 +4894,97 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filenam
     return config;
 }
 
+namespace
+{
+
+// Build the transforms of an element from a lazily loaded config.
+template<typename T>
+void LoadDeferredElement(const std::function<void(T &)> & loader,
+                         T & element,
+                         const std::string & filename)
+{
+    try
+    {
+        loader(element);
+    }
+    catch (const std::exception & e)
+    {
+        // Same error as when the whole config is loaded.
+        std::ostringstream os;
+        os << "Error: Loading the OCIO profile ";
+        if (!filename.empty()) os << "'" << filename << "' ";
+        os << "failed. " << e.what();
+        throw Exception(os.str().c_str());
+    }
+}
+
+} // anon.
+
+void Config::Impl::setDeferredTransforms(const OCIOYaml::DeferredTransforms & deferred,
+                                         const char * filename)
+{
+    const std::string fileName(filename ? filename : "");
+
+    AutoMutex lock(m_deferredTransformsMutex);
+
+    for (const auto & entry : deferred.m_colorSpaces)
+    {
+        // The config owns a copy of the color space read from the file.
+        ConstColorSpaceRcPtr cs = m_allColorSpaces->getColorSpace(entry.first.c_str());
+        if (!cs) continue;
+
+        ColorSpaceRcPtr element = std::const_pointer_cast<ColorSpace>(cs);
+        const auto loader = entry.second;
+        m_deferredTransforms[cs.get()] = [this, element, loader, fileName]()
+        {
+            LoadDeferredElement(loader, *element, fileName);
+
+            ConstTransformVec transforms;
+            for (auto dir : { COLORSPACE_DIR_TO_REFERENCE, COLORSPACE_DIR_FROM_REFERENCE })
+            {
+                ConstTransformRcPtr tr = element->getTransform(dir);
+                if (tr) transforms.push_back(tr);
+            }
+            checkDeferredTransforms(transforms);
+        };
+    }
+
+    for (const auto & entry : deferred.m_looks)
+    {
+        const size_t idx = m_looksIndex.find(entry.first.c_str());
+        if (idx >= m_looksList.size()) continue;
+
+        LookRcPtr element = m_looksList[idx];
+        const auto loader = entry.second;
+        m_deferredTransforms[element.get()] = [this, element, loader, fileName]()
+        {
+            LoadDeferredElement(loader, *element, fileName);
+
+            ConstTransformVec transforms;
+            if (element->getTransform()) transforms.push_back(element->getTransform());
+            if (element->getInverseTransform()) transforms.push_back(element->getInverseTransform());
+            checkDeferredTransforms(transforms);
+        };
+    }
+
+    m_hasDeferredTransforms = !m_deferredTransforms.empty();
+}
+
+void Config::Impl::checkDeferredTransforms(const ConstTransformVec & transforms) const
+{
+    for (auto transform : transforms)
+    {
+        checkVersionConsistency(transform);
+    }
+
+    // Only validate if the config was already validated, the next validation validates
+    // the transforms otherwise.
+    if (m_validation == VALIDATION_PASSED)
+    {
+        validateTransforms(transforms);
+    }
+}
+
 void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) const
 {
     if (transform)
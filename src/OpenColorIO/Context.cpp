@@ -9,6 +9,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
 #include "ContextVariableUtils.h"
 #include "HashUtils.h"
 #include "Mutex.h"
@@ -51,6 +52,9 @@ public:
     mutable ResolvedStringCache m_resultsFilepathCache;
     mutable Mutex m_resultsCacheMutex;
 
+    mutable CacheCounters m_resultsStringCounters;
+    mutable CacheCounters m_resultsFilepathCounters;
+
     Impl() = default;
     ~Impl() = default;
 
@@ -94,13 +98,18 @@ public:
                 }
             }
 
+            m_resultsStringCounters.addHit();
             return iter->second.first.c_str();
         }
 
         // Search some context variables to replace.
         UsedEnvs envs;
-        const std::string resolvedString = ResolveContextVariables(string, m_envMap, envs);
-        m_resultsStringCache[string] = std::make_pair(resolvedString, envs);
+        {
+            CacheMissTimer timer(m_resultsStringCounters);
+
+            const std::string resolvedString = ResolveContextVariables(string, m_envMap, envs);
+            m_resultsStringCache[string] = std::make_pair(resolvedString, envs);
+        }
 
         if (usedContextVars)
         {
@@ -121,6 +130,28 @@ public:
         m_resultsFilepathCache.clear();
         m_cacheID.clear();     
     }
+
+    // To only use when the lock is on.
+    static CacheStatistics GetStatistics(const char * name,
+                                         const ResolvedStringCache & cache,
+                                         const CacheCounters & counters)
+    {
+        CacheStatistics stats;
+        stats.m_name = name;
+        counters.fill(stats);
+
+        stats.m_numEntries = cache.size();
+        for (const auto & entry : cache)
+        {
+            stats.m_approximateBytes += entry.first.size() + entry.second.first.size();
+            for (const auto & env : entry.second.second)
+            {
+                stats.m_approximateBytes += env.first.size() + env.second.size();
+            }
+        }
+
+        return stats;
+    }
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -430,9 +461,12 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
             }
         }
 
+        getImpl()->m_resultsFilepathCounters.addHit();
         return iter->second.first.c_str();
     }
 
+    CacheMissTimer timer(getImpl()->m_resultsFilepathCounters);
+
     // If the file reference is absolute, check if the file exists (independent of the search paths).
     if(pystring::os::path::isabs(resolvedFilename))
     {
@@ -511,6 +545,39 @@ const char * Context::resolveFileLocation(const char * filename, ContextRcPtr &
     throw ExceptionMissingFile(errortext.str().c_str());
 }
 
+int Context::getNumCacheStatistics() const noexcept
+{
+    return 2;
+}
+
+CacheStatistics Context::getCacheStatistics(int index) const
+{
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
+    switch (index)
+    {
+        case 0:
+            return Impl::GetStatistics("resolved_string",
+                                       getImpl()->m_resultsStringCache,
+                                       getImpl()->m_resultsStringCounters);
+        case 1:
+            return Impl::GetStatistics("resolved_filepath",
+                                       getImpl()->m_resultsFilepathCache,
+                                       getImpl()->m_resultsFilepathCounters);
+    }
+
+    ThrowInvalidCacheStatisticsIndex(index);
+    return CacheStatistics();
+}
+
+void Context::clearCaches() const
+{
+    AutoMutex lock(getImpl()->m_resultsCacheMutex);
+
+    getImpl()->m_resultsStringCache.clear();
+    getImpl()->m_resultsFilepathCache.clear();
+}
+
 std::ostream& operator<< (std::ostream& os, const Context& context)
 {
     os << "<Context";
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <iterator>
 #include <string>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -12,22 +13,54 @@
 namespace OCIO_NAMESPACE
 {
 
+DisplayMap::iterator DisplayMap::find(const std::string & name)
+{
+    const size_t idx = m_index.find(name.c_str());
+    return idx == NameIndex::NotFound ? m_displays.end() : m_displays.begin() + idx;
+}
+
+DisplayMap::const_iterator DisplayMap::find(const std::string & name) const
+{
+    const size_t idx = m_index.find(name.c_str());
+    return idx == NameIndex::NotFound ? m_displays.end() : m_displays.begin() + idx;
+}
+
+DisplayMap::iterator DisplayMap::add(const std::string & name, const Display & display)
+{
+    m_displays.emplace_back(name, display);
+    m_index.add(name.c_str(), m_displays.size() - 1);
+    return std::prev(m_displays.end());
+}
+
+DisplayMap::iterator DisplayMap::erase(const_iterator position)
+{
+    const auto pos = position - m_displays.begin();
+    m_displays.erase(m_displays.begin() + pos);
+
+    // The positions of the following displays changed.
+    m_index.clear();
+    for (size_t idx = 0; idx < m_displays.size(); ++idx)
+    {
+        m_index.add(m_displays[idx].first.c_str(), idx);
+    }
+
+    return m_displays.begin() + pos;
+}
+
+void DisplayMap::clear() noexcept
+{
+    m_displays.clear();
+    m_index.clear();
+}
+
 DisplayMap::iterator FindDisplay(DisplayMap & displays, const std::string & name)
 {
-    return std::find_if(displays.begin(), displays.end(),
-                        [name](DisplayPair & display)
-                        {
-                            return 0 == Platform::Strcasecmp(name.c_str(), display.first.c_str());
-                        });
+    return displays.find(name);
 }
 
 DisplayMap::const_iterator FindDisplay(const DisplayMap & displays, const std::string & name)
 {
-    return std::find_if(displays.begin(), displays.end(),
-                        [name](const DisplayPair & display)
-                        {
-                            return 0 == Platform::Strcasecmp(name.c_str(), display.first.c_str());
-                        });
+    return displays.find(name);
 }
 
 ViewVec::const_iterator FindView(const ViewVec & vec, const std::string & name)
@@ -11,6 +11,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "NameIndex.h"
 #include "Platform.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
@@ -81,7 +82,47 @@ struct Display
 // to a std::vector< std::pair<> >.   We made the same change here so that the Display list 
 // can remain in config order but we left the "Map" in the name since it refers to a Yaml::Map.
 typedef std::pair<std::string, Display> DisplayPair;
-typedef std::vector<DisplayPair> DisplayMap;  // Pair is (display name : ViewVec)
+
+// The list of displays keeps the config order and a case-insensitive index of the display names.
+class DisplayMap
+{
+    typedef std::vector<DisplayPair> Type;
+
+public:
+    typedef Type::iterator iterator;
+    typedef Type::const_iterator const_iterator;
+    typedef Type::size_type size_type;
+
+    DisplayMap() = default;
+    DisplayMap(const DisplayMap &) = default;
+    DisplayMap & operator=(const DisplayMap &) = default;
+    ~DisplayMap() = default;
+
+    size_type size() const noexcept { return m_displays.size(); }
+    bool empty() const noexcept { return m_displays.empty(); }
+
+    iterator begin() noexcept { return m_displays.begin(); }
+    const_iterator begin() const noexcept { return m_displays.begin(); }
+    iterator end() noexcept { return m_displays.end(); }
+    const_iterator end() const noexcept { return m_displays.end(); }
+
+    DisplayPair & operator[](size_type idx) { return m_displays[idx]; }
+    const DisplayPair & operator[](size_type idx) const { return m_displays[idx]; }
+
+    // Case-insensitive search of a display name.
+    iterator find(const std::string & name);
+    const_iterator find(const std::string & name) const;
+
+    // Append a new display. The caller must check the display does not already exist.
+    iterator add(const std::string & name, const Display & display);
+
+    iterator erase(const_iterator position);
+    void clear() noexcept;
+
+private:
+    Type m_displays;
+    NameIndex m_index;
+};
 
 DisplayMap::iterator FindDisplay(DisplayMap & displays, const std::string & display);
 DisplayMap::const_iterator FindDisplay(const DisplayMap & displays, const std::string & display);
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_DOUBLEBUFFER_H
+#define INCLUDED_OCIO_DOUBLEBUFFER_H
+
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Holds a value which is concurrently updated by writers and used by readers (e.g. the dynamic
+// property values used by the CPU renderers while the UI thread changes them). Readers never
+// wait: they pin the published buffer for the duration of the read so a reader always sees one
+// consistent value. The writer fills the other buffer and only reuses a buffer once the readers
+// pinning it are done. Each publication increments the version.
+template<typename T>
+class DoubleBuffer
+{
+public:
+    DoubleBuffer() = delete;
+    DoubleBuffer(const DoubleBuffer &) = delete;
+    DoubleBuffer & operator=(const DoubleBuffer &) = delete;
+
+    explicit DoubleBuffer(const T & value)
+        :   m_buffers{ value, value }
+    {
+    }
+
+    ~DoubleBuffer() = default;
+
+    // Pin the published value for the lifetime of the instance.
+    class Reader
+    {
+    public:
+        Reader() = delete;
+        Reader(const Reader &) = delete;
+        Reader & operator=(const Reader &) = delete;
+
+        explicit Reader(const DoubleBuffer & buffer) noexcept
+            :   m_buffer(buffer)
+        {
+            for (;;)
+            {
+                m_index = m_buffer.m_published.load();
+                ++m_buffer.m_readers[m_index];
+
+                // The writer could have started to overwrite the buffer before the pin.
+                if (m_buffer.m_published.load() == m_index)
+                {
+                    break;
+                }
+                --m_buffer.m_readers[m_index];
+            }
+        }
+
+        ~Reader()
+        {
+            --m_buffer.m_readers[m_index];
+        }
+
+        const T & operator*() const noexcept { return m_buffer.m_buffers[m_index]; }
+        const T * operator->() const noexcept { return &m_buffer.m_buffers[m_index]; }
+
+    private:
+        const DoubleBuffer & m_buffer;
+        unsigned m_index = 0;
+    };
+
+    void publish(const T & value)
+    {
+        AutoMutex lock(m_writerMutex);
+
+        const unsigned next = 1 - m_published.load();
+
+        // Wait for the readers still using the value published before the current one.
+        while (m_readers[next].load() != 0)
+        {
+            std::this_thread::yield();
+        }
+
+        m_buffers[next] = value;
+        m_published.store(next);
+        ++m_version;
+    }
+
+    uint64_t getVersion() const noexcept { return m_version.load(); }
+
+private:
+    T m_buffers[2];
+
+    std::atomic<unsigned> m_published{ 0 };
+    mutable std::atomic<unsigned> m_readers[2]{ { 0 }, { 0 } };
+    std::atomic<uint64_t> m_version{ 0 };
+
+    Mutex m_writerMutex;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -133,8 +133,10 @@ DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyl
     , m_style(style)
     , m_direction(dir)
     , m_value(value)
+    , m_renderBuffer(RenderValues(m_value, m_preRenderValues))
 {
     m_preRenderValues.update(m_style, m_direction, m_value);
+    publish();
 }
 
 DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyle style,
@@ -147,6 +149,7 @@ DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyl
     , m_direction(dir)
     , m_value(value)
     , m_preRenderValues(comp)
+    , m_renderBuffer(RenderValues(m_value, m_preRenderValues))
 {
 }
 
@@ -164,6 +167,7 @@ void DynamicPropertyGradingPrimaryImpl::setValue(const GradingPrimary & value)
     value.validate(m_style);
     m_value = value;
     m_preRenderValues.update(m_style, m_direction, m_value);
+    publish();
 }
 
 void DynamicPropertyGradingPrimaryImpl::setStyle(GradingStyle style)
@@ -172,6 +176,7 @@ void DynamicPropertyGradingPrimaryImpl::setStyle(GradingStyle style)
     // Reset values to style defaults.
     m_value = GradingPrimary(m_style);
     m_preRenderValues.update(m_style, m_direction, m_value);
+    publish();
 }
 
 void DynamicPropertyGradingPrimaryImpl::setDirection(TransformDirection dir) noexcept
@@ -180,9 +185,15 @@ void DynamicPropertyGradingPrimaryImpl::setDirection(TransformDirection dir) noe
     {
         m_direction = dir;
         m_preRenderValues.update(m_style, m_direction, m_value);
+        publish();
     }
 }
 
+void DynamicPropertyGradingPrimaryImpl::publish()
+{
+    m_renderBuffer.publish(RenderValues(m_value, m_preRenderValues));
+}
+
 DynamicPropertyGradingRGBCurveImpl::DynamicPropertyGradingRGBCurveImpl(
     const ConstGradingRGBCurveRcPtr & value, bool dynamic)
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_RGBCURVE, dynamic)
@@ -267,12 +278,15 @@ void DynamicPropertyGradingRGBCurveImpl::precompute()
         curveImpl->computeKnotsAndCoefs(m_knotsCoefs, static_cast<int>(c));
     }
     if (m_knotsCoefs.m_knotsArray.empty()) m_knotsCoefs.m_localBypass = true;
+
+    m_renderBuffer.publish(RenderValues(m_gradingRGBCurve, m_knotsCoefs));
 }
 
 DynamicPropertyGradingRGBCurveImplRcPtr DynamicPropertyGradingRGBCurveImpl::createEditableCopy() const
 {
     auto res = std::make_shared<DynamicPropertyGradingRGBCurveImpl>(getValue(), isDynamic());
     res->m_knotsCoefs = m_knotsCoefs;
+    res->m_renderBuffer.publish(RenderValues(res->m_gradingRGBCurve, res->m_knotsCoefs));
     return res;
 }
 
@@ -282,8 +296,10 @@ DynamicPropertyGradingToneImpl::DynamicPropertyGradingToneImpl(const GradingTone
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_TONE, dynamic)
     , m_value(value)
     , m_preRenderValues(style)
+    , m_renderBuffer(RenderValues(m_value, m_preRenderValues))
 {
     m_preRenderValues.update(m_value);
+    publish();
 }
 
 DynamicPropertyGradingToneImpl::DynamicPropertyGradingToneImpl(const GradingTone & value,
@@ -292,6 +308,7 @@ DynamicPropertyGradingToneImpl::DynamicPropertyGradingToneImpl(const GradingTone
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_TONE, dynamic)
     , m_value(value)
     , m_preRenderValues(comp)
+    , m_renderBuffer(RenderValues(m_value, m_preRenderValues))
 {
 }
 
@@ -306,6 +323,7 @@ void DynamicPropertyGradingToneImpl::setValue(const GradingTone & value)
 
     m_value = value;
     m_preRenderValues.update(m_value);
+    publish();
 }
 
 void DynamicPropertyGradingToneImpl::setStyle(GradingStyle style)
@@ -314,6 +332,12 @@ void DynamicPropertyGradingToneImpl::setStyle(GradingStyle style)
     m_value = GradingTone(style);
     m_preRenderValues.setStyle(style);
     m_preRenderValues.update(m_value);
+    publish();
+}
+
+void DynamicPropertyGradingToneImpl::publish()
+{
+    m_renderBuffer.publish(RenderValues(m_value, m_preRenderValues));
 }
 
 } // namespace OCIO_NAMESPACE
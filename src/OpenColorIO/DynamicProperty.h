@@ -4,8 +4,12 @@
 #ifndef INCLUDED_OCIO_DYNAMICPROPERTY_H
 #define INCLUDED_OCIO_DYNAMICPROPERTY_H
 
+#include <atomic>
+#include <cstdint>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DoubleBuffer.h"
 #include "ops/gradingprimary/GradingPrimary.h"
 #include "ops/gradingrgbcurve/GradingBSplineCurve.h"
 #include "ops/gradingtone/GradingTone.h"
@@ -44,6 +48,9 @@ public:
         m_isDynamic = false;
     }
 
+    // Incremented each time the value changes (e.g. to detect that the value stopped changing).
+    virtual uint64_t getVersion() const noexcept = 0;
+
     // When comparing properties for equality, the following rules apply:
     // - If neither of the objects are dynamic, simply compare the values as usual.
     // - If both objects are dynamic, always return true. Even if the values are
@@ -75,13 +82,21 @@ public:
     DynamicPropertyDoubleImpl() = delete;
     DynamicPropertyDoubleImpl(DynamicPropertyType type, double val, bool dynamic);
     ~DynamicPropertyDoubleImpl() = default;
-    double getValue() const override { return m_value; }
-    void setValue(double value) override { m_value = value; }
+    // Note: The value is atomic so it could safely change while the CPU renderers use it.
+    double getValue() const override { return m_value.load(std::memory_order_relaxed); }
+    void setValue(double value) override
+    {
+        m_value.store(value, std::memory_order_relaxed);
+        ++m_version;
+    }
+
+    uint64_t getVersion() const noexcept override { return m_version.load(); }
 
     DynamicPropertyDoubleImplRcPtr createEditableCopy() const;
 
 private:
-    double m_value;
+    std::atomic<double> m_value;
+    std::atomic<uint64_t> m_version{ 0 };
 };
 
 class DynamicPropertyGradingPrimaryImpl;
@@ -125,13 +140,39 @@ public:
     // Do not apply the op if all params are identity.
     bool getLocalBypass() const { return m_preRenderValues.getLocalBypass(); }
 
+    // The values used by the CPU renderers. They are published each time the value changes.
+    // Each apply call takes a RenderBuffer::Reader snapshot before processing any pixel and
+    // holds it until the end, so all the pixels of the call use the same set of values even if
+    // another thread changes the dynamic property meanwhile, and the renderers never wait on
+    // the writer.
+    struct RenderValues
+    {
+        RenderValues(const GradingPrimary & value, const GradingPrimaryPreRender & computed)
+            :   m_value(value)
+            ,   m_preRenderValues(computed)
+        {
+        }
+
+        GradingPrimary m_value;
+        GradingPrimaryPreRender m_preRenderValues;
+    };
+    typedef DoubleBuffer<RenderValues> RenderBuffer;
+
+    const RenderBuffer & getRenderBuffer() const noexcept { return m_renderBuffer; }
+
+    uint64_t getVersion() const noexcept override { return m_renderBuffer.getVersion(); }
+
     DynamicPropertyGradingPrimaryImplRcPtr createEditableCopy() const;
 
 private:
+    void publish();
+
     GradingStyle m_style{ GRADING_LOG };
     TransformDirection m_direction{ TRANSFORM_DIR_FORWARD };
     GradingPrimary m_value;
     GradingPrimaryPreRender m_preRenderValues;
+
+    RenderBuffer m_renderBuffer;
 };
 
 
@@ -162,6 +203,26 @@ public:
     static unsigned int GetMaxKnots();
     static unsigned int GetMaxCoefs();
 
+    // The values used by the CPU renderers (refer to
+    // DynamicPropertyGradingPrimaryImpl::RenderValues).
+    struct RenderValues
+    {
+        RenderValues(const ConstGradingRGBCurveRcPtr & value,
+                     const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs)
+            :   m_value(value)
+            ,   m_knotsCoefs(knotsCoefs)
+        {
+        }
+
+        ConstGradingRGBCurveRcPtr m_value;
+        GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs;
+    };
+    typedef DoubleBuffer<RenderValues> RenderBuffer;
+
+    const RenderBuffer & getRenderBuffer() const noexcept { return m_renderBuffer; }
+
+    uint64_t getVersion() const noexcept override { return m_renderBuffer.getVersion(); }
+
     DynamicPropertyGradingRGBCurveImplRcPtr createEditableCopy() const;
 
 private:
@@ -171,6 +232,8 @@ private:
 
     // Holds curve data as knots and coefs. There are 4 curves.
     GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 4 };
+
+    RenderBuffer m_renderBuffer{ RenderValues(m_gradingRGBCurve, m_knotsCoefs) };
 };
 
 class DynamicPropertyGradingToneImpl;
@@ -196,12 +259,34 @@ public:
 
     bool getLocalBypass() const { return m_preRenderValues.m_localBypass; }
 
+    // The values used by the CPU renderers (refer to
+    // DynamicPropertyGradingPrimaryImpl::RenderValues).
+    struct RenderValues
+    {
+        RenderValues(const GradingTone & value, const GradingTonePreRender & computed)
+            :   m_value(value)
+            ,   m_preRenderValues(computed)
+        {
+        }
+
+        GradingTone m_value;
+        GradingTonePreRender m_preRenderValues;
+    };
+    typedef DoubleBuffer<RenderValues> RenderBuffer;
+
+    const RenderBuffer & getRenderBuffer() const noexcept { return m_renderBuffer; }
+
+    uint64_t getVersion() const noexcept override { return m_renderBuffer.getVersion(); }
+
     DynamicPropertyGradingToneImplRcPtr createEditableCopy() const;
 
 private:
+    void publish();
 
     GradingTone m_value;
     GradingTonePreRender m_preRenderValues;
+
+    RenderBuffer m_renderBuffer;
 };
 
 } // namespace OCIO_NAMESPACE
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstdint>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HalfConversion.h"
+
+#ifdef USE_SSE
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define OCIO_TARGET_F16C
+#else
+#include <cpuid.h>
+#define OCIO_TARGET_F16C __attribute__((target("f16c")))
+#endif
+#endif
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+static_assert(sizeof(half) == sizeof(uint16_t), "The half type must be 16 bits.");
+
+void HalfToFloatScalar(const half * in, float * out, size_t numValues)
+{
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        out[idx] = in[idx];
+    }
+}
+
+void FloatToHalfScalar(const float * in, half * out, size_t numValues)
+{
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        out[idx] = in[idx];
+    }
+}
+
+#ifdef USE_SSE
+
+bool DetectF16C() noexcept
+{
+    // F16C (bit 29), AVX (bit 28) and OSXSAVE (bit 27) of the CPUID leaf 1. The F16C
+    // instructions use the VEX encoding so the OS must also save the AVX registers.
+    const unsigned required = (1u << 29) | (1u << 28) | (1u << 27);
+
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    if ((unsigned(info[2]) & required) != required)
+    {
+        return false;
+    }
+
+    const unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & required) != required)
+    {
+        return false;
+    }
+
+    unsigned xcr0Low = 0, xcr0High = 0;
+    __asm__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    const unsigned long long xcr0 = xcr0Low;
+#endif
+
+    // The XMM and YMM states are enabled.
+    return (xcr0 & 0x6) == 0x6;
+}
+
+OCIO_TARGET_F16C
+void HalfToFloatF16C(const half * in, float * out, size_t numValues)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in + idx));
+        _mm_storeu_ps(out + idx, _mm_cvtph_ps(h));
+    }
+
+    HalfToFloatScalar(in + idx, out + idx, numValues - idx);
+}
+
+OCIO_TARGET_F16C
+void FloatToHalfF16C(const float * in, half * out, size_t numValues)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        // Note: 0 is the round to nearest even mode (i.e. _MM_FROUND_TO_NEAREST_INT).
+        const __m128i h = _mm_cvtps_ph(_mm_loadu_ps(in + idx), 0);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + idx), h);
+    }
+
+    FloatToHalfScalar(in + idx, out + idx, numValues - idx);
+}
+
+inline __m128i Select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Convert four halves (i.e. the low 16 bits of the 32-bit values) to floats. There is no
+// arithmetic on denormalized floats so the result does not depend on the DAZ and FTZ modes.
+inline __m128 HalfToFloat4(__m128i h)
+{
+    const __m128i shiftedExp = _mm_set1_epi32(0x7c00 << 13);
+
+    __m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exp = _mm_and_si128(o, shiftedExp);
+    o = _mm_add_epi32(o, _mm_set1_epi32((127 - 15) << 23));
+
+    // Inf and NaN need an additional exponent adjustment.
+    const __m128i isInfNan = _mm_cmpeq_epi32(exp, shiftedExp);
+    o = _mm_add_epi32(o, _mm_and_si128(isInfNan, _mm_set1_epi32((128 - 16) << 23)));
+
+    // Zero and denormalized halves are renormalized.
+    const __m128i isDenorm = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+    const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+    const __m128 renorm
+        = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))), magic);
+    o = Select(isDenorm, _mm_castps_si128(renorm), o);
+
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    return _mm_castsi128_ps(_mm_or_si128(o, sign));
+}
+
+// Convert four floats to halves (i.e. the low 16 bits of the 32-bit values) rounding to the
+// nearest even.
+inline __m128i FloatToHalf4(__m128 f)
+{
+    const __m128i bits = _mm_castps_si128(f);
+    const __m128i sign = _mm_and_si128(bits, _mm_set1_epi32(0x80000000));
+    const __m128i abs  = _mm_xor_si128(bits, sign);
+
+    // Inf and NaN (i.e. the NaNs are quiet NaNs), and the overflows.
+    const __m128i f32Inf = _mm_set1_epi32(255 << 23);
+    const __m128i infNan = Select(_mm_cmpgt_epi32(abs, f32Inf),
+                                  _mm_set1_epi32(0x7e00), _mm_set1_epi32(0x7c00));
+    const __m128i isInfNan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(((127 + 16) << 23) - 1));
+
+    // The denormalized halves are aligned by adding a magic value (i.e. the float addition
+    // rounds to the nearest even).
+    const __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+    const __m128 aligned = _mm_add_ps(_mm_castsi128_ps(abs), _mm_castsi128_ps(denormMagic));
+    const __m128i denorm = _mm_sub_epi32(_mm_castps_si128(aligned), denormMagic);
+    const __m128i isDenorm = _mm_cmplt_epi32(abs, _mm_set1_epi32(113 << 23));
+
+    // Normalized halves: rebias the exponent and round the mantissa to the nearest even.
+    const __m128i mantOdd = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_add_epi32(abs, _mm_set1_epi32(0xfff - (112 << 23)));
+    normal = _mm_srli_epi32(_mm_add_epi32(normal, mantOdd), 13);
+
+    const __m128i h = Select(isInfNan, infNan, Select(isDenorm, denorm, normal));
+    return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+}
+
+void HalfToFloatSSE2(const half * in, float * out, size_t numValues)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in + idx));
+        h = _mm_unpacklo_epi16(h, _mm_setzero_si128());
+        _mm_storeu_ps(out + idx, HalfToFloat4(h));
+    }
+
+    HalfToFloatScalar(in + idx, out + idx, numValues - idx);
+}
+
+void FloatToHalfSSE2(const float * in, half * out, size_t numValues)
+{
+    size_t idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        __m128i h = FloatToHalf4(_mm_loadu_ps(in + idx));
+
+        // Sign extend the 16-bit values so the signed saturation keeps all the bits.
+        h = _mm_srai_epi32(_mm_slli_epi32(h, 16), 16);
+        h = _mm_packs_epi32(h, h);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + idx), h);
+    }
+
+    FloatToHalfScalar(in + idx, out + idx, numValues - idx);
+}
+
+typedef void (*HalfToFloatFunction)(const half *, float *, size_t);
+typedef void (*FloatToHalfFunction)(const float *, half *, size_t);
+
+// Note: The detection is done on the first call (i.e. not during the static initialization).
+
+HalfToFloatFunction GetHalfToFloatFunction() noexcept
+{
+    static const HalfToFloatFunction func = HasF16C() ? HalfToFloatF16C : HalfToFloatSSE2;
+    return func;
+}
+
+FloatToHalfFunction GetFloatToHalfFunction() noexcept
+{
+    static const FloatToHalfFunction func = HasF16C() ? FloatToHalfF16C : FloatToHalfSSE2;
+    return func;
+}
+
+#endif
+
+} // anon.
+
+void ConvertHalfToFloat(const half * in, float * out, size_t numValues)
+{
+#ifdef USE_SSE
+    GetHalfToFloatFunction()(in, out, numValues);
+#else
+    HalfToFloatScalar(in, out, numValues);
+#endif
+}
+
+void ConvertFloatToHalf(const float * in, half * out, size_t numValues)
+{
+#ifdef USE_SSE
+    GetFloatToHalfFunction()(in, out, numValues);
+#else
+    FloatToHalfScalar(in, out, numValues);
+#endif
+}
+
+bool HasF16C() noexcept
+{
+#ifdef USE_SSE
+    static const bool hasF16C = DetectF16C();
+    return hasF16C;
+#else
+    return false;
+#endif
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_HALFCONVERSION_H
+#define INCLUDED_OCIO_HALFCONVERSION_H
+
+
+#include <cstddef>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "BitDepthUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Convert arrays of values between half and float. The F16C instructions are used when the CPU
+// supports them, and SSE2 otherwise. The results are the ones of the half type (i.e. round to
+// nearest even) except for the NaN payloads.
+void ConvertHalfToFloat(const half * in, float * out, size_t numValues);
+void ConvertFloatToHalf(const float * in, half * out, size_t numValues);
+
+// Return true if the CPU supports the F16C instructions.
+bool HasF16C() noexcept;
+
+} // namespace OCIO_NAMESPACE
+
+#endif
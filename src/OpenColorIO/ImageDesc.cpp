@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cstdlib>
 #include <math.h>
 #include <sstream>
@@ -20,6 +21,10 @@ std::ostream& operator<< (std::ostream& os, const ImageDesc& img)
         os << "<PackedImageDesc ";
         os << "data=" << packedImg->getData() << ", ";
         os << "chanOrder=" << packedImg->getChannelOrder() << ", ";
+        if(packedImg->getChannelPacking()!=CHANNEL_PACKING_NONE)
+        {
+            os << "chanPacking=" << packedImg->getChannelPacking() << ", ";
+        }
         os << "width=" << packedImg->getWidth() << ", ";
         os << "height=" << packedImg->getHeight() << ", ";
         os << "numChannels=" << packedImg->getNumChannels() << ", ";
@@ -94,6 +99,108 @@ void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const Cons
     {
         throw Exception("Bit-depth mismatch between the image buffer and the finalization setting.");
     }
+
+    // The channels packed in words are unpacked line by line (refer to WordPacked).
+    const PackedImageDesc * packedImg = dynamic_cast<const PackedImageDesc *>(&img);
+    m_chanPacking = packedImg ? packedImg->getChannelPacking() : CHANNEL_PACKING_NONE;
+
+    if(m_chanPacking!=CHANNEL_PACKING_NONE)
+    {
+        m_chanOrder    = packedImg->getChannelOrder();
+        m_packedLayout = PACKED_LAYOUT_NONE;
+        m_packedData   = reinterpret_cast<char *>(packedImg->getData());
+        m_isPlanar     = false;
+        return;
+    }
+
+    initPackedLayout(GetChannelSizeInBytes(bitDepth));
+    initPlanar(GetChannelSizeInBytes(bitDepth));
+}
+
+void GenericImageDesc::initPackedLayout(ptrdiff_t chanStrideBytes)
+{
+    m_packedLayout = PACKED_LAYOUT_NONE;
+    m_packedData   = nullptr;
+
+    const ptrdiff_t numChannels = m_aData ? 4 : 3;
+    if(m_xStrideBytes!=numChannels*chanStrideBytes)
+    {
+        return;
+    }
+
+    char * data = std::min(std::min(m_rData, m_gData), m_bData);
+    if(m_aData)
+    {
+        data = std::min(data, m_aData);
+    }
+
+    // Is the channel at the index within a pixel?
+    auto isAt = [data, chanStrideBytes](const char * chanData, ptrdiff_t index)
+    {
+        return chanData == data + index * chanStrideBytes;
+    };
+
+    if(numChannels==4)
+    {
+        if(isAt(m_rData, 0) && isAt(m_gData, 1) && isAt(m_bData, 2) && isAt(m_aData, 3))
+        {
+            m_packedLayout = PACKED_LAYOUT_RGBA;
+        }
+        else if(isAt(m_rData, 2) && isAt(m_gData, 1) && isAt(m_bData, 0) && isAt(m_aData, 3))
+        {
+            m_packedLayout = PACKED_LAYOUT_BGRA;
+        }
+        else if(isAt(m_rData, 3) && isAt(m_gData, 2) && isAt(m_bData, 1) && isAt(m_aData, 0))
+        {
+            m_packedLayout = PACKED_LAYOUT_ABGR;
+        }
+    }
+    else
+    {
+        if(isAt(m_rData, 0) && isAt(m_gData, 1) && isAt(m_bData, 2))
+        {
+            m_packedLayout = PACKED_LAYOUT_RGB;
+        }
+        else if(isAt(m_rData, 2) && isAt(m_gData, 1) && isAt(m_bData, 0))
+        {
+            m_packedLayout = PACKED_LAYOUT_BGR;
+        }
+    }
+
+    if(m_packedLayout!=PACKED_LAYOUT_NONE)
+    {
+        m_packedData = data;
+    }
+}
+
+void GenericImageDesc::initPlanar(ptrdiff_t chanStrideBytes)
+{
+    m_isPlanar = false;
+
+    if(m_packedLayout!=PACKED_LAYOUT_NONE || m_xStrideBytes!=chanStrideBytes)
+    {
+        return;
+    }
+
+    // The lines of the planes must not overlap as the planes are processed in place.
+    const ptrdiff_t lineBytes = m_width * chanStrideBytes;
+
+    const char * planes[4] = { m_rData, m_gData, m_bData, m_aData };
+    const size_t numPlanes = m_aData ? 4 : 3;
+    for(size_t i = 0; i<numPlanes; ++i)
+    {
+        for(size_t j = i+1; j<numPlanes; ++j)
+        {
+            const ptrdiff_t distance = planes[i] > planes[j] ? planes[i] - planes[j]
+                                                             : planes[j] - planes[i];
+            if(distance<lineBytes)
+            {
+                return;
+            }
+        }
+    }
+
+    m_isPlanar = true;
 }
 
 bool GenericImageDesc::isPackedFloatRGBA() const
@@ -125,6 +232,7 @@ struct PackedImageDesc::Impl
     void * m_aData = nullptr;
 
     ChannelOrdering m_chanOrder = CHANNEL_ORDERING_RGBA;
+    ChannelPacking m_chanPacking = CHANNEL_PACKING_NONE;
 
     BitDepth m_bitDepth = BIT_DEPTH_UNKNOWN;
 
@@ -242,8 +350,15 @@ struct PackedImageDesc::Impl
                 }
                 break;
             }
-            case BIT_DEPTH_UINT14:
             case BIT_DEPTH_UINT32:
+            {
+                if(m_chanStrideBytes!=sizeof(BitDepthInfo<BIT_DEPTH_UINT32>::Type))
+                {
+                    return false;
+                }
+                break;
+            }
+            case BIT_DEPTH_UINT14:
             case BIT_DEPTH_UNKNOWN:
             {
                 std::string err("PackedImageDesc Error: Unsupported bit-depth: ");
@@ -316,7 +431,12 @@ struct PackedImageDesc::Impl
             throw Exception("PackedImageDesc Error: Invalid y stride.");
         }
 
-        if ((std::abs(m_xStrideBytes) * m_width) > std::abs(m_yStrideBytes))
+        // Only the last pixel of a line needs to fit before the next line, so the lines of a
+        // strided image (e.g. every other pixel of an image) may interleave.
+        const ptrdiff_t pixelBytes = std::abs(m_chanStrideBytes) * (m_numChannels - 1)
+                                     + GetChannelSizeInBytes(m_bitDepth);
+        const ptrdiff_t lineBytes = std::abs(m_xStrideBytes) * (m_width - 1) + pixelBytes;
+        if (lineBytes > std::abs(m_yStrideBytes))
         {
             throw Exception("PackedImageDesc Error: The x and y strides are inconsistent.");
         }
@@ -326,6 +446,25 @@ struct PackedImageDesc::Impl
             throw Exception("PackedImageDesc Error: Unknown bit-depth of the image buffer.");
         }
     }
+
+    // Validate an image having the channels packed in words.
+    void validatePacking(ptrdiff_t lineBytes, ptrdiff_t wordBytes) const
+    {
+        if (m_data == nullptr)
+        {
+            throw Exception("PackedImageDesc Error: Invalid image buffer.");
+        }
+
+        if (m_width <= 0 || m_height <= 0 )
+        {
+            throw Exception("PackedImageDesc Error: Invalid image dimensions.");
+        }
+
+        if (std::abs(m_yStrideBytes) < lineBytes || (m_yStrideBytes % wordBytes) != 0)
+        {
+            throw Exception("PackedImageDesc Error: Invalid y stride.");
+        }
+    }
 };
 
 PackedImageDesc::PackedImageDesc(void * data,
@@ -505,6 +644,101 @@ PackedImageDesc::PackedImageDesc(void * data,
     getImpl()->validate();
 }
 
+PackedImageDesc::PackedImageDesc(void * data,
+                                 long width, long height,
+                                 ChannelOrdering chanOrder,
+                                 ChannelPacking chanPacking,
+                                 ptrdiff_t yStrideBytes)
+    :   ImageDesc()
+    ,   m_impl(new PackedImageDesc::Impl)
+{
+    getImpl()->m_data        = data;
+    getImpl()->m_width       = width;
+    getImpl()->m_height      = height;
+    getImpl()->m_chanOrder   = chanOrder;
+    getImpl()->m_chanPacking = chanPacking;
+
+    if(chanOrder==CHANNEL_ORDERING_RGBA
+        || chanOrder==CHANNEL_ORDERING_BGRA
+        || chanOrder==CHANNEL_ORDERING_ABGR)
+    {
+        getImpl()->m_numChannels = 4;
+    }
+    else if(chanOrder==CHANNEL_ORDERING_RGB
+        || chanOrder==CHANNEL_ORDERING_BGR)
+    {
+        getImpl()->m_numChannels = 3;
+    }
+    else
+    {
+        throw Exception("PackedImageDesc Error: Unknown channel ordering.");
+    }
+
+    const long numChannels = getImpl()->m_numChannels;
+
+    // Note that the channel (or x) stride is 0 when the channels (or the pixels) do not start
+    // on a byte boundary. The lines must start on a word boundary.
+    ptrdiff_t lineBytes = 0;
+    ptrdiff_t wordBytes = 1;
+
+    switch(chanPacking)
+    {
+        case CHANNEL_PACKING_10BIT_FILLED_A:
+        case CHANNEL_PACKING_10BIT_FILLED_B:
+        {
+            if(numChannels!=3)
+            {
+                throw Exception("PackedImageDesc Error: The 10-bit channel packings only "
+                                "support the RGB and BGR channel orderings.");
+            }
+
+            getImpl()->m_bitDepth        = BIT_DEPTH_UINT10;
+            getImpl()->m_chanStrideBytes = 0;
+            getImpl()->m_xStrideBytes    = sizeof(uint32_t);
+
+            lineBytes = getImpl()->m_xStrideBytes * width;
+            wordBytes = sizeof(uint32_t);
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_FILLED_A:
+        {
+            getImpl()->m_bitDepth        = BIT_DEPTH_UINT12;
+            getImpl()->m_chanStrideBytes = sizeof(uint16_t);
+            getImpl()->m_xStrideBytes    = sizeof(uint16_t) * numChannels;
+
+            lineBytes = getImpl()->m_xStrideBytes * width;
+            wordBytes = sizeof(uint16_t);
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_PACKED:
+        {
+            const ptrdiff_t pixelBits = 12 * numChannels;
+
+            getImpl()->m_bitDepth        = BIT_DEPTH_UINT12;
+            getImpl()->m_chanStrideBytes = 0;
+            getImpl()->m_xStrideBytes    = (pixelBits % 8) == 0 ? pixelBits / 8 : 0;
+
+            lineBytes = (pixelBits * width + 7) / 8;
+            break;
+        }
+        case CHANNEL_PACKING_NONE:
+        default:
+        {
+            throw Exception("PackedImageDesc Error: Invalid channel packing.");
+        }
+    }
+
+    getImpl()->m_yStrideBytes = (yStrideBytes == AutoStride) ? lineBytes : yStrideBytes;
+
+    getImpl()->initValues();
+
+    // The channels are unpacked line by line so none of the optimizations apply.
+    getImpl()->m_isRGBAPacked = false;
+    getImpl()->m_isFloat      = false;
+
+    getImpl()->validatePacking(lineBytes, wordBytes);
+}
+
 PackedImageDesc::~PackedImageDesc()
 {
     delete m_impl;
@@ -516,6 +750,11 @@ ChannelOrdering PackedImageDesc::getChannelOrder() const
     return getImpl()->m_chanOrder;
 }
 
+ChannelPacking PackedImageDesc::getChannelPacking() const
+{
+    return getImpl()->m_chanPacking;
+}
+
 BitDepth PackedImageDesc::getBitDepth() const
 {
     return getImpl()->m_bitDepth;
@@ -1,17 +1,21 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "HalfConversion.h"
 #include "ImagePacking.h"
+#include "SSE.h"
 
 
 namespace OCIO_NAMESPACE
@@ -299,13 +303,763 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
 }
 
 
+namespace
+{
+
+// Channel offsets of the packed layouts.
+template<PackedLayout layout> struct LayoutInfo;
+
+template<> struct LayoutInfo<PACKED_LAYOUT_RGBA>
+{
+    static constexpr int numChannels = 4;
+    static constexpr int r = 0, g = 1, b = 2, a = 3;
+};
+
+template<> struct LayoutInfo<PACKED_LAYOUT_BGRA>
+{
+    static constexpr int numChannels = 4;
+    static constexpr int r = 2, g = 1, b = 0, a = 3;
+};
+
+template<> struct LayoutInfo<PACKED_LAYOUT_ABGR>
+{
+    static constexpr int numChannels = 4;
+    static constexpr int r = 3, g = 2, b = 1, a = 0;
+};
+
+template<> struct LayoutInfo<PACKED_LAYOUT_RGB>
+{
+    static constexpr int numChannels = 3;
+    static constexpr int r = 0, g = 1, b = 2, a = 0;
+};
+
+template<> struct LayoutInfo<PACKED_LAYOUT_BGR>
+{
+    static constexpr int numChannels = 3;
+    static constexpr int r = 2, g = 1, b = 0, a = 0;
+};
+
+// Conversion of a channel value from the image type to F32.
+template<typename Type>
+struct ToFloat
+{
+    explicit ToFloat(float scale) : m_scale(scale) {}
+    float operator()(Type value) const { return float(value) * m_scale; }
+    const float m_scale;
+};
+
+// Conversion of a channel value from F32 to the image type. Like Converter<>::CastValue(), the
+// integer values are rounded and clamped.
+template<typename Type>
+struct FromFloat
+{
+    FromFloat(float scale, float maxValue) : m_scale(scale), m_maxValue(maxValue) {}
+    Type operator()(float value) const
+    {
+        const float v = value * m_scale + 0.5f;
+        return (Type)CLAMP(v, 0.0f, m_maxValue);
+    }
+    const float m_scale;
+    const float m_maxValue;
+};
+
+template<>
+struct FromFloat<half>
+{
+    FromFloat(float scale, float) : m_scale(scale) {}
+    half operator()(float value) const { return half(value * m_scale); }
+    const float m_scale;
+};
+
+template<>
+struct FromFloat<float>
+{
+    FromFloat(float scale, float) : m_scale(scale) {}
+    float operator()(float value) const { return value * m_scale; }
+    const float m_scale;
+};
+
+// The max value of the 32-bit integers is not exactly representable by a float.
+template<>
+struct FromFloat<uint32_t>
+{
+    FromFloat(float scale, float) : m_scale(scale) {}
+    uint32_t operator()(float value) const
+    {
+        const double v = double(value) * double(m_scale) + 0.5;
+        return (uint32_t)CLAMP(v, 0.0, double(BitDepthInfo<BIT_DEPTH_UINT32>::maxValue));
+    }
+    const float m_scale;
+};
+
+// Plain copy of a channel value.
+template<typename Type>
+struct Identity
+{
+    Type operator()(Type value) const { return value; }
+};
+
+template<PackedLayout layout, typename InType, typename OutType, typename Convert>
+void PackToRGBA(const InType * in, OutType * out, long numPixels, const Convert & convert)
+{
+    typedef LayoutInfo<layout> Info;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = convert(in[Info::r]);
+        out[1] = convert(in[Info::g]);
+        out[2] = convert(in[Info::b]);
+        out[3] = Info::numChannels == 4 ? convert(in[Info::a]) : OutType(0.0f);
+
+        in  += Info::numChannels;
+        out += 4;
+    }
+}
+
+template<PackedLayout layout, typename InType, typename OutType, typename Convert>
+void UnpackFromRGBA(const InType * in, OutType * out, long numPixels, const Convert & convert)
+{
+    typedef LayoutInfo<layout> Info;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[Info::r] = convert(in[0]);
+        out[Info::g] = convert(in[1]);
+        out[Info::b] = convert(in[2]);
+        if (Info::numChannels == 4)
+        {
+            out[Info::a] = convert(in[3]);
+        }
+
+        in  += 4;
+        out += Info::numChannels;
+    }
+}
+
+template<PackedLayout layout, typename Type>
+struct ScalarKernels
+{
+    static void Pack(const Type * in, float * out, long numPixels, float scale)
+    {
+        PackToRGBA<layout>(in, out, numPixels, ToFloat<Type>(scale));
+    }
+
+    static void Unpack(const float * in, Type * out, long numPixels, float scale, float maxValue)
+    {
+        UnpackFromRGBA<layout>(in, out, numPixels, FromFloat<Type>(scale, maxValue));
+    }
+};
+
+#ifdef USE_SSE
+
+// Reorder the channels from the packed layout to RGBA. As the shuffles are their own inverse,
+// it also reorders from RGBA to the packed layout.
+template<PackedLayout layout> inline __m128 ShuffleRGBA(__m128 v);
+
+template<> inline __m128 ShuffleRGBA<PACKED_LAYOUT_RGBA>(__m128 v)
+{
+    return v;
+}
+
+template<> inline __m128 ShuffleRGBA<PACKED_LAYOUT_BGRA>(__m128 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2));
+}
+
+template<> inline __m128 ShuffleRGBA<PACKED_LAYOUT_ABGR>(__m128 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+inline __m128 LoadPixel(const float * in)
+{
+    return _mm_loadu_ps(in);
+}
+
+inline __m128 LoadPixel(const uint8_t * in)
+{
+    int32_t value;
+    memcpy(&value, in, sizeof(value));
+
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_cvtsi32_si128(value);
+    v = _mm_unpacklo_epi8(v, zero);
+    v = _mm_unpacklo_epi16(v, zero);
+    return _mm_cvtepi32_ps(v);
+}
+
+inline __m128 LoadPixel(const uint16_t * in)
+{
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(in));
+    v = _mm_unpacklo_epi16(v, _mm_setzero_si128());
+    return _mm_cvtepi32_ps(v);
+}
+
+// Note: The integer values are already rounded and clamped.
+
+inline void StorePixel(__m128 v, float * out)
+{
+    _mm_storeu_ps(out, v);
+}
+
+inline void StorePixel(__m128 v, uint8_t * out)
+{
+    __m128i i = _mm_cvttps_epi32(v);
+    i = _mm_packs_epi32(i, i);
+    i = _mm_packus_epi16(i, i);
+
+    const int32_t value = _mm_cvtsi128_si32(i);
+    memcpy(out, &value, sizeof(value));
+}
+
+inline void StorePixel(__m128 v, uint16_t * out)
+{
+    // SSE2 only packs 32-bit integers to signed 16-bit integers so shift the range.
+    __m128i i = _mm_sub_epi32(_mm_cvttps_epi32(v), _mm_set1_epi32(32768));
+    i = _mm_packs_epi32(i, i);
+    i = _mm_xor_si128(i, _mm_set1_epi16(-32768));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out), i);
+}
+
+template<PackedLayout layout, typename Type>
+struct SSEKernels
+{
+    static void Pack(const Type * in, float * out, long numPixels, float scale)
+    {
+        const __m128 s = _mm_set1_ps(scale);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            _mm_storeu_ps(out, _mm_mul_ps(ShuffleRGBA<layout>(LoadPixel(in)), s));
+
+            in  += 4;
+            out += 4;
+        }
+    }
+
+    static void Unpack(const float * in, Type * out, long numPixels, float scale, float maxValue)
+    {
+        const bool isInteger = std::is_integral<Type>::value;
+
+        const __m128 s    = _mm_set1_ps(scale);
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 max  = _mm_set1_ps(maxValue);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            __m128 v = _mm_mul_ps(ShuffleRGBA<layout>(_mm_loadu_ps(in)), s);
+            if (isInteger)
+            {
+                v = _mm_min_ps(_mm_max_ps(_mm_add_ps(v, half), zero), max);
+            }
+            StorePixel(v, out);
+
+            in  += 4;
+            out += 4;
+        }
+    }
+};
+
+template<PackedLayout layout, typename Type>
+struct FloatKernels
+    :   std::conditional<LayoutInfo<layout>::numChannels == 4,
+                         SSEKernels<layout, Type>,
+                         ScalarKernels<layout, Type>>::type
+{
+};
+
+#else
+
+template<PackedLayout layout, typename Type>
+struct FloatKernels : ScalarKernels<layout, Type>
+{
+};
+
+#endif
+
+// The half values are converted by blocks (refer to ConvertHalfToFloat()) and then processed
+// as F32 values.
+template<PackedLayout layout>
+struct FloatKernels<layout, half>
+{
+    static constexpr long BlockSize = 64;
+    static constexpr long NumChannels = LayoutInfo<layout>::numChannels;
+
+    static void Pack(const half * in, float * out, long numPixels, float scale)
+    {
+        float block[BlockSize * NumChannels];
+
+        for (long idx = 0; idx < numPixels; idx += BlockSize)
+        {
+            const long num = std::min(long(BlockSize), numPixels - idx);
+
+            ConvertHalfToFloat(in, block, size_t(num * NumChannels));
+            FloatKernels<layout, float>::Pack(block, out, num, scale);
+
+            in  += num * NumChannels;
+            out += num * 4;
+        }
+    }
+
+    static void Unpack(const float * in, half * out, long numPixels, float scale, float maxValue)
+    {
+        float block[BlockSize * NumChannels];
+
+        for (long idx = 0; idx < numPixels; idx += BlockSize)
+        {
+            const long num = std::min(long(BlockSize), numPixels - idx);
+
+            FloatKernels<layout, float>::Unpack(in, block, num, scale, maxValue);
+            ConvertFloatToHalf(block, out, size_t(num * NumChannels));
+
+            in  += num * 4;
+            out += num * NumChannels;
+        }
+    }
+};
+
+template<PackedLayout layout>
+struct FloatKernels<layout, uint32_t> : ScalarKernels<layout, uint32_t>
+{
+};
+
+} // anon.
+
+template<typename Type>
+void Packed<Type>::ToRGBAFloat(PackedLayout layout,
+                               const Type * in,
+                               float * out,
+                               long numPixels,
+                               float scale)
+{
+    switch (layout)
+    {
+        case PACKED_LAYOUT_RGBA:
+            FloatKernels<PACKED_LAYOUT_RGBA, Type>::Pack(in, out, numPixels, scale);
+            break;
+        case PACKED_LAYOUT_BGRA:
+            FloatKernels<PACKED_LAYOUT_BGRA, Type>::Pack(in, out, numPixels, scale);
+            break;
+        case PACKED_LAYOUT_ABGR:
+            FloatKernels<PACKED_LAYOUT_ABGR, Type>::Pack(in, out, numPixels, scale);
+            break;
+        case PACKED_LAYOUT_RGB:
+            FloatKernels<PACKED_LAYOUT_RGB, Type>::Pack(in, out, numPixels, scale);
+            break;
+        case PACKED_LAYOUT_BGR:
+            FloatKernels<PACKED_LAYOUT_BGR, Type>::Pack(in, out, numPixels, scale);
+            break;
+        case PACKED_LAYOUT_NONE:
+            throw Exception("Unsupported packed layout.");
+    }
+}
+
+template<typename Type>
+void Packed<Type>::ToRGBA(PackedLayout layout, const Type * in, Type * out, long numPixels)
+{
+    switch (layout)
+    {
+        case PACKED_LAYOUT_RGBA:
+            PackToRGBA<PACKED_LAYOUT_RGBA>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_BGRA:
+            PackToRGBA<PACKED_LAYOUT_BGRA>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_ABGR:
+            PackToRGBA<PACKED_LAYOUT_ABGR>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_RGB:
+            PackToRGBA<PACKED_LAYOUT_RGB>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_BGR:
+            PackToRGBA<PACKED_LAYOUT_BGR>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_NONE:
+            throw Exception("Unsupported packed layout.");
+    }
+}
+
+template<typename Type>
+void Packed<Type>::FromRGBAFloat(PackedLayout layout,
+                                 const float * in,
+                                 Type * out,
+                                 long numPixels,
+                                 float scale,
+                                 float maxValue)
+{
+    switch (layout)
+    {
+        case PACKED_LAYOUT_RGBA:
+            FloatKernels<PACKED_LAYOUT_RGBA, Type>::Unpack(in, out, numPixels, scale, maxValue);
+            break;
+        case PACKED_LAYOUT_BGRA:
+            FloatKernels<PACKED_LAYOUT_BGRA, Type>::Unpack(in, out, numPixels, scale, maxValue);
+            break;
+        case PACKED_LAYOUT_ABGR:
+            FloatKernels<PACKED_LAYOUT_ABGR, Type>::Unpack(in, out, numPixels, scale, maxValue);
+            break;
+        case PACKED_LAYOUT_RGB:
+            FloatKernels<PACKED_LAYOUT_RGB, Type>::Unpack(in, out, numPixels, scale, maxValue);
+            break;
+        case PACKED_LAYOUT_BGR:
+            FloatKernels<PACKED_LAYOUT_BGR, Type>::Unpack(in, out, numPixels, scale, maxValue);
+            break;
+        case PACKED_LAYOUT_NONE:
+            throw Exception("Unsupported packed layout.");
+    }
+}
+
+template<typename Type>
+void Packed<Type>::FromRGBA(PackedLayout layout, const Type * in, Type * out, long numPixels)
+{
+    switch (layout)
+    {
+        case PACKED_LAYOUT_RGBA:
+            UnpackFromRGBA<PACKED_LAYOUT_RGBA>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_BGRA:
+            UnpackFromRGBA<PACKED_LAYOUT_BGRA>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_ABGR:
+            UnpackFromRGBA<PACKED_LAYOUT_ABGR>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_RGB:
+            UnpackFromRGBA<PACKED_LAYOUT_RGB>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_BGR:
+            UnpackFromRGBA<PACKED_LAYOUT_BGR>(in, out, numPixels, Identity<Type>());
+            break;
+        case PACKED_LAYOUT_NONE:
+            throw Exception("Unsupported packed layout.");
+    }
+}
+
+template<typename Type>
+void Planar<Type>::ToFloat(const Type * in, float * out, long numValues, float scale)
+{
+    const OCIO_NAMESPACE::ToFloat<Type> convert(scale);
+
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        out[idx] = convert(in[idx]);
+    }
+}
+
+template<typename Type>
+void Planar<Type>::FromFloat(const float * in, Type * out, long numValues, float scale,
+                             float maxValue)
+{
+    const OCIO_NAMESPACE::FromFloat<Type> convert(scale, maxValue);
+
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        out[idx] = convert(in[idx]);
+    }
+}
+
+template<>
+void Planar<half>::ToFloat(const half * in, float * out, long numValues, float scale)
+{
+    ConvertHalfToFloat(in, out, size_t(numValues));
+
+    if (scale != 1.0f)
+    {
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            out[idx] *= scale;
+        }
+    }
+}
+
+template<>
+void Planar<half>::FromFloat(const float * in, half * out, long numValues, float scale,
+                             float /* maxValue */)
+{
+    if (scale == 1.0f)
+    {
+        ConvertFloatToHalf(in, out, size_t(numValues));
+        return;
+    }
+
+    // The values are scaled by blocks before the conversion.
+    static constexpr long BlockSize = 256;
+    float block[BlockSize];
+
+    for (long idx = 0; idx < numValues; idx += BlockSize)
+    {
+        const long num = std::min(BlockSize, numValues - idx);
+
+        for (long i = 0; i < num; ++i)
+        {
+            block[i] = in[idx + i] * scale;
+        }
+        ConvertFloatToHalf(block, out + idx, size_t(num));
+    }
+}
+
+template<>
+void Planar<float>::ToFloat(const float * in, float * out, long numValues, float scale)
+{
+    if (scale != 1.0f)
+    {
+        for (long idx = 0; idx < numValues; ++idx)
+        {
+            out[idx] = in[idx] * scale;
+        }
+    }
+    else if (in != out)
+    {
+        memcpy(out, in, numValues * sizeof(float));
+    }
+}
+
+template<>
+void Planar<float>::FromFloat(const float * in, float * out, long numValues, float scale,
+                              float /* maxValue */)
+{
+    Planar<float>::ToFloat(in, out, numValues, scale);
+}
+
+namespace
+{
+
+// Positions of the R, G, B and A channels within a pixel for a channel ordering.
+void GetChannelPositions(ChannelOrdering order, int (&pos)[4], int & numChannels)
+{
+    switch (order)
+    {
+        case CHANNEL_ORDERING_RGBA:
+            pos[0] = 0; pos[1] = 1; pos[2] = 2; pos[3] = 3; numChannels = 4;
+            break;
+        case CHANNEL_ORDERING_BGRA:
+            pos[0] = 2; pos[1] = 1; pos[2] = 0; pos[3] = 3; numChannels = 4;
+            break;
+        case CHANNEL_ORDERING_ABGR:
+            pos[0] = 3; pos[1] = 2; pos[2] = 1; pos[3] = 0; numChannels = 4;
+            break;
+        case CHANNEL_ORDERING_RGB:
+            pos[0] = 0; pos[1] = 1; pos[2] = 2; pos[3] = 0; numChannels = 3;
+            break;
+        case CHANNEL_ORDERING_BGR:
+            pos[0] = 2; pos[1] = 1; pos[2] = 0; pos[3] = 0; numChannels = 3;
+            break;
+        default:
+            throw Exception("Unknown channel ordering.");
+    }
+}
+
+// Bit shifts of the three 10-bit channels of a 32-bit word.
+void Get10BitShifts(ChannelPacking packing, unsigned (&shifts)[3])
+{
+    if (packing == CHANNEL_PACKING_10BIT_FILLED_A)
+    {
+        shifts[0] = 22; shifts[1] = 12; shifts[2] = 2;
+    }
+    else
+    {
+        shifts[0] = 20; shifts[1] = 10; shifts[2] = 0;
+    }
+}
+
+} // anon.
+
+template<typename Type>
+void WordPacked<Type>::ToRGBA(ChannelPacking, ChannelOrdering, const void *, Type *, long)
+{
+    throw Exception("The channel packing is only supported by the 10-bit and 12-bit images.");
+}
+
+template<typename Type>
+void WordPacked<Type>::FromRGBA(ChannelPacking, ChannelOrdering, const Type *, void *, long)
+{
+    throw Exception("The channel packing is only supported by the 10-bit and 12-bit images.");
+}
+
+template<>
+void WordPacked<uint16_t>::ToRGBA(ChannelPacking packing,
+                                  ChannelOrdering order,
+                                  const void * in,
+                                  uint16_t * out,
+                                  long numPixels)
+{
+    int pos[4];
+    int numChannels = 0;
+    GetChannelPositions(order, pos, numChannels);
+
+    switch (packing)
+    {
+        case CHANNEL_PACKING_10BIT_FILLED_A:
+        case CHANNEL_PACKING_10BIT_FILLED_B:
+        {
+            unsigned shifts[3];
+            Get10BitShifts(packing, shifts);
+
+            const uint32_t * words = reinterpret_cast<const uint32_t *>(in);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                const uint32_t word = words[idx];
+                out[0] = uint16_t((word >> shifts[pos[0]]) & 0x3FF);
+                out[1] = uint16_t((word >> shifts[pos[1]]) & 0x3FF);
+                out[2] = uint16_t((word >> shifts[pos[2]]) & 0x3FF);
+                out[3] = 0;
+                out += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_FILLED_A:
+        {
+            const uint16_t * values = reinterpret_cast<const uint16_t *>(in);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                out[0] = uint16_t(values[pos[0]] >> 4);
+                out[1] = uint16_t(values[pos[1]] >> 4);
+                out[2] = uint16_t(values[pos[2]] >> 4);
+                out[3] = numChannels == 4 ? uint16_t(values[pos[3]] >> 4) : uint16_t(0);
+                values += numChannels;
+                out += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_PACKED:
+        {
+            // The 12-bit values are a stream of bits i.e. two values per three bytes.
+            const uint8_t * bytes = reinterpret_cast<const uint8_t *>(in);
+            auto value = [bytes](long index) -> uint16_t
+            {
+                const uint8_t * b = bytes + (index * 3) / 2;
+                return (index & 1) ? uint16_t(((b[0] & 0x0F) << 8) | b[1])
+                                   : uint16_t((b[0] << 4) | (b[1] >> 4));
+            };
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                const long first = idx * numChannels;
+                out[0] = value(first + pos[0]);
+                out[1] = value(first + pos[1]);
+                out[2] = value(first + pos[2]);
+                out[3] = numChannels == 4 ? value(first + pos[3]) : uint16_t(0);
+                out += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_NONE:
+        default:
+            throw Exception("Unsupported channel packing.");
+    }
+}
+
+template<>
+void WordPacked<uint16_t>::FromRGBA(ChannelPacking packing,
+                                    ChannelOrdering order,
+                                    const uint16_t * in,
+                                    void * out,
+                                    long numPixels)
+{
+    int pos[4];
+    int numChannels = 0;
+    GetChannelPositions(order, pos, numChannels);
+
+    switch (packing)
+    {
+        case CHANNEL_PACKING_10BIT_FILLED_A:
+        case CHANNEL_PACKING_10BIT_FILLED_B:
+        {
+            unsigned shifts[3];
+            Get10BitShifts(packing, shifts);
+
+            uint32_t * words = reinterpret_cast<uint32_t *>(out);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                // Note that the padding bits are set to zero.
+                words[idx] = (uint32_t(in[0] & 0x3FF) << shifts[pos[0]])
+                           | (uint32_t(in[1] & 0x3FF) << shifts[pos[1]])
+                           | (uint32_t(in[2] & 0x3FF) << shifts[pos[2]]);
+                in += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_FILLED_A:
+        {
+            uint16_t * values = reinterpret_cast<uint16_t *>(out);
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                values[pos[0]] = uint16_t(in[0] << 4);
+                values[pos[1]] = uint16_t(in[1] << 4);
+                values[pos[2]] = uint16_t(in[2] << 4);
+                if (numChannels == 4)
+                {
+                    values[pos[3]] = uint16_t(in[3] << 4);
+                }
+                values += numChannels;
+                in += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_12BIT_PACKED:
+        {
+            // Only the bits of the value are changed as two values share a byte.
+            uint8_t * bytes = reinterpret_cast<uint8_t *>(out);
+            auto setValue = [bytes](long index, uint16_t value)
+            {
+                uint8_t * b = bytes + (index * 3) / 2;
+                if (index & 1)
+                {
+                    b[0] = uint8_t((b[0] & 0xF0) | ((value >> 8) & 0x0F));
+                    b[1] = uint8_t(value & 0xFF);
+                }
+                else
+                {
+                    b[0] = uint8_t((value >> 4) & 0xFF);
+                    b[1] = uint8_t((b[1] & 0x0F) | ((value & 0x0F) << 4));
+                }
+            };
+
+            for (long idx = 0; idx < numPixels; ++idx)
+            {
+                const long first = idx * numChannels;
+                setValue(first + pos[0], in[0]);
+                setValue(first + pos[1], in[1]);
+                setValue(first + pos[2], in[2]);
+                if (numChannels == 4)
+                {
+                    setValue(first + pos[3], in[3]);
+                }
+                in += 4;
+            }
+            break;
+        }
+        case CHANNEL_PACKING_NONE:
+        default:
+            throw Exception("Unsupported channel packing.");
+    }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////
 
 
 template struct Generic<uint8_t>;
 template struct Generic<uint16_t>;
+template struct Generic<uint32_t>;
 template struct Generic<half>;
 
+template struct Packed<uint8_t>;
+template struct Packed<uint16_t>;
+template struct Packed<uint32_t>;
+template struct Packed<half>;
+template struct Packed<float>;
+
+template struct Planar<uint8_t>;
+template struct Planar<uint16_t>;
+template struct Planar<uint32_t>;
+template struct Planar<half>;
+template struct Planar<float>;
+
+template struct WordPacked<uint8_t>;
+template struct WordPacked<uint32_t>;
+template struct WordPacked<half>;
+template struct WordPacked<float>;
+
 
 } // namespace OCIO_NAMESPACE
@@ -13,6 +13,18 @@
 namespace OCIO_NAMESPACE
 {
 
+// Channel layouts of the packed image buffers i.e. the channels of a pixel, and the pixels of a
+// line, are adjacent.
+enum PackedLayout
+{
+    PACKED_LAYOUT_NONE = 0, // Not packed e.g. planar buffer or custom strides.
+    PACKED_LAYOUT_RGBA,
+    PACKED_LAYOUT_BGRA,
+    PACKED_LAYOUT_ABGR,
+    PACKED_LAYOUT_RGB,
+    PACKED_LAYOUT_BGR
+};
+
 struct GenericImageDesc
 {
     long m_width  = 0;
@@ -34,10 +46,28 @@ struct GenericImageDesc
     // Is the image buffer a 32-bit float image buffer?
     bool m_isFloat      = false;
 
+    // Channel layout of a packed image buffer and its first channel.
+    PackedLayout m_packedLayout = PACKED_LAYOUT_NONE;
+    char * m_packedData = nullptr;
+
+    // Is the image buffer made of separate channel planes (i.e. the values of a channel are
+    // adjacent in a line and the channels do not overlap)?
+    bool m_isPlanar = false;
+
+    // Packing of the channels in words (and their ordering) starting at m_packedData.
+    ChannelPacking m_chanPacking = CHANNEL_PACKING_NONE;
+    ChannelOrdering m_chanOrder = CHANNEL_ORDERING_RGBA;
+
 
     // Resolves all AutoStride.
     void init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp);
 
+    // Find the packed layout from the channel pointers and the strides.
+    void initPackedLayout(ptrdiff_t chanStrideBytes);
+
+    // Find if the channels are planes from the channel pointers and the strides.
+    void initPlanar(ptrdiff_t chanStrideBytes);
+
     // Is the image buffer a packed RGBA 32-bit float buffer?
     bool isPackedFloatRGBA() const;
     // Is the image buffer a RGBA packed buffer?
@@ -62,6 +92,81 @@ struct Generic
                                       long imagePixelStartIndex);
 };
 
+// Dedicated kernels for the packed layouts, processing a line in one pass.
+template<typename Type>
+struct Packed
+{
+    // Reorder to RGBA F32 and multiply by scale (i.e. the bit-depth conversion).
+    static void ToRGBAFloat(PackedLayout layout,
+                            const Type * in,
+                            float * out,
+                            long numPixels,
+                            float scale);
+
+    // Reorder to RGBA without any conversion.
+    static void ToRGBA(PackedLayout layout, const Type * in, Type * out, long numPixels);
+
+    // Multiply by scale, convert to the type (i.e. the integer values are rounded and clamped
+    // to maxValue) and reorder from RGBA.
+    static void FromRGBAFloat(PackedLayout layout,
+                              const float * in,
+                              Type * out,
+                              long numPixels,
+                              float scale,
+                              float maxValue);
+
+    // Reorder from RGBA without any conversion.
+    static void FromRGBA(PackedLayout layout, const Type * in, Type * out, long numPixels);
+};
+
+// Conversion kernels for the channel planes of the planar images.
+template<typename Type>
+struct Planar
+{
+    // Convert to F32 and multiply by scale (i.e. the bit-depth conversion).
+    static void ToFloat(const Type * in, float * out, long numValues, float scale);
+
+    // Multiply by scale and convert to the type (i.e. the integer values are rounded and clamped
+    // to maxValue).
+    static void FromFloat(const float * in, Type * out, long numValues, float scale,
+                          float maxValue);
+};
+
+// Conversion kernels for the images having the channels packed in words (refer to
+// ChannelPacking). Only the 10-bit and 12-bit integer bit-depths (i.e. uint16_t) support the
+// channel packings.
+template<typename Type>
+struct WordPacked
+{
+    // Unpack the channels of a line to RGBA without any conversion.
+    static void ToRGBA(ChannelPacking packing,
+                       ChannelOrdering order,
+                       const void * in,
+                       Type * out,
+                       long numPixels);
+
+    // Pack the RGBA values to the channels of a line (i.e. the padding bits are set to zero).
+    static void FromRGBA(ChannelPacking packing,
+                         ChannelOrdering order,
+                         const Type * in,
+                         void * out,
+                         long numPixels);
+};
+
+template<>
+void WordPacked<uint16_t>::ToRGBA(ChannelPacking packing,
+                                  ChannelOrdering order,
+                                  const void * in,
+                                  uint16_t * out,
+                                  long numPixels);
+
+template<>
+void WordPacked<uint16_t>::FromRGBA(ChannelPacking packing,
+                                    ChannelOrdering order,
+                                    const uint16_t * in,
+                                    void * out,
+                                    long numPixels);
+
 } // namespace OCIO_NAMESPACE
 
 #endif
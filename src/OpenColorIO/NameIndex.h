@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_NAMEINDEX_H
+#define INCLUDED_OCIO_NAMEINDEX_H
+
+
+#include <string>
+#include <unordered_map>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Case-insensitive index of named elements (i.e. color spaces, looks, etc.) providing constant
+// time lookups by name or alias. The index stores the position of each element in the list
+// owning the elements so the owner is responsible to keep both in sync.
+class NameIndex
+{
+public:
+    static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+    NameIndex() = default;
+    NameIndex(const NameIndex &) = default;
+    NameIndex & operator=(const NameIndex &) = default;
+    ~NameIndex() = default;
+
+    // Add a name (or an alias) of the element at position idx. An existing entry is preserved
+    // i.e. the first element added with a given name wins like with a linear search.
+    void add(const char * name, size_t idx)
+    {
+        if (name && *name)
+        {
+            m_index.emplace(StringUtils::Lower(name), idx);
+        }
+    }
+
+    // Remove a name (or an alias) only if it refers to the element at position idx.
+    void remove(const char * name, size_t idx)
+    {
+        if (name && *name)
+        {
+            auto it = m_index.find(StringUtils::Lower(name));
+            if (it != m_index.end() && it->second == idx)
+            {
+                m_index.erase(it);
+            }
+        }
+    }
+
+    // Return the position of the element or NotFound.
+    size_t find(const char * name) const
+    {
+        if (name && *name)
+        {
+            auto it = m_index.find(StringUtils::Lower(name));
+            if (it != m_index.end())
+            {
+                return it->second;
+            }
+        }
+        return NotFound;
+    }
+
+    void clear() noexcept { m_index.clear(); }
+
+    // Rebuild the index from a list of named elements (i.e. needed when elements are removed
+    // from the list as the positions change).
+    template<typename ElementVec>
+    void rebuild(const ElementVec & elements)
+    {
+        m_index.clear();
+        for (size_t idx = 0; idx < elements.size(); ++idx)
+        {
+            add(elements[idx]->getName(), idx);
+        }
+    }
+
+    // Same as above but also indexes the aliases.
+    template<typename ElementVec>
+    void rebuildWithAliases(const ElementVec & elements)
+    {
+        m_index.clear();
+        for (size_t idx = 0; idx < elements.size(); ++idx)
+        {
+            addWithAliases(*elements[idx], idx);
+        }
+    }
+
+    template<typename Element>
+    void addWithAliases(const Element & element, size_t idx)
+    {
+        add(element.getName(), idx);
+        const size_t numAliases = element.getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            add(element.getAlias(aidx), idx);
+        }
+    }
+
+    template<typename Element>
+    void removeWithAliases(const Element & element, size_t idx)
+    {
+        remove(element.getName(), idx);
+        const size_t numAliases = element.getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            remove(element.getAlias(aidx), idx);
+        }
+    }
+
+private:
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <unordered_set>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -3139,7 +3141,38 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t, unsigned int majorVersion)
 
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion)
+// Build a transform of an element (i.e. color space or look) or, when the config is lazily
+// loaded, only record how to build it when the element is used for the first time.
+template<typename T, typename Setter>
+void loadTransform(const YAML::Node & node,
+                   T & element,
+                   std::function<void(T &)> * deferred,
+                   Setter setter)
+{
+    if (deferred)
+    {
+        const std::function<void(T &)> previous = *deferred;
+        *deferred = [previous, node, setter](T & elt)
+        {
+            if (previous)
+            {
+                previous(elt);
+            }
+            TransformRcPtr val;
+            load(node, val);
+            setter(elt, val);
+        };
+    }
+    else
+    {
+        TransformRcPtr val;
+        load(node, val);
+        setter(element, val);
+    }
+}
+
+inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion,
+                 std::function<void(ColorSpace &)> * deferred)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -3236,9 +3269,11 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_reference' or 'to_scene_reference' cannot be used for a "
                                  "display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(iter->second, *cs, deferred,
+                          [](ColorSpace & elt, const TransformRcPtr & val)
+                          {
+                              elt.setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+                          });
         }
         else if (key == "to_display_reference")
         {
@@ -3247,9 +3282,11 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadTransform(iter->second, *cs, deferred,
+                          [](ColorSpace & elt, const TransformRcPtr & val)
+                          {
+                              elt.setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+                          });
         }
         else if(key == "from_reference" || (majorVersion >= 2 && key == "from_scene_reference"))
         {
@@ -3258,9 +3295,11 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_reference' or 'from_scene_reference' cannot be used for "
                                  "a display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(iter->second, *cs, deferred,
+                          [](ColorSpace & elt, const TransformRcPtr & val)
+                          {
+                              elt.setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+                          });
         }
         else if (key == "from_display_reference")
         {
@@ -3269,9 +3308,11 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadTransform(iter->second, *cs, deferred,
+                          [](ColorSpace & elt, const TransformRcPtr & val)
+                          {
+                              elt.setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+                          });
         }
         else
         {
@@ -3357,7 +3398,8 @@ inline void save(YAML::Emitter& out, ConstColorSpaceRcPtr cs, unsigned int major
 
 // Look
 
-inline void load(const YAML::Node& node, LookRcPtr& look)
+inline void load(const YAML::Node& node, LookRcPtr& look,
+                 std::function<void(Look &)> * deferred)
 {
     if(node.Tag() != "Look")
         return;
@@ -3384,15 +3426,19 @@ inline void load(const YAML::Node& node, LookRcPtr& look)
         }
         else if(key == "transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            look->setTransform(val);
+            loadTransform(iter->second, *look, deferred,
+                          [](Look & elt, const TransformRcPtr & val)
+                          {
+                              elt.setTransform(val);
+                          });
         }
         else if(key == "inverse_transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            look->setInverseTransform(val);
+            loadTransform(iter->second, *look, deferred,
+                          [](Look & elt, const TransformRcPtr & val)
+                          {
+                              elt.setInverseTransform(val);
+                          });
         }
         else if(key == "description")
         {
@@ -4096,7 +4142,8 @@ inline void save(YAML::Emitter & out, ConstViewingRulesRcPtr & vr, size_t positi
 
 // Config
 
-inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename)
+inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename,
+                 OCIOYaml::DeferredTransforms * deferred)
 {
 
     // check profile version
@@ -4483,17 +4530,23 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs, config->getMajorVersion());
-                    for(int ii = 0; ii < config->getNumColorSpaces(); ++ii)
+                    std::function<void(ColorSpace &)> loader;
+                    load(val, cs, config->getMajorVersion(), deferred ? &loader : nullptr);
+
+                    // The lookup is case insensitive and includes the aliases & roles so the
+                    // name must still be compared.
+                    ConstColorSpaceRcPtr existing = config->getColorSpace(cs->getName());
+                    if (existing && strcmp(existing->getName(), cs->getName()) == 0)
                     {
-                        if(strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
-                        {
-                            std::ostringstream os;
-                            os << "Colorspace with name '" << cs->getName() << "' already defined.";
-                            throwError(iter->second, os.str());
-                        }
+                        std::ostringstream os;
+                        os << "Colorspace with name '" << cs->getName() << "' already defined.";
+                        throwError(iter->second, os.str());
                     }
                     config->addColorSpace(cs);
+                    if (loader)
+                    {
+                        deferred->m_colorSpaces.emplace_back(cs->getName(), loader);
+                    }
                 }
                 else
                 {
@@ -4519,17 +4572,23 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs, config->getMajorVersion());
-                    for (int ii = 0; ii < config->getNumColorSpaces(); ++ii)
+                    std::function<void(ColorSpace &)> loader;
+                    load(val, cs, config->getMajorVersion(), deferred ? &loader : nullptr);
+
+                    // The lookup is case insensitive and includes the aliases & roles so the
+                    // name must still be compared.
+                    ConstColorSpaceRcPtr existing = config->getColorSpace(cs->getName());
+                    if (existing && strcmp(existing->getName(), cs->getName()) == 0)
                     {
-                        if (strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
-                        {
-                            std::ostringstream os;
-                            os << "Colorspace with name '" << cs->getName() << "' already defined.";
-                            throwError(iter->second, os.str());
-                        }
+                        std::ostringstream os;
+                        os << "Colorspace with name '" << cs->getName() << "' already defined.";
+                        throwError(iter->second, os.str());
                     }
                     config->addColorSpace(cs);
+                    if (loader)
+                    {
+                        deferred->m_colorSpaces.emplace_back(cs->getName(), loader);
+                    }
                 }
                 else
                 {
@@ -4555,8 +4614,13 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "Look")
                 {
                     LookRcPtr look = Look::Create();
-                    load(val, look);
+                    std::function<void(Look &)> loader;
+                    load(val, look, deferred ? &loader : nullptr);
                     config->addLook(look);
+                    if (loader)
+                    {
+                        deferred->m_looks.emplace_back(look->getName(), loader);
+                    }
                 }
                 else
                 {
@@ -5097,12 +5161,13 @@ inline void save(YAML::Emitter & out, const Config & config)
 
 ///////////////////////////////////////////////////////////////////////////
 
-void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename)
+void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * filename,
+                    DeferredTransforms * deferred)
 {
     try
     {
         YAML::Node node = YAML::Load(istream);
-        load(node, config, filename);
+        load(node, config, filename, deferred);
     }
     catch(const std::exception & e)
     {
@@ -5123,4 +5188,247 @@ void OCIOYaml::Write(std::ostream & ostream, const Config & config)
     ostream << out.c_str();
 }
 
+///////////////////////////////////////////////////////////////////////////
+// Precompiled config
+
+namespace
+{
+
+// The precompiled config holds the YAML tree of the config file so the reading only skips the
+// text parsing. The format is only valid for the library version which wrote it.
+
+constexpr char PrecompiledMagic[] = { 'O', 'C', 'I', 'O', 'C', '\0' };
+constexpr uint32_t PrecompiledFormatVersion = 1;
+
+enum PrecompiledNodeType : uint8_t
+{
+    PRECOMPILED_NODE_NULL = 0,
+    PRECOMPILED_NODE_SCALAR,
+    PRECOMPILED_NODE_SEQUENCE,
+    PRECOMPILED_NODE_MAP
+};
+
+void WriteUInt(std::ostream & ostream, uint32_t value)
+{
+    ostream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void WriteString(std::ostream & ostream, const std::string & str)
+{
+    WriteUInt(ostream, static_cast<uint32_t>(str.size()));
+    ostream.write(str.data(), str.size());
+}
+
+void WriteNode(std::ostream & ostream, const YAML::Node & node)
+{
+    uint8_t type = PRECOMPILED_NODE_NULL;
+    switch (node.Type())
+    {
+        case YAML::NodeType::Scalar:   type = PRECOMPILED_NODE_SCALAR;   break;
+        case YAML::NodeType::Sequence: type = PRECOMPILED_NODE_SEQUENCE; break;
+        case YAML::NodeType::Map:      type = PRECOMPILED_NODE_MAP;      break;
+        case YAML::NodeType::Null:
+        case YAML::NodeType::Undefined:
+        default:                       type = PRECOMPILED_NODE_NULL;     break;
+    }
+
+    ostream.put(static_cast<char>(type));
+    WriteString(ostream, node.Tag());
+
+    switch (type)
+    {
+        case PRECOMPILED_NODE_SCALAR:
+        {
+            WriteString(ostream, node.Scalar());
+            break;
+        }
+        case PRECOMPILED_NODE_SEQUENCE:
+        {
+            WriteUInt(ostream, static_cast<uint32_t>(node.size()));
+            for (const auto & child : node)
+            {
+                WriteNode(ostream, child);
+            }
+            break;
+        }
+        case PRECOMPILED_NODE_MAP:
+        {
+            WriteUInt(ostream, static_cast<uint32_t>(node.size()));
+            for (const auto & child : node)
+            {
+                WriteNode(ostream, child.first);
+                WriteNode(ostream, child.second);
+            }
+            break;
+        }
+    }
+}
+
+// Read the precompiled data from a memory buffer.
+class PrecompiledReader
+{
+public:
+    PrecompiledReader() = delete;
+    explicit PrecompiledReader(const std::string & buffer)
+        :   m_data(buffer.data())
+        ,   m_end(buffer.data() + buffer.size())
+    {
+    }
+
+    uint8_t readByte()
+    {
+        check(1);
+        return static_cast<uint8_t>(*m_data++);
+    }
+
+    uint32_t readUInt()
+    {
+        check(sizeof(uint32_t));
+        uint32_t value = 0;
+        memcpy(&value, m_data, sizeof(uint32_t));
+        m_data += sizeof(uint32_t);
+        return value;
+    }
+
+    std::string readString()
+    {
+        const uint32_t size = readUInt();
+        check(size);
+        std::string str(m_data, size);
+        m_data += size;
+        return str;
+    }
+
+    YAML::Node readNode()
+    {
+        const uint8_t type = readByte();
+        const std::string tag = readString();
+
+        YAML::Node node;
+        switch (type)
+        {
+            case PRECOMPILED_NODE_NULL:
+            {
+                node = YAML::Node(YAML::NodeType::Null);
+                break;
+            }
+            case PRECOMPILED_NODE_SCALAR:
+            {
+                node = YAML::Node(readString());
+                break;
+            }
+            case PRECOMPILED_NODE_SEQUENCE:
+            {
+                node = YAML::Node(YAML::NodeType::Sequence);
+                const uint32_t size = readUInt();
+                for (uint32_t idx = 0; idx < size; ++idx)
+                {
+                    node.push_back(readNode());
+                }
+                break;
+            }
+            case PRECOMPILED_NODE_MAP:
+            {
+                node = YAML::Node(YAML::NodeType::Map);
+                const uint32_t size = readUInt();
+                for (uint32_t idx = 0; idx < size; ++idx)
+                {
+                    const YAML::Node key = readNode();
+                    const YAML::Node value = readNode();
+                    // Keep the duplicated keys (if any) like the text parsing.
+                    node.force_insert(key, value);
+                }
+                break;
+            }
+            default:
+            {
+                throw Exception("Corrupted precompiled config.");
+            }
+        }
+
+        if (!tag.empty())
+        {
+            node.SetTag(tag);
+        }
+
+        return node;
+    }
+
+private:
+    void check(size_t size) const
+    {
+        if (size > static_cast<size_t>(m_end - m_data))
+        {
+            throw Exception("Corrupted precompiled config.");
+        }
+    }
+
+    const char * m_data;
+    const char * m_end;
+};
+
+} // anon.
+
+bool OCIOYaml::ReadPrecompiledHeader(std::istream & istream, std::string & sourceStamp)
+{
+    char magic[sizeof(PrecompiledMagic)];
+    uint32_t formatVersion = 0;
+    uint32_t libraryVersion = 0;
+    uint32_t stampSize = 0;
+
+    istream.read(magic, sizeof(magic));
+    istream.read(reinterpret_cast<char *>(&formatVersion), sizeof(formatVersion));
+    istream.read(reinterpret_cast<char *>(&libraryVersion), sizeof(libraryVersion));
+    istream.read(reinterpret_cast<char *>(&stampSize), sizeof(stampSize));
+
+    if (!istream
+        || memcmp(magic, PrecompiledMagic, sizeof(magic)) != 0
+        || formatVersion != PrecompiledFormatVersion
+        || libraryVersion != static_cast<uint32_t>(GetVersionHex())
+        || stampSize > 1024)
+    {
+        return false;
+    }
+
+    sourceStamp.resize(stampSize);
+    istream.read(&sourceStamp[0], stampSize);
+
+    return !istream.fail();
+}
+
+void OCIOYaml::ReadPrecompiled(std::istream & istream, ConfigRcPtr & config, const char * filename,
+                               DeferredTransforms * deferred)
+{
+    try
+    {
+        const std::string buffer{ std::istreambuf_iterator<char>(istream),
+                                  std::istreambuf_iterator<char>() };
+
+        PrecompiledReader reader(buffer);
+        const YAML::Node node = reader.readNode();
+        load(node, config, filename, deferred);
+    }
+    catch(const std::exception & e)
+    {
+        std::ostringstream os;
+        os << "Error: Loading the precompiled OCIO profile ";
+        if(filename) os << "'" << filename << "' ";
+        os << "failed. " << e.what();
+        throw Exception(os.str().c_str());
+    }
+}
+
+void OCIOYaml::WritePrecompiled(std::istream & istream, const std::string & sourceStamp,
+                                std::ostream & ostream)
+{
+    const YAML::Node node = YAML::Load(istream);
+
+    ostream.write(PrecompiledMagic, sizeof(PrecompiledMagic));
+    WriteUInt(ostream, PrecompiledFormatVersion);
+    WriteUInt(ostream, static_cast<uint32_t>(GetVersionHex()));
+    WriteString(ostream, sourceStamp);
+
+    WriteNode(ostream, node);
+}
+
 } // namespace OCIO_NAMESPACE
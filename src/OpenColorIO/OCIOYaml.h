@@ -1,6 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #ifndef INCLUDED_OCIO_YAML_H
@@ -12,9 +17,36 @@ namespace OCIO_NAMESPACE
 namespace OCIOYaml
 {
 
-void Read(std::istream & istream, ConfigRcPtr & c, const char * filename);
+// When a config is lazily loaded (refer to OCIO_LAZY_LOADING_ENVVAR), the transforms of the
+// color spaces and of the looks are not built while reading the config but only when the
+// element is used for the first time. The reader then only records, for each element name,
+// how to build its transforms.
+struct DeferredTransforms
+{
+    template<typename T>
+    using Loaders = std::vector<std::pair<std::string, std::function<void(T &)>>>;
+
+    Loaders<ColorSpace> m_colorSpaces;
+    Loaders<Look> m_looks;
+};
+
+// Note: The transforms are always built when deferred is null.
+void Read(std::istream & istream, ConfigRcPtr & c, const char * filename,
+          DeferredTransforms * deferred);
 void Write(std::ostream & ostream, const Config & c);
 
+// Precompiled config files hold the parsed content of a config file in a binary form. The header
+// records a stamp of the config file content to detect when the precompiled file is out of date.
+
+// Return false if the stream is not a precompiled config compatible with the library.
+bool ReadPrecompiledHeader(std::istream & istream, std::string & sourceStamp);
+// Read the remaining of a precompiled config i.e. after the header.
+void ReadPrecompiled(std::istream & istream, ConfigRcPtr & c, const char * filename,
+                     DeferredTransforms * deferred);
+// Convert a config file into a precompiled config.
+void WritePrecompiled(std::istream & istream, const std::string & sourceStamp,
+                      std::ostream & ostream);
+
 } // namespace OCIOYaml
 
 } // namespace OCIO_NAMESPACE
@@ -24,6 +24,27 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasApplyRGB() const
+{
+    return false;
+}
+
+void OpCPU::applyRGB(const void * /* inImg */, void * /* outImg */, long /* numPixels */) const
+{
+    throw Exception("Op does not implement the RGB processing.");
+}
+
+bool OpCPU::hasApplyPlanar() const
+{
+    return false;
+}
+
+void OpCPU::applyPlanar(float * /* r */, float * /* g */, float * /* b */, float * /* a */,
+                        long /* numPixels */) const
+{
+    throw Exception("Op does not implement the planar processing.");
+}
+
 bool OpCPU::hasDynamicProperty(DynamicPropertyType /* type */) const
 {
     return false;
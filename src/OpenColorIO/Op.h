@@ -41,6 +41,19 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Optional variant of apply() processing packed RGB pixels (i.e. without alpha) so the
+    // 3-channel images are not expanded to RGBA. The result must be identical to the one of
+    // apply() using a zero alpha. Only called if hasApplyRGB() returns true.
+    virtual bool hasApplyRGB() const;
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const;
+
+    // Optional variant of apply() processing in place the F32 pixels stored as separate channel
+    // planes (i.e. structure of arrays) so the planar images are not interleaved to RGBA. The
+    // result must be identical to the one of apply(). Only called if hasApplyPlanar() returns
+    // true.
+    virtual bool hasApplyPlanar() const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
+
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 };
@@ -5,10 +5,16 @@
 #ifndef INCLUDED_OCIO_OPBUILDERS_H
 #define INCLUDED_OCIO_OPBUILDERS_H
 
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Op.h"
 #include "LookParse.h"
+#include "Mutex.h"
 #include "PrivateTypes.h"
 
 namespace OCIO_NAMESPACE
@@ -163,6 +169,59 @@ const char * LooksResultColorSpace(const Config & config,
                                    const ConstContextRcPtr & context,
                                    const LookParseResult & looks);
 
+////////////////////////////////////////////////////////////////////////
+
+// Ops converting color spaces to or from the reference space, shared by the processors built
+// together (refer to Config::getProcessors()). Each conversion is only built once and the
+// processors get clones of its ops.
+class SharedColorSpaceOps
+{
+public:
+    SharedColorSpaceOps() = default;
+    SharedColorSpaceOps(const SharedColorSpaceOps &) = delete;
+    SharedColorSpaceOps & operator=(const SharedColorSpaceOps &) = delete;
+    ~SharedColorSpaceOps() = default;
+
+    // Append the ops of the conversion, calling build() if no other thread built them yet.
+    void append(OpRcPtrVec & ops,
+                const ConstContextRcPtr & context,
+                const ConstColorSpaceRcPtr & colorSpace,
+                bool toReference,
+                const std::function<void(OpRcPtrVec &)> & build);
+
+private:
+    struct Entry
+    {
+        Mutex m_mutex;
+        bool m_built{ false };
+        // Hold the instances so their addresses (i.e. the key) cannot be reused.
+        ConstContextRcPtr m_context;
+        ConstColorSpaceRcPtr m_colorSpace;
+        OpRcPtrVec m_ops;
+    };
+
+    typedef std::tuple<const Context *, const ColorSpace *, bool> Key;
+
+    Mutex m_mutex;
+    std::map<Key, std::shared_ptr<Entry>> m_entries;
+};
+
+// Make the shared ops visible to the op builders of the current thread for the duration of the
+// scope.
+class SharedColorSpaceOpsScope
+{
+public:
+    SharedColorSpaceOpsScope() = delete;
+    SharedColorSpaceOpsScope(const SharedColorSpaceOpsScope &) = delete;
+    SharedColorSpaceOpsScope & operator=(const SharedColorSpaceOpsScope &) = delete;
+
+    explicit SharedColorSpaceOpsScope(SharedColorSpaceOps & sharedOps) noexcept;
+    ~SharedColorSpaceOpsScope();
+
+private:
+    SharedColorSpaceOps * m_previous;
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif
@@ -7,11 +7,13 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "AsyncProcessor.h"
 #include "BitDepthUtils.h"
 #include "Logging.h"
 #include "Op.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "Profiling.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -537,7 +539,10 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     // Send the domain through the prefix ops.
     // Note: This sets the outBitDepth of newDomain to match prefixOps.
-    Lut1DOpData::ComposeVec(newDomain, prefixOps);
+    {
+        ProfilingTimer timer(&ProcessorProfile::m_lutCompositionTime, ProfilingTimer::DETAIL);
+        Lut1DOpData::ComposeVec(newDomain, prefixOps);
+    }
 
     // Remove the prefix ops.
     ops.erase(ops.begin(), ops.begin() + prefixLen);
@@ -558,6 +563,10 @@ void OpRcPtrVec::finalize()
         return;
     }
 
+    ThrowIfCancelled();
+
+    ProfilingTimer timer(&ProcessorProfile::m_finalizeTime, ProfilingTimer::PHASE);
+
     validate();
 
     // Prepare LUT 1D for inversion and ensure Matrix & Range are forward.
@@ -571,6 +580,10 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         return;
     }
 
+    ThrowIfCancelled();
+
+    ProfilingTimer timer(&ProcessorProfile::m_optimizeTime, ProfilingTimer::PHASE);
+
     if (IsDebugLoggingEnabled())
     {
         std::ostringstream oss;
@@ -680,6 +693,12 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
         LogDebug(os.str());
     }
 
+    if (ProcessorProfile * profile = GetCurrentProcessorProfile())
+    {
+        profile->m_numOptimizationPasses += static_cast<unsigned>(passes);
+        profile->m_numOpsCombined += static_cast<unsigned>(total_combines);
+    }
+
     if (IsDebugLoggingEnabled())
     {
         OpRcPtrVec::size_type finalSize = size();
@@ -707,6 +726,8 @@ void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
 {
     if (!empty())
     {
+        ProfilingTimer timer(&ProcessorProfile::m_optimizeForBitDepthTime, ProfilingTimer::PHASE);
+
         if (!IsFloatBitDepth(inBitDepth))
         {
             RemoveLeadingClampIdentity(*this);
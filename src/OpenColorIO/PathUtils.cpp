@@ -4,10 +4,12 @@
 
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <sys/stat.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "Caching.h"
 #include "Mutex.h"
 #include "PathUtils.h"
 #include "pystring/pystring.h"
@@ -77,6 +79,7 @@ typedef std::map<std::string, FileHashResultPtr> FileCacheMap;
 
 FileCacheMap g_fastFileHashCache;
 Mutex g_fastFileHashCache_mutex;
+CacheCounters g_fastFileHashCounters;
 }
 
 void SetComputeHashFunction(ComputeHashFunction hashFunction)
@@ -111,11 +114,17 @@ std::string GetFastFileHash(const std::string & filename)
         AutoMutex lock(fileHashResultPtr->mutex);
         if(!fileHashResultPtr->ready)
         {
+            CacheMissTimer timer(g_fastFileHashCounters);
+
             // NB: OCIO does not attempt to detect if files have changed and caused the cache to
             // become stale.
             fileHashResultPtr->ready = true;
             fileHashResultPtr->hash = g_hashFunction(filename);
         }
+        else
+        {
+            g_fastFileHashCounters.addHit();
+        }
 
         hash = fileHashResultPtr->hash;
     }
@@ -123,6 +132,19 @@ std::string GetFastFileHash(const std::string & filename)
     return hash;
 }
 
+std::string GetFileStamp(const std::string & filename)
+{
+    struct stat fileInfo;
+    if (stat(filename.c_str(), &fileInfo) == 0)
+    {
+        std::ostringstream stamp;
+        stamp << fileInfo.st_size << ":" << fileInfo.st_mtime;
+        return stamp.str();
+    }
+
+    return "";
+}
+
 bool FileExists(const std::string & filename)
 {
     std::string hash = GetFastFileHash(filename);
@@ -135,6 +157,25 @@ void ClearPathCaches()
     g_fastFileHashCache.clear();
 }
 
+CacheStatistics GetPathCacheStatistics()
+{
+    CacheStatistics stats;
+    stats.m_name = "file_hash";
+    g_fastFileHashCounters.fill(stats);
+
+    AutoMutex lock(g_fastFileHashCache_mutex);
+
+    stats.m_numEntries = g_fastFileHashCache.size();
+    for (const auto & entry : g_fastFileHashCache)
+    {
+        AutoMutex entryLock(entry.second->mutex);
+        stats.m_approximateBytes
+            += entry.first.size() + sizeof(FileHashResult) + entry.second->hash.size();
+    }
+
+    return stats;
+}
+
 namespace
 {
 std::string GetCwd()
@@ -24,8 +24,14 @@ bool FileExists(const std::string & filename);
 // Currently, this checks the mtime and the inode number.
 std::string GetFastFileHash(const std::string & filename);
 
+// Get a key identifying the version of a file i.e. changes when the file is modified. Returns an
+// empty string if the file does not exist. Note that the result is not cached.
+std::string GetFileStamp(const std::string & filename);
+
 void ClearPathCaches();
 
+CacheStatistics GetPathCacheStatistics();
+
 // Works on active and inactive color spaces name and aliases.
 int ParseColorSpaceFromString(const Config & config, const char * str);
 
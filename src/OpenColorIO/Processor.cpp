@@ -15,6 +15,7 @@
 #include "OpBuilders.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
+#include "Profiling.h"
 #include "TransformBuilder.h"
 #include "utils/StringUtils.h"
 
@@ -218,6 +219,21 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+int Processor::getNumCacheStatistics() const noexcept
+{
+    return 3;
+}
+
+CacheStatistics Processor::getCacheStatistics(int index) const
+{
+    return getImpl()->getCacheStatistics(index);
+}
+
+void Processor::clearCaches() const
+{
+    getImpl()->clearCaches();
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -374,6 +390,8 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
                               BitDepth outBitDepth,
                               OptimizationFlags oFlags) -> ProcessorRcPtr
     {
+        ProfilingScope profiling("OptimizedProcessor");
+
         ProcessorRcPtr proc = Create();
         *proc->getImpl() = procImpl;
 
@@ -382,6 +400,7 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         proc->getImpl()->m_ops.optimizeForBitdepth(inBitDepth, outBitDepth, oFlags);
         proc->getImpl()->m_ops.validateDynamicProperties();
 
+        profiling.report();
         return proc;
     };
 
@@ -400,8 +419,14 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
         // As the entry is a shared pointer instance, having an empty one means that the entry does
         // not exist in the cache. So, it provides a fast existence check & access in one call.
         ProcessorRcPtr & processor = m_optProcessorCache[key];
-        if (!processor)
+        if (processor)
+        {
+            m_optProcessorCache.counters().addHit();
+        }
+        else
         {
+            CacheMissTimer timer(m_optProcessorCache.counters());
+
             // Note: Some combinations of bit-depth and opt flags will produce identical Processors.
             // Duplicates could be identified by computing the Processor cacheID, but that is too
             // slow to attempt here.
@@ -480,8 +505,12 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
     auto CreateProcessor = [](const OpRcPtrVec & ops,
                               OptimizationFlags oFlags) -> GPUProcessorRcPtr
     {
+        ProfilingScope profiling("GPUProcessor");
+
         GPUProcessorRcPtr gpu = GPUProcessorRcPtr(new GPUProcessor(), &GPUProcessor::deleter);
         gpu->getImpl()->finalize(ops, oFlags);
+
+        profiling.report();
         return gpu;
     };
 
@@ -494,8 +523,14 @@ ConstGPUProcessorRcPtr Processor::Impl::getGPUProcessor(const OpRcPtrVec & gpuOp
         // As the entry is a shared pointer instance, having an empty one means that the entry does
         // not exist in the cache. So, it provides a fast existence check & access in one call.
         GPUProcessorRcPtr & processor = m_gpuProcessorCache[oFlags];
-        if (!processor)
+        if (processor)
+        {
+            m_gpuProcessorCache.counters().addHit();
+        }
+        else
         {
+            CacheMissTimer timer(m_gpuProcessorCache.counters());
+
             processor = CreateProcessor(gpuOps, oFlags);
         }
         
@@ -529,8 +564,12 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
                               BitDepth outBitDepth,
                               OptimizationFlags oFlags) -> CPUProcessorRcPtr
     {
+        ProfilingScope profiling("CPUProcessor");
+
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
         cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+
+        profiling.report();
         return cpu;
     };
 
@@ -553,8 +592,14 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
         // As the entry is a shared pointer instance, having an empty one means that the entry does
         // not exist in the cache. So, it provides a fast existence check & access in one call.
         CPUProcessorRcPtr & processor = m_cpuProcessorCache[key];
-        if (!processor)
+        if (processor)
         {
+            m_cpuProcessorCache.counters().addHit();
+        }
+        else
+        {
+            CacheMissTimer timer(m_cpuProcessorCache.counters());
+
             processor = CreateProcessor(m_ops, inBitDepth, outBitDepth, oFlags);
         }
         
@@ -566,6 +611,29 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
     }
 }
 
+CacheStatistics Processor::Impl::getCacheStatistics(int index) const
+{
+    switch (index)
+    {
+        case 0:
+            return m_optProcessorCache.getStatistics("optimized_processor", ProcessorEntryBytes());
+        case 1:
+            return m_cpuProcessorCache.getStatistics("cpu_processor", ProcessorEntryBytes());
+        case 2:
+            return m_gpuProcessorCache.getStatistics("gpu_processor", ProcessorEntryBytes());
+    }
+
+    ThrowInvalidCacheStatisticsIndex(index);
+    return CacheStatistics();
+}
+
+void Processor::Impl::clearCaches() const noexcept
+{
+    m_optProcessorCache.clear();
+    m_cpuProcessorCache.clear();
+    m_gpuProcessorCache.clear();
+}
+
 void Processor::Impl::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
 {
     m_cacheFlags = flags;
@@ -592,7 +660,10 @@ void Processor::Impl::setColorSpaceConversion(const Config & config,
 
     // Default behavior is to bypass data color space. ColorSpaceTransform can be used to not bypass
     // data color spaces.
-    BuildColorSpaceOps(m_ops, config, context, srcColorSpace, dstColorSpace, true);
+    {
+        ProfilingTimer timer(&ProcessorProfile::m_buildOpsTime, ProfilingTimer::PHASE);
+        BuildColorSpaceOps(m_ops, config, context, srcColorSpace, dstColorSpace, true);
+    }
 
     std::ostringstream desc;
     desc << "Color space conversion from " << srcColorSpace->getName()
@@ -617,7 +688,10 @@ void Processor::Impl::setTransform(const Config & config,
 
     transform->validate();
 
-    BuildOps(m_ops, config, context, transform, direction);
+    {
+        ProfilingTimer timer(&ProcessorProfile::m_buildOpsTime, ProfilingTimer::PHASE);
+        BuildOps(m_ops, config, context, transform, direction);
+    }
 
     // NB: No-ops are not removed yet since they are still needed to build the legacy GPU processor.
     m_ops.finalize();
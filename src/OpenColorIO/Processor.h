@@ -87,6 +87,9 @@ public:
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    CacheStatistics getCacheStatistics(int index) const;
+    void clearCaches() const noexcept;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
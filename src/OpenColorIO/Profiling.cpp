@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+#include "Profiling.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+Mutex g_profilingMutex;
+ProcessorProfilingFunction g_profilingFunction;
+
+// Avoid the mutex when the profiling is disabled i.e. the common case.
+std::atomic<bool> g_profilingEnabled{ false };
+
+thread_local ProcessorProfile * t_currentProfile = nullptr;
+thread_local bool t_phaseActive  = false;
+thread_local bool t_detailActive = false;
+
+double ToSeconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+} // anon.
+
+void SetProcessorProfilingFunction(ProcessorProfilingFunction profilingFunction)
+{
+    AutoMutex lock(g_profilingMutex);
+
+    g_profilingFunction = profilingFunction;
+    g_profilingEnabled  = static_cast<bool>(g_profilingFunction);
+}
+
+ProfilingScope::ProfilingScope(const char * type)
+{
+    if (g_profilingEnabled.load(std::memory_order_relaxed) && !t_currentProfile)
+    {
+        m_profile.m_type = type;
+        m_start          = Clock::now();
+        m_active         = true;
+
+        t_currentProfile = &m_profile;
+    }
+}
+
+ProfilingScope::~ProfilingScope()
+{
+    if (m_active)
+    {
+        t_currentProfile = nullptr;
+    }
+}
+
+void ProfilingScope::report()
+{
+    if (!m_active)
+    {
+        return;
+    }
+
+    m_profile.m_totalTime = ToSeconds(Clock::now() - m_start);
+
+    m_active = false;
+    t_currentProfile = nullptr;
+
+    // Do not hold the mutex while calling the profiling function.
+    ProcessorProfilingFunction profilingFunction;
+    {
+        AutoMutex lock(g_profilingMutex);
+        profilingFunction = g_profilingFunction;
+    }
+
+    if (profilingFunction)
+    {
+        profilingFunction(m_profile);
+    }
+}
+
+ProcessorProfile * GetCurrentProcessorProfile() noexcept
+{
+    return t_currentProfile;
+}
+
+ProfilingTimer::ProfilingTimer(double ProcessorProfile::* time, Kind kind) noexcept
+{
+    if (t_currentProfile)
+    {
+        bool & kindActive = kind == PHASE ? t_phaseActive : t_detailActive;
+        if (!kindActive)
+        {
+            kindActive   = true;
+            m_kindActive = &kindActive;
+            m_time       = time;
+            m_start      = Clock::now();
+        }
+    }
+}
+
+ProfilingTimer::~ProfilingTimer()
+{
+    if (m_time)
+    {
+        *m_kindActive = false;
+
+        // Note: The scope could have been reported meanwhile.
+        if (t_currentProfile)
+        {
+            t_currentProfile->*m_time += ToSeconds(Clock::now() - m_start);
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
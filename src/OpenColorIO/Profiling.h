@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PROFILING_H
+#define INCLUDED_OCIO_PROFILING_H
+
+
+#include <chrono>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Collect the profile of the processor created by the current thread (refer to
+// SetProcessorProfilingFunction()). Nothing is collected when the profiling is disabled or when
+// a profile is already collected by an enclosing scope.
+class ProfilingScope
+{
+public:
+    ProfilingScope() = delete;
+    ProfilingScope(const ProfilingScope &) = delete;
+    ProfilingScope & operator=(const ProfilingScope &) = delete;
+
+    explicit ProfilingScope(const char * type);
+    ~ProfilingScope();
+
+    // Send the profile to the profiling function. Only call it once the processor is created.
+    void report();
+
+private:
+    ProcessorProfile m_profile;
+    std::chrono::steady_clock::time_point m_start;
+    bool m_active = false;
+};
+
+// Return the profile collected by the current thread, or null.
+ProcessorProfile * GetCurrentProcessorProfile() noexcept;
+
+// Add the duration of its lifetime to one of the times of the current profile, if any. Only the
+// outermost timer of each kind records so that the phase times (and the detail times) do not
+// overlap e.g. the ops finalized while building the ops of a FileTransform.
+class ProfilingTimer
+{
+public:
+    enum Kind
+    {
+        PHASE = 0,  // Processor creation phases (e.g. building the ops, optimizing the ops).
+        DETAIL      // Costly steps within the phases (e.g. LUT composition, file loading).
+    };
+
+    ProfilingTimer() = delete;
+    ProfilingTimer(const ProfilingTimer &) = delete;
+    ProfilingTimer & operator=(const ProfilingTimer &) = delete;
+
+    ProfilingTimer(double ProcessorProfile::* time, Kind kind) noexcept;
+    ~ProfilingTimer();
+
+private:
+    double ProcessorProfile::* m_time = nullptr; // Null when not recording.
+    bool * m_kindActive = nullptr;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -72,6 +72,106 @@ inline __m128 isNegativeSpecial(const __m128 x)
   return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), SIGN_SHIFT));
 }
 
+// Load a RGB pixel (i.e. no alpha) with a zero alpha.
+inline __m128 sseLoadRGB(const float * in)
+{
+    return _mm_set_ps(0.0f, in[2], in[1], in[0]);
+}
+
+// Store the RGB channels of a pixel (i.e. the first three floats) without writing past them.
+inline void sseStoreRGB(float * out, const __m128 & pixel)
+{
+    _mm_storel_pi(reinterpret_cast<__m64 *>(out), pixel);
+    _mm_store_ss(out + 2, _mm_movehl_ps(pixel, pixel));
+}
+
+// Process in place the channel planes of a planar image by groups of 4 pixels i.e. the kernel
+// receives the red, green, blue and alpha values of 4 consecutive pixels. The last group is
+// padded with zeros.
+template<typename Kernel>
+inline void sseProcessPlanes(float * r, float * g, float * b, float * a, long numPixels,
+                             const Kernel & kernel)
+{
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 rr = _mm_loadu_ps(r + idx);
+        __m128 gg = _mm_loadu_ps(g + idx);
+        __m128 bb = _mm_loadu_ps(b + idx);
+        __m128 aa = _mm_loadu_ps(a + idx);
+
+        kernel(rr, gg, bb, aa);
+
+        _mm_storeu_ps(r + idx, rr);
+        _mm_storeu_ps(g + idx, gg);
+        _mm_storeu_ps(b + idx, bb);
+        _mm_storeu_ps(a + idx, aa);
+    }
+
+    const long remaining = numPixels - idx;
+    if (remaining > 0)
+    {
+        float * planes[4] = { r + idx, g + idx, b + idx, a + idx };
+
+        float values[4][4];
+        for (int c = 0; c < 4; ++c)
+        {
+            for (long i = 0; i < 4; ++i)
+            {
+                values[c][i] = i < remaining ? planes[c][i] : 0.0f;
+            }
+        }
+
+        __m128 rr = _mm_loadu_ps(values[0]);
+        __m128 gg = _mm_loadu_ps(values[1]);
+        __m128 bb = _mm_loadu_ps(values[2]);
+        __m128 aa = _mm_loadu_ps(values[3]);
+
+        kernel(rr, gg, bb, aa);
+
+        _mm_storeu_ps(values[0], rr);
+        _mm_storeu_ps(values[1], gg);
+        _mm_storeu_ps(values[2], bb);
+        _mm_storeu_ps(values[3], aa);
+
+        for (int c = 0; c < 4; ++c)
+        {
+            for (long i = 0; i < remaining; ++i)
+            {
+                planes[c][i] = values[c][i];
+            }
+        }
+    }
+}
+
+// Same as above for a single channel plane i.e. the kernel returns the processed values.
+template<typename Kernel>
+inline void sseProcessPlane(float * values, long numValues, const Kernel & kernel)
+{
+    long idx = 0;
+    for (; idx + 4 <= numValues; idx += 4)
+    {
+        _mm_storeu_ps(values + idx, kernel(_mm_loadu_ps(values + idx)));
+    }
+
+    const long remaining = numValues - idx;
+    if (remaining > 0)
+    {
+        float tail[4];
+        for (long i = 0; i < 4; ++i)
+        {
+            tail[i] = i < remaining ? values[idx + i] : 0.0f;
+        }
+
+        _mm_storeu_ps(tail, kernel(_mm_loadu_ps(tail)));
+
+        for (long i = 0; i < remaining; ++i)
+        {
+            values[idx + i] = tail[i];
+        }
+    }
+}
+
 // Select function in SSE version 2
 //
 // Return the parameter arg_false when the parameter mask is 0x0,
@@ -2,10 +2,12 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <type_traits>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUProcessor.h"
 #include "ScanlineHelper.h"
 
 
@@ -42,6 +44,11 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_outBitDepthOp(outBitDepthOp)
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
+    ,   m_inBitDepthCast(IsBitDepthCast(inBitDepthOp))
+    ,   m_outBitDepthCast(IsBitDepthCast(outBitDepthOp))
+    ,   m_inScale(1.0f / float(GetBitDepthMaxValue(inputBitDepth)))
+    ,   m_outScale(float(GetBitDepthMaxValue(outputBitDepth)))
+    ,   m_outMaxValue(float(GetBitDepthMaxValue(outputBitDepth)))
     ,   m_yIndex(0)
     ,   m_useDstBuffer(false)
 {
@@ -67,17 +74,17 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
+    const size_t bufferSize = 4 * size_t(m_dstImg.m_width);
+
     if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_inBitDepthBuffer.resize(bufferSize);
+        m_inBitDepthBuffer = m_inBitDepthScratch.reserve<InType>(bufferSize);
     }
 
     if(!m_useDstBuffer)
     {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
+        m_rgbaFloatBuffer   = m_rgbaFloatScratch.reserve<float>(bufferSize);
+        m_outBitDepthBuffer = m_outBitDepthScratch.reserve<OutType>(bufferSize);
     }
 }
 
@@ -98,14 +105,11 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
 
     if(!m_useDstBuffer)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
-
-        const long bufferSize = 4 * m_dstImg.m_width;
+        const size_t bufferSize = 4 * size_t(m_dstImg.m_width);
 
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_inBitDepthBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
+        m_rgbaFloatBuffer   = m_rgbaFloatScratch.reserve<float>(bufferSize);
+        m_inBitDepthBuffer  = m_inBitDepthScratch.reserve<InType>(bufferSize);
+        m_outBitDepthBuffer = m_outBitDepthScratch.reserve<OutType>(bufferSize);
     }
 }
 
@@ -127,7 +131,7 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
     }
 
     *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
-                             : &m_rgbaFloatBuffer[0];
+                             : m_rgbaFloatBuffer;
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
@@ -135,12 +139,41 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
 
         m_srcImg.m_bitDepthOp->apply(inBuffer, *buffer, m_dstImg.m_width);
     }
+    else if(m_srcImg.m_chanPacking!=CHANNEL_PACKING_NONE)
+    {
+        // Unpack the channels from the words, the bit-depth op then converting them to F32.
+        const void * in = m_srcImg.m_packedData + m_srcImg.m_yStrideBytes * m_yIndex;
+
+        WordPacked<InType>::ToRGBA(m_srcImg.m_chanPacking, m_srcImg.m_chanOrder, in,
+                                   m_inBitDepthBuffer, m_dstImg.m_width);
+        m_srcImg.m_bitDepthOp->apply(m_inBitDepthBuffer, *buffer, m_dstImg.m_width);
+    }
+    else if(m_srcImg.m_packedLayout!=PACKED_LAYOUT_NONE)
+    {
+        const InType * in = reinterpret_cast<const InType *>(m_srcImg.m_packedData
+                                                             + m_srcImg.m_yStrideBytes * m_yIndex);
+
+        if(m_inBitDepthCast)
+        {
+            Packed<InType>::ToRGBAFloat(m_srcImg.m_packedLayout, in, *buffer,
+                                        m_dstImg.m_width, m_inScale);
+        }
+        else
+        {
+            // The F32 input is converted in place by the bit-depth op (i.e. the first op).
+            InType * rgba = std::is_same<InType, float>::value
+                                ? reinterpret_cast<InType *>(*buffer) : m_inBitDepthBuffer;
+
+            Packed<InType>::ToRGBA(m_srcImg.m_packedLayout, in, rgba, m_dstImg.m_width);
+            m_srcImg.m_bitDepthOp->apply(rgba, *buffer, m_dstImg.m_width);
+        }
+    }
     else
     {
         // Pack from any channel ordering & bit-depth to a packed RGBA F32 buffer.
 
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
-                                               &m_inBitDepthBuffer[0],
+                                               m_inBitDepthBuffer,
                                                *buffer,
                                                m_dstImg.m_width,
                                                m_yIndex * m_dstImg.m_width);
@@ -159,16 +192,43 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
     {
         void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
 
-        const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
+        const void * in  = m_useDstBuffer ? out : (void*)m_rgbaFloatBuffer;
 
         m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
     }
+    else if(m_dstImg.m_chanPacking!=CHANNEL_PACKING_NONE)
+    {
+        void * out = m_dstImg.m_packedData + m_dstImg.m_yStrideBytes * m_yIndex;
+
+        m_dstImg.m_bitDepthOp->apply(m_rgbaFloatBuffer, m_outBitDepthBuffer,
+                                     m_dstImg.m_width);
+        WordPacked<OutType>::FromRGBA(m_dstImg.m_chanPacking, m_dstImg.m_chanOrder,
+                                      m_outBitDepthBuffer, out, m_dstImg.m_width);
+    }
+    else if(m_dstImg.m_packedLayout!=PACKED_LAYOUT_NONE)
+    {
+        OutType * out = reinterpret_cast<OutType *>(m_dstImg.m_packedData
+                                                    + m_dstImg.m_yStrideBytes * m_yIndex);
+
+        if(m_outBitDepthCast)
+        {
+            Packed<OutType>::FromRGBAFloat(m_dstImg.m_packedLayout, m_rgbaFloatBuffer, out,
+                                           m_dstImg.m_width, m_outScale, m_outMaxValue);
+        }
+        else
+        {
+            m_dstImg.m_bitDepthOp->apply(m_rgbaFloatBuffer, m_outBitDepthBuffer,
+                                         m_dstImg.m_width);
+            Packed<OutType>::FromRGBA(m_dstImg.m_packedLayout, m_outBitDepthBuffer, out,
+                                      m_dstImg.m_width);
+        }
+    }
     else
     {
         // Unpack from packed RGBA F32 to any channel ordering & bit-depth.
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
-                                                &m_rgbaFloatBuffer[0],
-                                                &m_outBitDepthBuffer[0],
+                                                m_rgbaFloatBuffer,
+                                                m_outBitDepthBuffer,
                                                 m_dstImg.m_width,
                                                 m_yIndex * m_dstImg.m_width);
     }
@@ -177,6 +237,139 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 }
 
 
+template<typename InType, typename OutType>
+bool GenericScanlineHelper<InType, OutType>::isPackedRGB() const
+{
+    return m_srcImg.m_packedLayout==PACKED_LAYOUT_RGB
+        && m_dstImg.m_packedLayout==PACKED_LAYOUT_RGB;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::prepRGBScanline(float** buffer, long & numPixels)
+{
+    if(m_yIndex >= m_dstImg.m_height)
+    {
+        numPixels = 0;
+        return;
+    }
+
+    // A F32 destination line is directly used as the processing buffer.
+    *buffer = std::is_same<OutType, float>::value
+                ? reinterpret_cast<float *>(m_dstImg.m_packedData
+                                            + m_dstImg.m_yStrideBytes * m_yIndex)
+                : m_rgbaFloatBuffer;
+
+    const void * in = m_srcImg.m_packedData + m_srcImg.m_yStrideBytes * m_yIndex;
+    m_srcImg.m_bitDepthOp->applyRGB(in, *buffer, m_dstImg.m_width);
+
+    numPixels = m_dstImg.m_width;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::finishRGBScanline()
+{
+    void * out = m_dstImg.m_packedData + m_dstImg.m_yStrideBytes * m_yIndex;
+
+    const void * in = std::is_same<OutType, float>::value ? out : (void*)m_rgbaFloatBuffer;
+    m_dstImg.m_bitDepthOp->applyRGB(in, out, m_dstImg.m_width);
+
+    ++m_yIndex;
+}
+
+template<typename InType, typename OutType>
+bool GenericScanlineHelper<InType, OutType>::isPlanar() const
+{
+    return m_srcImg.m_isPlanar && m_dstImg.m_isPlanar;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::getPlanarBuffers(float** planes)
+{
+    const long width = m_dstImg.m_width;
+    const ptrdiff_t dstOffset = m_dstImg.m_yStrideBytes * m_yIndex;
+
+    char * dstPlanes[4] = { m_dstImg.m_rData, m_dstImg.m_gData,
+                            m_dstImg.m_bData, m_dstImg.m_aData };
+
+    // The F32 destination lines are directly used as the processing buffers (except for a
+    // missing alpha).
+    for(int c = 0; c < 4; ++c)
+    {
+        planes[c] = std::is_same<OutType, float>::value && dstPlanes[c]
+                        ? reinterpret_cast<float *>(dstPlanes[c] + dstOffset)
+                        : m_rgbaFloatBuffer + c * width;
+    }
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::prepPlanarScanline(float** planes, long & numPixels)
+{
+    if(m_yIndex >= m_dstImg.m_height)
+    {
+        numPixels = 0;
+        return;
+    }
+
+    const long width = m_dstImg.m_width;
+    const ptrdiff_t srcOffset = m_srcImg.m_yStrideBytes * m_yIndex;
+
+    getPlanarBuffers(planes);
+
+    const char * srcPlanes[4] = { m_srcImg.m_rData, m_srcImg.m_gData,
+                                  m_srcImg.m_bData, m_srcImg.m_aData };
+
+    for(int c = 0; c < 4; ++c)
+    {
+        if(srcPlanes[c])
+        {
+            const InType * in = reinterpret_cast<const InType *>(srcPlanes[c] + srcOffset);
+            Planar<InType>::ToFloat(in, planes[c], width, m_inScale);
+        }
+        else
+        {
+            std::fill(planes[c], planes[c] + width, 0.0f);
+        }
+    }
+
+    // The F32 input is processed by the bit-depth op (i.e. the first op).
+    if(!m_inBitDepthCast)
+    {
+        m_srcImg.m_bitDepthOp->applyPlanar(planes[0], planes[1], planes[2], planes[3], width);
+    }
+
+    numPixels = width;
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::finishPlanarScanline()
+{
+    const long width = m_dstImg.m_width;
+    const ptrdiff_t dstOffset = m_dstImg.m_yStrideBytes * m_yIndex;
+
+    float * planes[4];
+    getPlanarBuffers(planes);
+
+    // The F32 output is processed by the bit-depth op (i.e. the last op).
+    if(!m_outBitDepthCast)
+    {
+        m_dstImg.m_bitDepthOp->applyPlanar(planes[0], planes[1], planes[2], planes[3], width);
+    }
+
+    char * dstPlanes[4] = { m_dstImg.m_rData, m_dstImg.m_gData,
+                            m_dstImg.m_bData, m_dstImg.m_aData };
+
+    for(int c = 0; c < 4; ++c)
+    {
+        if(dstPlanes[c])
+        {
+            OutType * out = reinterpret_cast<OutType *>(dstPlanes[c] + dstOffset);
+            Planar<OutType>::FromFloat(planes[c], out, width, m_outScale, m_outMaxValue);
+        }
+    }
+
+    ++m_yIndex;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////
 
@@ -185,21 +378,31 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
 
 template class GenericScanlineHelper<uint8_t, uint8_t>;
 template class GenericScanlineHelper<uint8_t, uint16_t>;
+template class GenericScanlineHelper<uint8_t, uint32_t>;
 template class GenericScanlineHelper<uint8_t, half>;
 template class GenericScanlineHelper<uint8_t, float>;
 
 template class GenericScanlineHelper<uint16_t, uint8_t>;
 template class GenericScanlineHelper<uint16_t, uint16_t>;
+template class GenericScanlineHelper<uint16_t, uint32_t>;
 template class GenericScanlineHelper<uint16_t, half>;
 template class GenericScanlineHelper<uint16_t, float>;
 
+template class GenericScanlineHelper<uint32_t, uint8_t>;
+template class GenericScanlineHelper<uint32_t, uint16_t>;
+template class GenericScanlineHelper<uint32_t, uint32_t>;
+template class GenericScanlineHelper<uint32_t, half>;
+template class GenericScanlineHelper<uint32_t, float>;
+
 template class GenericScanlineHelper<half, uint8_t>;
 template class GenericScanlineHelper<half, uint16_t>;
+template class GenericScanlineHelper<half, uint32_t>;
 template class GenericScanlineHelper<half, half>;
 template class GenericScanlineHelper<half, float>;
 
 template class GenericScanlineHelper<float, uint8_t>;
 template class GenericScanlineHelper<float, uint16_t>;
+template class GenericScanlineHelper<float, uint32_t>;
 template class GenericScanlineHelper<float, half>;
 template class GenericScanlineHelper<float, float>;
 
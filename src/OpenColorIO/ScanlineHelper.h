@@ -8,6 +8,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ImagePacking.h"
+#include "ScratchArena.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -40,6 +41,21 @@ public:
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
+
+    // Are both images packed RGB buffers (i.e. without alpha)?
+    virtual bool isPackedRGB() const = 0;
+
+    // Same as above but the scanline holds packed RGB F32 pixels (refer to OpCPU::applyRGB()).
+    virtual void prepRGBScanline(float** buffer, long & numPixels) = 0;
+    virtual void finishRGBScanline() = 0;
+
+    // Are both images made of channel planes?
+    virtual bool isPlanar() const = 0;
+
+    // Same as above but the scanline holds the R, G, B and A planes of F32 values (refer to
+    // OpCPU::applyPlanar()).
+    virtual void prepPlanarScanline(float** planes, long & numPixels) = 0;
+    virtual void finishPlanarScanline() = 0;
 };
 
 template<typename InType, typename OutType>
@@ -68,7 +84,26 @@ public:
 
     void finishRGBAScanline() override;
 
+    bool isPackedRGB() const override;
+
+    // Process the packed RGB images without expanding the pixels to RGBA i.e. the bit-depth
+    // ops directly convert the lines using OpCPU::applyRGB().
+
+    void prepRGBScanline(float** buffer, long & numPixels) override;
+    void finishRGBScanline() override;
+
+    bool isPlanar() const override;
+
+    // Process the planar images without interleaving the channels i.e. the lines of the planes
+    // are converted to F32 planes which are processed using OpCPU::applyPlanar().
+
+    void prepPlanarScanline(float** planes, long & numPixels) override;
+    void finishPlanarScanline() override;
+
 private:
+    // Find the F32 planes of the current line.
+    void getPlanarBuffers(float** planes);
+
     BitDepth m_inputBitDepth;
     BitDepth m_outputBitDepth;
     ConstOpCPURcPtr m_inBitDepthOp;
@@ -80,13 +115,26 @@ private:
     Optimizations m_inOptimizedMode;  // Optimization applicable to the input buffer.
     Optimizations m_outOptimizedMode; // Optimization applicable to the output buffer.
 
+    // When the bit-depth ops only convert the bit-depth, the packed layouts are converted
+    // to/from RGBA F32 in one pass using the scales (and the max value for the clamping).
+    bool m_inBitDepthCast;
+    bool m_outBitDepthCast;
+    float m_inScale;
+    float m_outScale;
+    float m_outMaxValue;
+
     // Processing needs an intermediate buffer as CPU Ops only process packed RGBA F32.
-    std::vector<float> m_rgbaFloatBuffer;
+    float * m_rgbaFloatBuffer = nullptr;
 
     // Processing needs additional buffers of the same pixel type as the input/output
     // in order to convert arbitrary channel order from/to RGBA.
-    std::vector<InType> m_inBitDepthBuffer;
-    std::vector<OutType> m_outBitDepthBuffer;
+    InType * m_inBitDepthBuffer = nullptr;
+    OutType * m_outBitDepthBuffer = nullptr;
+
+    // The memory of the above buffers, drawn from the scratch arena of the thread.
+    ScratchBuffer m_rgbaFloatScratch;
+    ScratchBuffer m_inBitDepthScratch;
+    ScratchBuffer m_outBitDepthScratch;
 
     // The index of the current line to process.
     int m_yIndex;
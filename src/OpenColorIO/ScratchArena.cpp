@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <new>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Platform.h"
+#include "ScratchArena.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The block header is stored at the start of its memory i.e. just before the data.
+struct ScratchBuffer::Block
+{
+    char * m_data = nullptr;
+    size_t m_size = 0;
+    Block * m_next = nullptr;
+};
+
+namespace
+{
+
+typedef ScratchBuffer::Block Block;
+
+static_assert(sizeof(Block) <= SCRATCH_ALIGNMENT, "The block header must fit in the alignment.");
+
+// The blocks are at least that large so small buffers of various sizes share the same blocks.
+constexpr size_t MIN_BLOCK_SIZE = 4 * 1024;
+
+// The larger blocks are freed when released, to not hold onto the memory of the one-off large
+// buffers. Note that it still covers the scanline buffers of a 64K pixels wide RGBA F32 image.
+constexpr size_t MAX_KEPT_BLOCK_SIZE = 1024 * 1024;
+
+// Max number of blocks an arena holds for later use.
+constexpr size_t MAX_KEPT_BLOCKS = 16;
+
+Block * AllocateBlock(size_t numBytes)
+{
+    const size_t size = std::max(MIN_BLOCK_SIZE,
+                                 (numBytes + SCRATCH_ALIGNMENT - 1) & ~(SCRATCH_ALIGNMENT - 1));
+
+    void * memory = Platform::AlignedMalloc(SCRATCH_ALIGNMENT + size, SCRATCH_ALIGNMENT);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+
+    Block * block  = new (memory) Block;
+    block->m_data = static_cast<char *>(memory) + SCRATCH_ALIGNMENT;
+    block->m_size = size;
+
+    return block;
+}
+
+void FreeBlock(Block * block) noexcept
+{
+    block->~Block();
+    Platform::AlignedFree(block);
+}
+
+// The memory blocks of one thread available for the scratch buffers.
+class ScratchArena
+{
+public:
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena & operator=(const ScratchArena &) = delete;
+
+    ~ScratchArena()
+    {
+        while (m_blocks)
+        {
+            Block * next = m_blocks->m_next;
+            FreeBlock(m_blocks);
+            m_blocks = next;
+        }
+    }
+
+    // Return the smallest available block of at least numBytes, if any.
+    Block * acquire(size_t numBytes) noexcept
+    {
+        Block ** best = nullptr;
+        for (Block ** block = &m_blocks; *block; block = &(*block)->m_next)
+        {
+            if ((*block)->m_size >= numBytes && (!best || (*block)->m_size < (*best)->m_size))
+            {
+                best = block;
+            }
+        }
+
+        if (!best)
+        {
+            return nullptr;
+        }
+
+        Block * block = *best;
+        *best = block->m_next;
+        block->m_next = nullptr;
+        --m_numBlocks;
+
+        return block;
+    }
+
+    void release(Block * block) noexcept
+    {
+        if (block->m_size > MAX_KEPT_BLOCK_SIZE || m_numBlocks >= MAX_KEPT_BLOCKS)
+        {
+            FreeBlock(block);
+            return;
+        }
+
+        block->m_next = m_blocks;
+        m_blocks = block;
+        ++m_numBlocks;
+    }
+
+    size_t getNumBlocks() const noexcept { return m_numBlocks; }
+
+private:
+    Block * m_blocks   = nullptr;
+    size_t m_numBlocks = 0;
+};
+
+ScratchArena & GetThreadArena() noexcept
+{
+    static thread_local ScratchArena arena;
+    return arena;
+}
+
+} // anon.
+
+void * ScratchBuffer::reserve(size_t numBytes)
+{
+    if (m_block && m_block->m_size >= numBytes)
+    {
+        return m_block->m_data;
+    }
+
+    ScratchArena & arena = GetThreadArena();
+
+    Block * block = arena.acquire(numBytes);
+    if (!block)
+    {
+        block = AllocateBlock(numBytes);
+    }
+
+    if (m_block)
+    {
+        arena.release(m_block);
+    }
+    m_block = block;
+
+    return m_block->m_data;
+}
+
+void * ScratchBuffer::data() const noexcept
+{
+    return m_block ? m_block->m_data : nullptr;
+}
+
+size_t ScratchBuffer::capacity() const noexcept
+{
+    return m_block ? m_block->m_size : 0;
+}
+
+void ScratchBuffer::release() noexcept
+{
+    if (m_block)
+    {
+        GetThreadArena().release(m_block);
+        m_block = nullptr;
+    }
+}
+
+size_t GetNumScratchBlocks() noexcept
+{
+    return GetThreadArena().getNumBlocks();
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_SCRATCHARENA_H
+#define INCLUDED_OCIO_SCRATCHARENA_H
+
+
+#include <cstddef>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+/** For internal use only */
+
+namespace OCIO_NAMESPACE
+{
+
+// Alignment of the scratch memory (i.e. a cache line, and the AVX-512 vector size).
+constexpr size_t SCRATCH_ALIGNMENT = 64;
+
+// Temporary memory drawn from the scratch arena of the calling thread. The arena recycles the
+// memory blocks released by the scratch buffers so, once warm, the processing does not allocate
+// (e.g. the scanline buffers of the successive apply calls on the tiles of an image).
+//
+// Note: The scratch buffer must be used by a single thread, and must not be static or
+// thread_local (i.e. it must be released before the thread exits).
+class ScratchBuffer
+{
+public:
+    ScratchBuffer() = default;
+    ScratchBuffer(const ScratchBuffer &) = delete;
+    ScratchBuffer & operator=(const ScratchBuffer &) = delete;
+
+    ~ScratchBuffer() { release(); }
+
+    // Return a memory block of at least numBytes, aligned on SCRATCH_ALIGNMENT. The current
+    // block is kept when it is large enough, otherwise it is replaced. The content of the block
+    // is undefined.
+    void * reserve(size_t numBytes);
+
+    template<typename T>
+    T * reserve(size_t numValues)
+    {
+        return static_cast<T *>(reserve(numValues * sizeof(T)));
+    }
+
+    void * data() const noexcept;
+    size_t capacity() const noexcept;
+
+    // Return the memory block to the arena of the calling thread.
+    void release() noexcept;
+
+    struct Block;
+
+private:
+    Block * m_block = nullptr;
+};
+
+// Number of the memory blocks the arena of the calling thread holds for later use.
+size_t GetNumScratchBlocks() noexcept;
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Logging.h"
+#include "Platform.h"
+#include "TaskScheduler.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+constexpr static const char * OCIO_NUM_THREADS_ENVVAR = "OCIO_NUM_THREADS";
+
+// Number of threads requested by SetNumThreads(), 0 meaning the default one.
+std::atomic<unsigned> g_numThreads{ 0 };
+
+unsigned GetDefaultNumThreads()
+{
+    std::string value;
+    Platform::Getenv(OCIO_NUM_THREADS_ENVVAR, value);
+    if (!value.empty())
+    {
+        char * end = nullptr;
+        const long numThreads = std::strtol(value.c_str(), &end, 10);
+        if (end && *end == '\0' && numThreads > 0)
+        {
+            return static_cast<unsigned>(numThreads);
+        }
+
+        std::ostringstream oss;
+        oss << "Invalid $" << OCIO_NUM_THREADS_ENVVAR << " value '" << value
+            << "', the number of threads must be a positive integer.";
+        LogWarning(oss.str());
+    }
+
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// A basic pool of worker threads processing a FIFO queue of tasks.
+class ThreadPool
+{
+public:
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    ThreadPool() = default;
+
+    // Note: The pool is never destroyed (see GetThreadPool()) so the workers never stop.
+    ~ThreadPool() = default;
+
+    // Post the task making sure that at least numWorkers threads are available. The workers
+    // are only created on demand so a host limiting the number of threads (refer to
+    // SetNumThreads()) before any processing never pays for the default ones.
+    void post(std::function<void()> && task, unsigned numWorkers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            while (m_workers.size() < numWorkers)
+            {
+                m_workers.emplace_back([this]() { run(); });
+            }
+            m_tasks.push_back(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+private:
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return !m_tasks.empty(); });
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_workers;
+};
+
+ThreadPool & GetThreadPool()
+{
+    // The pool is intentionally leaked to avoid joining threads during the static
+    // destruction (which could dead-lock when the library is unloaded on some platforms).
+    static ThreadPool * pool = new ThreadPool();
+    return *pool;
+}
+
+// Holds the state shared by all the threads working on the same ParallelFor() call.
+struct ParallelJob
+{
+    ParallelJob(const std::function<void(size_t, size_t)> & func,
+                size_t numItems,
+                size_t numChunks)
+        :   m_func(func)
+        ,   m_numItems(numItems)
+        ,   m_numChunks(numChunks)
+        ,   m_chunkSize((numItems + numChunks - 1) / numChunks)
+    {
+    }
+
+    // Process chunks until there is nothing left to do.
+    void run()
+    {
+        for (;;)
+        {
+            const size_t chunk = m_nextChunk++;
+            if (chunk >= m_numChunks)
+            {
+                return;
+            }
+
+            try
+            {
+                const size_t begin = chunk * m_chunkSize;
+                const size_t end   = std::min(begin + m_chunkSize, m_numItems);
+                if (begin < end)
+                {
+                    m_func(begin, end);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+
+            if (++m_doneChunks == m_numChunks)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_condition.notify_all();
+            }
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_doneChunks == m_numChunks; });
+    }
+
+    // Note: The function is only used while some chunks are not yet done so the instance
+    // owned by the ParallelFor() caller is always alive.
+    const std::function<void(size_t, size_t)> & m_func;
+
+    const size_t m_numItems;
+    const size_t m_numChunks;
+    const size_t m_chunkSize;
+
+    std::atomic<size_t> m_nextChunk{ 0 };
+    std::atomic<size_t> m_doneChunks{ 0 };
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::exception_ptr m_error;
+};
+
+} // anon.
+
+void SetNumThreads(unsigned numThreads)
+{
+    g_numThreads = numThreads;
+}
+
+unsigned GetNumThreads()
+{
+    const unsigned numThreads = g_numThreads;
+    if (numThreads != 0)
+    {
+        return numThreads;
+    }
+
+    static const unsigned defaultNumThreads = GetDefaultNumThreads();
+    return defaultNumThreads;
+}
+
+void ParallelFor(size_t numItems,
+                 size_t minChunkSize,
+                 const std::function<void(size_t begin, size_t end)> & func)
+{
+    if (numItems == 0)
+    {
+        return;
+    }
+
+    const size_t numThreads = GetNumThreads();
+    minChunkSize = std::max(size_t(1), minChunkSize);
+
+    // A few chunks per thread help to balance the load when chunks do not take the same time.
+    const size_t maxChunks = (numItems + minChunkSize - 1) / minChunkSize;
+    const size_t numChunks = std::min(maxChunks, numThreads * 4);
+
+    if (numThreads == 1 || numChunks <= 1)
+    {
+        func(0, numItems);
+        return;
+    }
+
+    std::shared_ptr<ParallelJob> job = std::make_shared<ParallelJob>(func, numItems, numChunks);
+
+    const size_t numHelpers = std::min(numThreads, numChunks) - 1;
+    for (size_t idx = 0; idx < numHelpers; ++idx)
+    {
+        GetThreadPool().post([job]() { job->run(); }, static_cast<unsigned>(numHelpers));
+    }
+
+    job->run();
+    job->wait();
+
+    if (job->m_error)
+    {
+        std::rethrow_exception(job->m_error);
+    }
+}
+
+void RunAsync(std::function<void()> && task)
+{
+    // Never block the caller, even when the worker threads are disabled.
+    GetThreadPool().post(std::move(task), std::max(1u, GetNumThreads() - 1));
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_TASKSCHEDULER_H
+#define INCLUDED_OCIO_TASKSCHEDULER_H
+
+
+#include <cstddef>
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+/** For internal use only */
+
+namespace OCIO_NAMESPACE
+{
+
+// Note: GetNumThreads() & SetNumThreads() are public (refer to OpenColorIO.h).
+
+// Split the [0, numItems) range in chunks of at least minChunkSize items and process them
+// using a shared pool of worker threads. The calling thread also processes chunks so the method
+// is safe to call from within a chunk (i.e. nested calls never dead-lock). It returns when all the
+// chunks are processed and rethrows the first exception raised by func, if any.
+void ParallelFor(size_t numItems,
+                 size_t minChunkSize,
+                 const std::function<void(size_t begin, size_t end)> & func);
+
+// Run the task on a worker thread of the shared pool and return immediately. At least one worker
+// thread is created, even if GetNumThreads() is 1. The task must not throw.
+void RunAsync(std::function<void()> && task);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
@@ -15,6 +15,7 @@
 #include "ops/lut3d/Lut3DOp.h"
 #include "ParseUtils.h"
 #include "transforms/FileTransform.h"
+#include "transforms/PersistentFileCache.h"
 #include "utils/StringUtils.h"
 
 
@@ -83,6 +84,13 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    bool serialize(PersistentCacheWriter & writer) const override
+    {
+        writer.writeLut1D(lut1D);
+        writer.writeLut3D(lut3D);
+        return true;
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
@@ -114,6 +122,8 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    CachedFileRcPtr deserialize(PersistentCacheReader & reader) const override;
 };
 
 
@@ -594,6 +604,14 @@ void LocalFileFormat::bake(const Baker & baker,
     }
 }
 
+CachedFileRcPtr LocalFileFormat::deserialize(PersistentCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    reader.readLut1D(cachedFile->lut1D);
+    reader.readLut3D(cachedFile->lut3D);
+    return cachedFile;
+}
+
 void
 LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                 const Config & /*config*/,
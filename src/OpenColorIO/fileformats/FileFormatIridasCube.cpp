@@ -14,6 +14,7 @@
 #include "ops/matrix/MatrixOp.h"
 #include "ParseUtils.h"
 #include "transforms/FileTransform.h"
+#include "transforms/PersistentFileCache.h"
 #include "utils/StringUtils.h"
 
 
@@ -75,6 +76,15 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    bool serialize(PersistentCacheWriter & writer) const override
+    {
+        writer.writeLut1D(lut1D);
+        writer.writeLut3D(lut3D);
+        writer.write(domain_min);
+        writer.write(domain_max);
+        return true;
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
     float domain_min[3]{ 0.0f, 0.0f, 0.0f };
@@ -108,6 +118,8 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    CachedFileRcPtr deserialize(PersistentCacheReader & reader) const override;
 							  
 private:
     static void ThrowErrorMessage(const std::string & error,
@@ -426,6 +438,16 @@ void LocalFileFormat::bake(const Baker & baker,
     }
 }
 
+CachedFileRcPtr LocalFileFormat::deserialize(PersistentCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    reader.readLut1D(cachedFile->lut1D);
+    reader.readLut3D(cachedFile->lut3D);
+    reader.read(cachedFile->domain_min);
+    reader.read(cachedFile->domain_max);
+    return cachedFile;
+}
+
 void
 LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                 const Config & /*config*/,
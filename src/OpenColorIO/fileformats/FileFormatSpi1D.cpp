@@ -12,6 +12,7 @@
 #include "ParseUtils.h"
 #include "Platform.h"
 #include "transforms/FileTransform.h"
+#include "transforms/PersistentFileCache.h"
 #include "utils/StringUtils.h"
 
 
@@ -40,6 +41,14 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    bool serialize(PersistentCacheWriter & writer) const override
+    {
+        writer.writeLut1D(lut);
+        writer.write(from_min);
+        writer.write(from_max);
+        return true;
+    }
+
     Lut1DOpDataRcPtr lut;
     float from_min = 0.0f;
     float from_max = 1.0f;
@@ -66,6 +75,8 @@ public:
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
 
+    CachedFileRcPtr deserialize(PersistentCacheReader & reader) const override;
+
 private:
     static void ThrowErrorMessage(const std::string & error,
                                   int line,
@@ -257,6 +268,15 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     return cachedFile;
 }
 
+CachedFileRcPtr LocalFileFormat::deserialize(PersistentCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    reader.readLut1D(cachedFile->lut);
+    reader.read(cachedFile->from_min);
+    reader.read(cachedFile->from_max);
+    return cachedFile;
+}
+
 void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                     const Config & /*config*/,
                                     const ConstContextRcPtr & /*context*/,
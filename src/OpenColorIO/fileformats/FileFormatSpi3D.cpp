@@ -11,6 +11,7 @@
 #include "ops/lut3d/Lut3DOp.h"
 #include "Platform.h"
 #include "transforms/FileTransform.h"
+#include "transforms/PersistentFileCache.h"
 #include "utils/StringUtils.h"
 
 
@@ -38,6 +39,12 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    bool serialize(PersistentCacheWriter & writer) const override
+    {
+        writer.writeLut3D(lut);
+        return true;
+    }
+
     Lut3DOpDataRcPtr lut;
 };
 
@@ -61,6 +68,8 @@ public:
                         CachedFileRcPtr untypedCachedFile,
                         const FileTransform & fileTransform,
                         TransformDirection dir) const override;
+
+    CachedFileRcPtr deserialize(PersistentCacheReader & reader) const override;
 };
 
 void LocalFileFormat::getFormatInfo(FormatInfoVec & formatInfoVec) const
@@ -215,6 +224,13 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     return cachedFile;
 }
 
+CachedFileRcPtr LocalFileFormat::deserialize(PersistentCacheReader & reader) const
+{
+    LocalCachedFileRcPtr cachedFile = LocalCachedFileRcPtr(new LocalCachedFile());
+    reader.readLut3D(cachedFile->lut);
+    return cachedFile;
+}
+
 void LocalFileFormat::buildFileOps(OpRcPtrVec & ops,
                                     const Config & /*config*/,
                                     const ConstContextRcPtr & /*context*/,
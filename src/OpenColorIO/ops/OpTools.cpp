@@ -1,48 +1,141 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
+#include "HashUtils.h"
 #include "ops/OpTools.h"
+#include "TaskScheduler.h"
 
 namespace OCIO_NAMESPACE
 {
+
+namespace
+{
+
+// The functional composition of ops (e.g. when building a LUT from a string of ops) is
+// expensive and the same composition is often requested several times, for example when
+// creating processors for several bit-depths from the same transform. The results are cached
+// using the domain values & the op list cache identifier as the key.
+using EvalResult = std::shared_ptr<const std::vector<float>>;
+
+// The results could be large (e.g. several MB for a 65x65x65 LUT) and the keys are never reused
+// once a config is edited so the number of entries is limited, the oldest ones being evicted.
+constexpr size_t EVAL_CACHE_MAX_ENTRIES = 32;
+
+class EvalCache : public GenericCache<std::string, EvalResult>
+{
+public:
+    EvalCache()
+    {
+        setMaxEntries(EVAL_CACHE_MAX_ENTRIES);
+    }
+};
+
+EvalCache g_evalCache;
+
+// Number of pixels processed by a thread at once.
+constexpr size_t EVAL_CHUNK_SIZE = 4096;
+
+} // anon.
+
 void EvalTransform(const float * in,
                     float * out,
                     long numPixels,
                     OpRcPtrVec & ops)
 {
-    std::vector<float> tmp(numPixels * 4);
+    ops.finalize();
+    ops.optimize(OPTIMIZATION_NONE);
 
-    // Render the LUT entries (domain) through the ops.
-    const float * values = in;
-    for (long idx = 0; idx<numPixels; ++idx)
+    // Note: Dynamic properties could change between calls so their results are not cached.
+    const bool useCache = g_evalCache.isEnabled() && !ops.isDynamic();
+
+    std::string key;
+    if (useCache)
     {
-        tmp[4 * idx + 0] = values[0];
-        tmp[4 * idx + 1] = values[1];
-        tmp[4 * idx + 2] = values[2];
-        tmp[4 * idx + 3] = 1.0f;
+        key = CacheIDHash(reinterpret_cast<const char *>(in),
+                          int(numPixels * 3 * sizeof(float)));
+        key += ops.getCacheID();
+
+        AutoMutex guard(g_evalCache.lock());
+        if (g_evalCache.exists(key))
+        {
+            g_evalCache.counters().addHit();
 
-        values += 3;
+            const EvalResult & result = g_evalCache[key];
+            std::copy(result->begin(), result->end(), out);
+            return;
+        }
     }
 
-    ops.finalize();
-    ops.optimize(OPTIMIZATION_NONE);
+    const auto start = std::chrono::steady_clock::now();
 
-    for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
+    ConstOpCPURcPtrVec cpuOps;
+    for (const auto & op : ops)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        cpuOps.push_back(op->getCPUOp(false));
     }
 
-    float * result = out;
-    for (long idx = 0; idx<numPixels; ++idx)
+    // Render the LUT entries (domain) through the ops.
+    ParallelFor(size_t(numPixels), EVAL_CHUNK_SIZE, [in, out, &cpuOps](size_t begin, size_t end)
     {
-        result[0] = tmp[4 * idx + 0];
-        result[1] = tmp[4 * idx + 1];
-        result[2] = tmp[4 * idx + 2];
+        const long numChunkPixels = long(end - begin);
+        std::vector<float> tmp(numChunkPixels * 4);
+
+        const float * values = in + 3 * begin;
+        for (long idx = 0; idx<numChunkPixels; ++idx)
+        {
+            tmp[4 * idx + 0] = values[0];
+            tmp[4 * idx + 1] = values[1];
+            tmp[4 * idx + 2] = values[2];
+            tmp[4 * idx + 3] = 1.0f;
+
+            values += 3;
+        }
 
-        result += 3;
+        for (const auto & cpuOp : cpuOps)
+        {
+            cpuOp->apply(&tmp[0], &tmp[0], numChunkPixels);
+        }
+
+        float * result = out + 3 * begin;
+        for (long idx = 0; idx<numChunkPixels; ++idx)
+        {
+            result[0] = tmp[4 * idx + 0];
+            result[1] = tmp[4 * idx + 1];
+            result[2] = tmp[4 * idx + 2];
+
+            result += 3;
+        }
+    });
+
+    if (useCache)
+    {
+        g_evalCache.counters().addMiss(std::chrono::steady_clock::now() - start);
+
+        AutoMutex guard(g_evalCache.lock());
+        g_evalCache[key] = std::make_shared<const std::vector<float>>(out, out + numPixels * 3);
     }
 }
+
+void ClearOpCompositionCaches()
+{
+    g_evalCache.clear();
+}
+
+CacheStatistics GetOpCompositionCacheStatistics()
+{
+    return g_evalCache.getStatistics("op_composition",
+        [](const std::string & key, const EvalResult & result)
+        {
+            return key.size() + (result ? result->size() * sizeof(float) : 0);
+        });
+}
+
 } // namespace OCIO_NAMESPACE
@@ -14,10 +14,18 @@
 namespace OCIO_NAMESPACE
 {
 
+// Render numPixels RGB values through the ops. The in and out buffers may be the same.
+//
+// Note: The rendering is multi-threaded and the results are memoized (see
+// ClearOpCompositionCaches()) as the method is the core of the LUT functional composition.
 void EvalTransform(const float * in, float * out,
                    long numPixels,
                    OpRcPtrVec & ops);
 
+void ClearOpCompositionCaches();
+
+CacheStatistics GetOpCompositionCacheStatistics();
+
 } // namespace OCIO_NAMESPACE
 
 #endif
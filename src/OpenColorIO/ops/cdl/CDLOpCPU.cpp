@@ -170,6 +170,23 @@ inline void ApplySaturation(__m128& pix, const __m128 saturation)
     pix = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(pix, luma)));
 }
 
+static const __m128 LumaWeightR = _mm_set1_ps(0.2126f);
+static const __m128 LumaWeightG = _mm_set1_ps(0.7152f);
+static const __m128 LumaWeightB = _mm_set1_ps(0.0722f);
+
+// Apply the saturation component to the values of 4 pixels stored per channel. Note that the luma
+// is computed in the same order as above (i.e. the alpha term is zero).
+inline void ApplySaturation(__m128 & r, __m128 & g, __m128 & b, const __m128 saturation)
+{
+    const __m128 luma = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, LumaWeightR),
+                                              _mm_mul_ps(g, LumaWeightG)),
+                                   _mm_mul_ps(b, LumaWeightB));
+
+    r = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(r, luma)));
+    g = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(g, luma)));
+    b = _mm_add_ps(luma, _mm_mul_ps(saturation, _mm_sub_ps(b, luma)));
+}
+
 #endif // USE_SSE
 
 inline void ApplyScale(float * pix, const float scale)
@@ -267,6 +284,8 @@ public:
     CDLOpCPU() = delete;
     CDLOpCPU(ConstCDLOpDataRcPtr & cdl);
 
+    bool hasApplyPlanar() const override { return true; }
+
 protected:
     RenderParams m_renderParams;
 };
@@ -281,6 +300,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 
 #ifdef USE_SSE
@@ -294,6 +314,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 #endif
 
@@ -307,6 +328,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 
 #ifdef USE_SSE
@@ -320,6 +342,7 @@ public:
     }
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const;
 };
 #endif
 
@@ -341,6 +364,22 @@ void LoadRenderParams(const RenderParams & renderParams,
     power      = _mm_loadu_ps(renderParams.getPower());
     saturation = _mm_set1_ps(renderParams.getSaturation());
 }
+
+// Same as above but the parameters of each channel are broadcast.
+void LoadRenderParams(const RenderParams & renderParams,
+                      __m128 * slope,
+                      __m128 * offset,
+                      __m128 * power,
+                      __m128 & saturation)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        slope[c]  = _mm_set1_ps(renderParams.getSlope()[c]);
+        offset[c] = _mm_set1_ps(renderParams.getOffset()[c]);
+        power[c]  = _mm_set1_ps(renderParams.getPower()[c]);
+    }
+    saturation = _mm_set1_ps(renderParams.getSaturation());
+}
 #endif
 
 #ifdef USE_SSE
@@ -373,6 +412,39 @@ void CDLRendererFwdSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererFwdSSE<CLAMP>::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    __m128 slope[3], offset[3], power[3], saturation;
+    LoadRenderParams(this->m_renderParams, slope, offset, power, saturation);
+
+    // Note: The alpha is left unchanged.
+    sseProcessPlanes(r, g, b, a, numPixels, [&](__m128 & rr, __m128 & gg, __m128 & bb, __m128 &)
+    {
+        __m128 pix[3] = { rr, gg, bb };
+
+        for (int c = 0; c < 3; ++c)
+        {
+            pix[c] = _mm_mul_ps(pix[c], slope[c]);
+            pix[c] = _mm_add_ps(pix[c], offset[c]);
+
+            ApplyPower<CLAMP>(pix[c], power[c]);
+        }
+
+        ApplySaturation(pix[0], pix[1], pix[2], saturation);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            ApplyClamp<CLAMP>(pix[c]);
+        }
+
+        rr = pix[0];
+        gg = pix[1];
+        bb = pix[2];
+    });
+}
 #endif
 
 template<bool CLAMP>
@@ -406,6 +478,31 @@ void CDLRendererFwd<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererFwd<CLAMP>::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                        long numPixels) const
+{
+    const float * slope = m_renderParams.getSlope();
+    float inSlope[3] = {slope[0], slope[1], slope[2]};
+
+    for (long idx = 0; idx<numPixels; ++idx)
+    {
+        float pix[3] = { r[idx], g[idx], b[idx] };
+
+        ApplySlope(pix, inSlope);
+        ApplyOffset(pix, m_renderParams.getOffset());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplySaturation(pix, m_renderParams.getSaturation());
+        ApplyClamp<CLAMP>(pix);
+
+        r[idx] = pix[0];
+        g[idx] = pix[1];
+        b[idx] = pix[2];
+    }
+}
+
 #ifdef USE_SSE
 template<bool CLAMP>
 void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long numPixels) const
@@ -437,6 +534,40 @@ void CDLRendererRevSSE<CLAMP>::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+template<bool CLAMP>
+void CDLRendererRevSSE<CLAMP>::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    __m128 slopeRev[3], offsetRev[3], powerRev[3], saturationRev;
+    LoadRenderParams(this->m_renderParams, slopeRev, offsetRev, powerRev, saturationRev);
+
+    // Note: The alpha is left unchanged.
+    sseProcessPlanes(r, g, b, a, numPixels, [&](__m128 & rr, __m128 & gg, __m128 & bb, __m128 &)
+    {
+        __m128 pix[3] = { rr, gg, bb };
+
+        for (int c = 0; c < 3; ++c)
+        {
+            ApplyClamp<CLAMP>(pix[c]);
+        }
+
+        ApplySaturation(pix[0], pix[1], pix[2], saturationRev);
+
+        for (int c = 0; c < 3; ++c)
+        {
+            ApplyPower<CLAMP>(pix[c], powerRev[c]);
+
+            pix[c] = _mm_add_ps(pix[c], offsetRev[c]);
+            pix[c] = _mm_mul_ps(pix[c], slopeRev[c]);
+            ApplyClamp<CLAMP>(pix[c]);
+        }
+
+        rr = pix[0];
+        gg = pix[1];
+        bb = pix[2];
+    });
+}
 #endif
 
 template<bool CLAMP>
@@ -468,6 +599,29 @@ void CDLRendererRev<CLAMP>::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+template<bool CLAMP>
+void CDLRendererRev<CLAMP>::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                        long numPixels) const
+{
+    for (long idx = 0; idx<numPixels; ++idx)
+    {
+        float pix[3] = { r[idx], g[idx], b[idx] };
+
+        ApplyClamp<CLAMP>(pix);
+        ApplySaturation(pix, m_renderParams.getSaturation());
+
+        ApplyPower<CLAMP>(pix, m_renderParams.getPower());
+
+        ApplyOffset(pix, m_renderParams.getOffset());
+        ApplySlope(pix, m_renderParams.getSlope());
+        ApplyClamp<CLAMP>(pix);
+
+        r[idx] = pix[0];
+        g[idx] = pix[1];
+        b[idx] = pix[2];
+    }
+}
+
 // Note that if power is 1, the optimizer is able to convert the CDL op into a pair of matrices and
 // clamp (when needed).  So by default, the following will only get called when power is not 1.
 ConstOpCPURcPtr GetCDLCPURenderer(ConstCDLOpDataRcPtr & cdl, bool fastPower)
@@ -28,7 +28,10 @@ public:
     GammaBasicOpCPU(const GammaBasicOpCPU &) = delete;
     explicit GammaBasicOpCPU(ConstGammaOpDataRcPtr & gamma);
 
+    bool hasApplyPlanar() const override { return true; }
+
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -50,6 +53,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -61,6 +65,7 @@ public:
     explicit GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 
 #ifdef USE_SSE
@@ -73,6 +78,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -84,6 +90,7 @@ public:
     explicit GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 
 #ifdef USE_SSE
@@ -96,6 +103,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -104,6 +112,9 @@ class GammaMoncurveOpCPU : public OpCPU
 protected:
     explicit GammaMoncurveOpCPU(ConstGammaOpDataRcPtr &) : OpCPU() {}
 
+public:
+    bool hasApplyPlanar() const override { return true; }
+
 protected:
     RendererParams m_red;
     RendererParams m_green;
@@ -117,6 +128,7 @@ public:
     explicit GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -132,6 +144,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -141,6 +154,7 @@ public:
     explicit GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -157,6 +171,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -166,6 +181,7 @@ public:
     explicit GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -181,6 +197,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -190,6 +207,7 @@ public:
     explicit GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void update(ConstGammaOpDataRcPtr & gamma);
@@ -205,6 +223,7 @@ public:
     }
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -337,6 +356,23 @@ void GammaBasicOpCPUSSE::apply(const void * inImg, void * outImg, long numPixels
         out += 4;
     }
 }
+
+void GammaBasicOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                     long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 gamma = _mm_set1_ps(gammas[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            return ssePower(pixel, gamma);
+        });
+    }
+}
 #endif // USE_SSE
 
 void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -361,6 +397,24 @@ void GammaBasicOpCPU::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void GammaBasicOpCPU::applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const float gamma = gammas[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = std::max(0.0f, values[idx]);
+            values[idx] = std::pow(pixel, gamma);
+        }
+    }
+}
+
 GammaBasicMirrorOpCPU::GammaBasicMirrorOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
@@ -389,6 +443,27 @@ void GammaBasicMirrorOpCPUSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaBasicMirrorOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 gamma = _mm_set1_ps(gammas[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+            __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+            pixel = ssePower(abs_pix, gamma);
+            return _mm_or_ps(sign_pix, pixel);
+        });
+    }
+}
 #endif
 
 void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -413,6 +488,26 @@ void GammaBasicMirrorOpCPU::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaBasicMirrorOpCPU::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const float gamma = gammas[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, values[idx]);
+            const float pixel = std::fabs(values[idx]);
+            values[idx] = sign * std::pow(pixel, gamma);
+        }
+    }
+}
+
 GammaBasicPassThruOpCPU::GammaBasicPassThruOpCPU(ConstGammaOpDataRcPtr & gamma)
     : GammaBasicOpCPU(gamma)
 {
@@ -445,6 +540,29 @@ void GammaBasicPassThruOpCPUSSE::apply(const void * inImg, void * outImg, long n
         out += 4;
     }
 }
+
+void GammaBasicPassThruOpCPUSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                             long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 gamma = _mm_set1_ps(gammas[c]);
+        const __m128 breakPnt = _mm_set1_ps(0.0f);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 data = ssePower(pixel, gamma);
+
+            __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+
+            return _mm_or_ps(_mm_and_ps(flag, data),
+                             _mm_andnot_ps(flag, pixel));
+        });
+    }
+}
 #endif
 
 void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
@@ -466,6 +584,25 @@ void GammaBasicPassThruOpCPU::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void GammaBasicPassThruOpCPU::applyPlanar(float * r, float * g, float * b, float * a,
+                                          long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const float gammas[4] = { m_redGamma, m_grnGamma, m_bluGamma, m_alpGamma };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const float gamma = gammas[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = values[idx];
+            values[idx] = pixel > 0.f ? std::pow(pixel, gamma) : pixel;
+        }
+    }
+}
+
 GammaMoncurveOpCPUFwd::GammaMoncurveOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -520,6 +657,34 @@ void GammaMoncurveOpCPUFwdSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaMoncurveOpCPUFwdSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 scale    = _mm_set1_ps(params[c]->scale);
+        const __m128 offset   = _mm_set1_ps(params[c]->offset);
+        const __m128 gamma    = _mm_set1_ps(params[c]->gamma);
+        const __m128 breakPnt = _mm_set1_ps(params[c]->breakPnt);
+        const __m128 slope    = _mm_set1_ps(params[c]->slope);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 data = _mm_add_ps(_mm_mul_ps(pixel, scale), offset);
+
+            data = ssePower(data, gamma);
+
+            __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+
+            return _mm_or_ps(_mm_and_ps(flag, data),
+                             _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
+        });
+    }
+}
 #endif // USE_SSE
 
 void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
@@ -555,6 +720,26 @@ void GammaMoncurveOpCPUFwd::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaMoncurveOpCPUFwd::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const RendererParams & p = *params[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = values[idx];
+            const float data = std::pow(pixel * p.scale + p.offset, p.gamma);
+            values[idx] = pixel <= p.breakPnt ? pixel * p.slope : data;
+        }
+    }
+}
+
 GammaMoncurveOpCPURev::GammaMoncurveOpCPURev(ConstGammaOpDataRcPtr & gamma)
     :   GammaMoncurveOpCPU(gamma)
 {
@@ -609,6 +794,34 @@ void GammaMoncurveOpCPURevSSE::apply(const void * inImg, void * outImg, long num
         out += 4;
     }
 }
+
+void GammaMoncurveOpCPURevSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 scale    = _mm_set1_ps(params[c]->scale);
+        const __m128 offset   = _mm_set1_ps(params[c]->offset);
+        const __m128 gamma    = _mm_set1_ps(params[c]->gamma);
+        const __m128 breakPnt = _mm_set1_ps(params[c]->breakPnt);
+        const __m128 slope    = _mm_set1_ps(params[c]->slope);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 data = ssePower(pixel, gamma);
+
+            data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
+
+            __m128 flag = _mm_cmpgt_ps(pixel, breakPnt);
+
+            return _mm_or_ps(_mm_and_ps(flag, data),
+                             _mm_andnot_ps(flag, _mm_mul_ps(pixel, slope)));
+        });
+    }
+}
 #endif
 
 void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
@@ -644,6 +857,26 @@ void GammaMoncurveOpCPURev::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void GammaMoncurveOpCPURev::applyPlanar(float * r, float * g, float * b, float * a,
+                                        long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const RendererParams & p = *params[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float pixel = values[idx];
+            const float data = std::pow(pixel, p.gamma) * p.scale - p.offset;
+            values[idx] = pixel <= p.breakPnt ? pixel * p.slope : data;
+        }
+    }
+}
+
 GammaMoncurveMirrorOpCPUFwd::GammaMoncurveMirrorOpCPUFwd(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -702,6 +935,39 @@ void GammaMoncurveMirrorOpCPUFwdSSE::apply(const void * inImg, void * outImg, lo
         out += 4;
     }
 }
+
+void GammaMoncurveMirrorOpCPUFwdSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                                 long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 scale    = _mm_set1_ps(params[c]->scale);
+        const __m128 offset   = _mm_set1_ps(params[c]->offset);
+        const __m128 gamma    = _mm_set1_ps(params[c]->gamma);
+        const __m128 breakPnt = _mm_set1_ps(params[c]->breakPnt);
+        const __m128 slope    = _mm_set1_ps(params[c]->slope);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+            __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+            __m128 data = _mm_add_ps(_mm_mul_ps(abs_pix, scale), offset);
+
+            data = ssePower(data, gamma);
+
+            __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
+
+            data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                             _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, slope)));
+
+            return _mm_or_ps(sign_pix, data);
+        });
+    }
+}
 #endif
 
 void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long numPixels) const
@@ -720,7 +986,7 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
     for (long idx = 0; idx<numPixels; ++idx)
     {
         const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[0]), std::copysign(1.0f, in[3]) };
+                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
 
         const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
                                  std::fabs(in[2]), std::fabs(in[3]) };
@@ -740,6 +1006,27 @@ void GammaMoncurveMirrorOpCPUFwd::apply(const void * inImg, void * outImg, long
     }
 }
 
+void GammaMoncurveMirrorOpCPUFwd::applyPlanar(float * r, float * g, float * b, float * a,
+                                              long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const RendererParams & p = *params[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, values[idx]);
+            const float pixel = std::fabs(values[idx]);
+            const float data = std::pow(pixel * p.scale + p.offset, p.gamma);
+            values[idx] = sign * (pixel <= p.breakPnt ? pixel * p.slope : data);
+        }
+    }
+}
+
 GammaMoncurveMirrorOpCPURev::GammaMoncurveMirrorOpCPURev(ConstGammaOpDataRcPtr & gamma)
     : GammaMoncurveOpCPU(gamma)
 {
@@ -798,6 +1085,39 @@ void GammaMoncurveMirrorOpCPURevSSE::apply(const void * inImg, void * outImg, lo
         out += 4;
     }
 }
+
+void GammaMoncurveMirrorOpCPURevSSE::applyPlanar(float * r, float * g, float * b, float * a,
+                                                 long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 scale    = _mm_set1_ps(params[c]->scale);
+        const __m128 offset   = _mm_set1_ps(params[c]->offset);
+        const __m128 gamma    = _mm_set1_ps(params[c]->gamma);
+        const __m128 breakPnt = _mm_set1_ps(params[c]->breakPnt);
+        const __m128 slope    = _mm_set1_ps(params[c]->slope);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 pixel)
+        {
+            __m128 sign_pix = _mm_and_ps(pixel, ESIGN_MASK);
+            __m128 abs_pix = _mm_and_ps(pixel, EABS_MASK);
+
+            __m128 data = ssePower(abs_pix, gamma);
+
+            data = _mm_sub_ps(_mm_mul_ps(data, scale), offset);
+
+            __m128 flagbrk = _mm_cmpgt_ps(abs_pix, breakPnt);
+
+            data = _mm_or_ps(_mm_and_ps(flagbrk, data),
+                             _mm_andnot_ps(flagbrk, _mm_mul_ps(abs_pix, slope)));
+
+            return _mm_or_ps(sign_pix, data);
+        });
+    }
+}
 #endif
 
 void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long numPixels) const
@@ -817,7 +1137,7 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
     for (long idx = 0; idx<numPixels; ++idx)
     {
         const float sign[4] = { std::copysign(1.0f, in[0]), std::copysign(1.0f, in[1]),
-                                std::copysign(1.0f, in[0]), std::copysign(1.0f, in[3]) };
+                                std::copysign(1.0f, in[2]), std::copysign(1.0f, in[3]) };
 
         const float pixel[4] = { std::fabs(in[0]), std::fabs(in[1]),
                                  std::fabs(in[2]), std::fabs(in[3]) };
@@ -837,4 +1157,25 @@ void GammaMoncurveMirrorOpCPURev::apply(const void * inImg, void * outImg, long
     }
 }
 
+void GammaMoncurveMirrorOpCPURev::applyPlanar(float * r, float * g, float * b, float * a,
+                                              long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+    const RendererParams * params[4] = { &m_red, &m_green, &m_blue, &m_alpha };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const RendererParams & p = *params[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float sign = std::copysign(1.0f, values[idx]);
+            const float pixel = std::fabs(values[idx]);
+            const float data = std::pow(pixel, p.gamma) * p.scale - p.offset;
+            values[idx] = sign * (pixel <= p.breakPnt ? pixel * p.slope : data);
+        }
+    }
+}
+
 } // namespace OCIO_NAMESPACE
\ No newline at end of file
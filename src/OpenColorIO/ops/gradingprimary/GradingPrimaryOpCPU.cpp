@@ -252,7 +252,9 @@ GradingPrimaryLogFwdOpCPU::GradingPrimaryLogFwdOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -264,8 +266,8 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -431,7 +433,9 @@ GradingPrimaryLogRevOpCPU::GradingPrimaryLogRevOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -443,8 +447,8 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -605,7 +609,9 @@ GradingPrimaryLinFwdOpCPU::GradingPrimaryLinFwdOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -617,8 +623,8 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isContrastIdentity = comp.isContrastIdentity();
 
@@ -779,7 +785,9 @@ GradingPrimaryLinRevOpCPU::GradingPrimaryLinRevOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -791,8 +799,8 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isContrastIdentity = comp.isContrastIdentity();
 
@@ -947,7 +955,9 @@ GradingPrimaryVidFwdOpCPU::GradingPrimaryVidFwdOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -959,8 +969,8 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -1127,7 +1137,9 @@ GradingPrimaryVidRevOpCPU::GradingPrimaryVidRevOpCPU(ConstGradingPrimaryOpDataRc
 
 void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gp->getLocalBypass())
+    const DynamicPropertyGradingPrimaryImpl::RenderBuffer::Reader values(m_gp->getRenderBuffer());
+
+    if (values->m_preRenderValues.getLocalBypass())
     {
         if (inImg != outImg)
         {
@@ -1139,8 +1151,8 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    auto & v = values->m_value;
+    auto & comp = values->m_preRenderValues;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -111,7 +111,10 @@ static constexpr auto PixelSize = 4 * sizeof(float);
 
 void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    const DynamicPropertyGradingRGBCurveImpl::RenderBuffer::Reader values(
+        m_grgbcurve->getRenderBuffer());
+
+    if (values->m_knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -125,7 +128,7 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        eval(m_grgbcurve->getKnotsCoefs(), out, in);
+        eval(values->m_knotsCoefs, out, in);
 
         out[3] = in[3];
 
@@ -236,7 +239,10 @@ inline void LogLin(float * out)
 
 void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    const DynamicPropertyGradingRGBCurveImpl::RenderBuffer::Reader values(
+        m_grgbcurve->getRenderBuffer());
+
+    if (values->m_knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -253,7 +259,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         LinLog(in, out);
 
         // Curves.
-        eval(m_grgbcurve->getKnotsCoefs(), out, out);
+        eval(values->m_knotsCoefs, out, out);
 
         LogLin(out);
 
@@ -281,7 +287,10 @@ GradingRGBCurveRevOpCPU::GradingRGBCurveRevOpCPU(ConstGradingRGBCurveOpDataRcPtr
 
 void GradingRGBCurveRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    const DynamicPropertyGradingRGBCurveImpl::RenderBuffer::Reader values(
+        m_grgbcurve->getRenderBuffer());
+
+    if (values->m_knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -295,7 +304,7 @@ void GradingRGBCurveRevOpCPU::apply(const void * inImg, void * outImg, long numP
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        evalRev(m_grgbcurve->getKnotsCoefs(), out, in);
+        evalRev(values->m_knotsCoefs, out, in);
 
         out[3] = in[3];
 
@@ -321,7 +330,10 @@ GradingRGBCurveLinearRevOpCPU::GradingRGBCurveLinearRevOpCPU(ConstGradingRGBCurv
 
 void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    const DynamicPropertyGradingRGBCurveImpl::RenderBuffer::Reader values(
+        m_grgbcurve->getRenderBuffer());
+
+    if (values->m_knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -338,7 +350,7 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
         LinLog(in, out);
 
         // Curves.
-        evalRev(m_grgbcurve->getKnotsCoefs(), out, out);
+        evalRev(values->m_knotsCoefs, out, out);
 
         LogLin(out);
 
@@ -943,7 +943,9 @@ static constexpr auto PixelSize = 4 * sizeof(float);
 
 void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gt->getLocalBypass())
+    const DynamicPropertyGradingToneImpl::RenderBuffer::Reader values(m_gt->getRenderBuffer());
+
+    if (values->m_preRenderValues.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -955,8 +957,8 @@ void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    auto & v = values->m_value;
+    auto & vpr = values->m_preRenderValues;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1000,7 +1002,9 @@ void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixel
 void GradingToneRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
 
-    if (m_gt->getLocalBypass())
+    const DynamicPropertyGradingToneImpl::RenderBuffer::Reader values(m_gt->getRenderBuffer());
+
+    if (values->m_preRenderValues.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -1012,8 +1016,8 @@ void GradingToneRevOpCPU::apply(const void * inImg, void * outImg, long numPixel
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    auto & v = values->m_value;
+    auto & vpr = values->m_preRenderValues;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1140,7 +1144,9 @@ inline void LogLin(float * out)
 
 void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gt->getLocalBypass())
+    const DynamicPropertyGradingToneImpl::RenderBuffer::Reader values(m_gt->getRenderBuffer());
+
+    if (values->m_preRenderValues.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -1152,8 +1158,8 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    auto & v = values->m_value;
+    auto & vpr = values->m_preRenderValues;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1197,7 +1203,9 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
 
 void GradingToneLinearRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_gt->getLocalBypass())
+    const DynamicPropertyGradingToneImpl::RenderBuffer::Reader values(m_gt->getRenderBuffer());
+
+    if (values->m_preRenderValues.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -1209,8 +1217,8 @@ void GradingToneLinearRevOpCPU::apply(const void * inImg, void * outImg, long nu
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    auto & v = values->m_value;
+    auto & vpr = values->m_preRenderValues;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
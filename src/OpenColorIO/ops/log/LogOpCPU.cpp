@@ -28,6 +28,8 @@ public:
 
     explicit LogOpCPU(ConstLogOpDataRcPtr & log);
 
+    bool hasApplyPlanar() const override { return true; }
+
 protected:
     // Update renderer parameters.
     virtual void updateData(ConstLogOpDataRcPtr & log);
@@ -56,6 +58,7 @@ public:
     explicit Log2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -73,6 +76,7 @@ public:
     explicit Log2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -83,6 +87,7 @@ public:
     explicit Lin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -100,6 +105,7 @@ public:
     explicit Lin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -124,6 +130,7 @@ public:
     explicit CameraLog2LinRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -143,6 +150,7 @@ public:
     explicit CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -153,6 +161,7 @@ public:
     explicit CameraLin2LogRenderer(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     void updateData(ConstLogOpDataRcPtr & log) override;
@@ -171,6 +180,7 @@ public:
     explicit CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -181,6 +191,7 @@ public:
     explicit LogRenderer(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     float m_logScale;
@@ -193,6 +204,7 @@ public:
     explicit LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -203,6 +215,7 @@ public:
     explicit AntiLogRenderer(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 
 protected:
     float m_log2_base;
@@ -215,6 +228,7 @@ public:
     explicit AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base);
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
 };
 #endif
 
@@ -413,6 +427,23 @@ void LogRenderer::apply(const void * inImg, void * outImg, long numPixels) const
     }
 }
 
+void LogRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                              long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float value = log2(std::max(minValue, values[idx]));
+            values[idx] = value * m_logScale;
+        }
+    }
+}
+
 #ifdef USE_SSE
 LogRendererSSE::LogRendererSSE(ConstLogOpDataRcPtr & log, float logScale)
     : LogRenderer(log, logScale)
@@ -449,6 +480,27 @@ void LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels) co
         out += 4;
     }
 }
+
+void LogRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                 long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+    const __m128 mm_logScale = _mm_set1_ps(m_logScale);
+
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        sseProcessPlane(values, numPixels, [&](__m128 mm_pixel)
+        {
+            mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+            mm_pixel = sseLog2(mm_pixel);
+            return _mm_mul_ps(mm_pixel, mm_logScale);
+        });
+    }
+}
 #endif
 
 // Renderer for AntiLog10 and AntiLog2 operations
@@ -481,6 +533,20 @@ void AntiLogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void AntiLogRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                  long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            values[idx] = exp2(values[idx] * m_log2_base);
+        }
+    }
+}
+
 #ifdef USE_SSE
 AntiLogRendererSSE::AntiLogRendererSSE(ConstLogOpDataRcPtr & log, float log2base)
     : AntiLogRenderer(log, log2base)
@@ -518,6 +584,22 @@ void AntiLogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         out += 4;
     }
 }
+
+void AntiLogRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                     long numPixels) const
+{
+    const __m128 mm_log2_base = _mm_set1_ps(m_log2_base);
+
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        sseProcessPlane(values, numPixels, [&](__m128 mm_pixel)
+        {
+            return sseExp2(_mm_mul_ps(mm_pixel, mm_log2_base));
+        });
+    }
+}
 #endif
 
 // Renderer for LogToLin operations
@@ -571,6 +653,24 @@ void Log2LinRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Log2LinRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                  long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        float * values = planes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            float value = (values[idx] + m_minuskb[c]) * m_kinv[c];
+            value = exp2(value);
+            values[idx] = (value + m_minusb[c]) * m_minv[c];
+        }
+    }
+}
+
 #ifdef USE_SSE
 Log2LinRendererSSE::Log2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : Log2LinRenderer(log)
@@ -618,6 +718,29 @@ void Log2LinRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Log2LinRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                     long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_kinv = _mm_set1_ps(m_kinv[c]);
+        const __m128 mm_minuskb = _mm_set1_ps(m_minuskb[c]);
+        const __m128 mm_minusb = _mm_set1_ps(m_minusb[c]);
+        const __m128 mm_minv = _mm_set1_ps(m_minv[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 mm_pixel)
+        {
+            mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
+            mm_pixel = sseExp2(mm_pixel);
+            mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
+            return _mm_mul_ps(mm_pixel, mm_minv);
+        });
+    }
+}
 #endif
 
 // Renderer for Lin2Log operations
@@ -673,6 +796,26 @@ void Lin2LogRenderer::apply(const void * inImg, void * outImg, long numPixels) c
     }
 }
 
+void Lin2LogRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                  long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        float * values = planes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            float value = values[idx] * m_m[c] + m_b[c];
+            value = log2(std::max(minValue, value));
+            values[idx] = value * m_klog[c] + m_kb[c];
+        }
+    }
+}
+
 #ifdef USE_SSE
 Lin2LogRendererSSE::Lin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : Lin2LogRenderer(log)
@@ -718,6 +861,34 @@ void Lin2LogRendererSSE::apply(const void * inImg, void * outImg, long numPixels
         in  += 4;
     }
 }
+
+void Lin2LogRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                     long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_m = _mm_set1_ps(m_m[c]);
+        const __m128 mm_b = _mm_set1_ps(m_b[c]);
+        const __m128 mm_klog = _mm_set1_ps(m_klog[c]);
+        const __m128 mm_kb = _mm_set1_ps(m_kb[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 mm_pixel)
+        {
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
+            mm_pixel = _mm_add_ps(mm_pixel, mm_b);
+            mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+            mm_pixel = sseLog2(mm_pixel);
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
+            return _mm_add_ps(mm_pixel, mm_kb);
+        });
+    }
+}
 #endif
 
 CameraL2LBaseRenderer::CameraL2LBaseRenderer(ConstLogOpDataRcPtr & log)
@@ -801,6 +972,32 @@ void CameraLog2LinRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLog2LinRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                        long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        float * values = planes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float in = values[idx];
+            if (in < m_logSideBreak[c])
+            {
+                values[idx] = m_linsinv[c] * (in + m_minuslino[c]);
+            }
+            else
+            {
+                float value = (in + m_minuskb[c]) * m_kinv[c];
+                value = exp2(value);
+                values[idx] = (value + m_minusb[c]) * m_minv[c];
+            }
+        }
+    }
+}
+
 #ifdef USE_SSE
 CameraLog2LinRendererSSE::CameraLog2LinRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLog2LinRenderer(log)
@@ -857,6 +1054,40 @@ void CameraLog2LinRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLog2LinRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                           long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_kinv = _mm_set1_ps(m_kinv[c]);
+        const __m128 mm_minuskb = _mm_set1_ps(m_minuskb[c]);
+        const __m128 mm_minusb = _mm_set1_ps(m_minusb[c]);
+        const __m128 mm_minv = _mm_set1_ps(m_minv[c]);
+        const __m128 breakPnt = _mm_set1_ps(m_logSideBreak[c]);
+        const __m128 mm_linoinv = _mm_set1_ps(m_minuslino[c]);
+        const __m128 mm_linsinv = _mm_set1_ps(m_linsinv[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 mm_pixel)
+        {
+            __m128 flag = _mm_cmpgt_ps(mm_pixel, breakPnt);
+
+            __m128 mm_pixel_lin = _mm_add_ps(mm_pixel, mm_linoinv);
+            mm_pixel_lin = _mm_mul_ps(mm_pixel_lin, mm_linsinv);
+
+            mm_pixel = _mm_add_ps(mm_pixel, mm_minuskb);
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_kinv);
+            mm_pixel = sseExp2(mm_pixel);
+            mm_pixel = _mm_add_ps(mm_pixel, mm_minusb);
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_minv);
+
+            return _mm_or_ps(_mm_and_ps(flag, mm_pixel),
+                             _mm_andnot_ps(flag, mm_pixel_lin));
+        });
+    }
+}
 #endif
 
 CameraLin2LogRenderer::CameraLin2LogRenderer(ConstLogOpDataRcPtr & log)
@@ -919,6 +1150,35 @@ void CameraLin2LogRenderer::apply(const void * inImg, void * outImg, long numPix
     }
 }
 
+void CameraLin2LogRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                        long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        float * values = planes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            const float in = values[idx];
+            if (in < m_linb[c])
+            {
+                values[idx] = m_linearSlope[c] * in + m_linearOffset[c];
+            }
+            else
+            {
+                float value = in * m_m[c] + m_b[c];
+                value = std::max(minValue, value);
+                value = log2(value);
+                values[idx] = value * m_klog[c] + m_kb[c];
+            }
+        }
+    }
+}
+
 #ifdef USE_SSE
 CameraLin2LogRendererSSE::CameraLin2LogRendererSSE(ConstLogOpDataRcPtr & log)
     : CameraLin2LogRenderer(log)
@@ -979,6 +1239,45 @@ void CameraLin2LogRendererSSE::apply(const void * inImg, void * outImg, long num
         in += 4;
     }
 }
+
+void CameraLin2LogRendererSSE::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                           long numPixels) const
+{
+    static constexpr float minValue = std::numeric_limits<float>::min();
+
+    const __m128 mm_minValue = _mm_set1_ps(minValue);
+
+    float * planes[3] = { r, g, b };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const __m128 mm_m = _mm_set1_ps(m_m[c]);
+        const __m128 mm_b = _mm_set1_ps(m_b[c]);
+        const __m128 mm_klog = _mm_set1_ps(m_klog[c]);
+        const __m128 mm_kb = _mm_set1_ps(m_kb[c]);
+        const __m128 mm_lins = _mm_set1_ps(m_linearSlope[c]);
+        const __m128 mm_lino = _mm_set1_ps(m_linearOffset[c]);
+        const __m128 breakPnt = _mm_set1_ps(m_linb[c]);
+
+        sseProcessPlane(planes[c], numPixels, [&](__m128 mm_pixel)
+        {
+            __m128 flag = _mm_cmpgt_ps(mm_pixel, breakPnt);
+
+            __m128 mm_pixel_lin = _mm_mul_ps(mm_pixel, mm_lins);
+            mm_pixel_lin = _mm_add_ps(mm_pixel_lin, mm_lino);
+
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_m);
+            mm_pixel = _mm_add_ps(mm_pixel, mm_b);
+            mm_pixel = _mm_max_ps(mm_pixel, mm_minValue);
+            mm_pixel = sseLog2(mm_pixel);
+            mm_pixel = _mm_mul_ps(mm_pixel, mm_klog);
+            mm_pixel = _mm_add_ps(mm_pixel, mm_kb);
+
+            return _mm_or_ps(_mm_and_ps(flag, mm_pixel),
+                             _mm_andnot_ps(flag, mm_pixel_lin));
+        });
+    }
+}
 #endif
 
 } // namespace OCIO_NAMESPACE
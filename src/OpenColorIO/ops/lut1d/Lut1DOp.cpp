@@ -17,6 +17,7 @@
 #include "ops/lut1d/Lut1DOpGPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/OpTools.h"
+#include "Profiling.h"
 #include "SSE.h"
 #include "transforms/Lut1DTransform.h"
 
@@ -122,6 +123,8 @@ void Lut1DOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
     // We want compose to upsample the LUTs to minimize precision loss.
     const auto compFlag = Lut1DOpData::COMPOSE_RESAMPLE_BIG;
     auto thisLut = lut1DData();
+
+    ProfilingTimer timer(&ProcessorProfile::m_lutCompositionTime, ProfilingTimer::DETAIL);
     Lut1DOpDataRcPtr result =  Lut1DOpData::Compose(thisLut, secondLut, compFlag);
     auto composedOp = std::make_shared<Lut1DOp>(result);
     ops.push_back(composedOp);
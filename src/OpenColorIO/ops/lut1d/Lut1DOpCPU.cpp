@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "HalfConversion.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/OpTools.h"
@@ -119,6 +120,8 @@ struct IndexPair
     }
 
     static IndexPair GetEdgeFloatValues(float fIn);
+    // Note: halfIn must be the conversion of fIn.
+    static IndexPair GetEdgeFloatValues(float fIn, half halfIn);
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -354,9 +357,15 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
 
         m_dim = newLut->getArray().getLength();
 
-        m_tmpLutR = new T[m_dim];
-        m_tmpLutG = new T[m_dim];
-        m_tmpLutB = new T[m_dim];
+        // The input values index the look-up tables so the tables cover all the values the
+        // input type could hold (e.g. above 1023 for 10-bit) and the out-of-range ones are
+        // clamped to the last entry. Note that the look-up input types are 8 or 16 bits.
+        typedef typename BitDepthInfo<inBD>::Type InType;
+        const unsigned long numEntries = std::max(m_dim, sizeof(InType) == 1 ? 256ul : 65536ul);
+
+        m_tmpLutR = new T[numEntries];
+        m_tmpLutG = new T[numEntries];
+        m_tmpLutB = new T[numEntries];
 
         const Array::Values & lutValues = newLut->getArray().getValues();
 
@@ -367,6 +376,10 @@ void BaseLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
             ((T*)m_tmpLutG)[i] = L_ADJUST(lutValues[i*3+1] * outMax);
             ((T*)m_tmpLutB)[i] = L_ADJUST(lutValues[i*3+2] * outMax);
         }
+
+        std::fill((T*)m_tmpLutR + m_dim, (T*)m_tmpLutR + numEntries, ((T*)m_tmpLutR)[m_dim - 1]);
+        std::fill((T*)m_tmpLutG + m_dim, (T*)m_tmpLutG + numEntries, ((T*)m_tmpLutG)[m_dim - 1]);
+        std::fill((T*)m_tmpLutB + m_dim, (T*)m_tmpLutB + numEntries, ((T*)m_tmpLutB)[m_dim - 1]);
     }
     else
     {
@@ -484,11 +497,24 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
         const float * lutG = (const float *)this->m_tmpLutG;
         const float * lutB = (const float *)this->m_tmpLutB;
 
+        // The input values are converted to half by blocks of pixels.
+        static constexpr long BlockSize = 64;
+        half halfIn[4 * BlockSize];
+
         for(long idx=0; idx<numPixels; ++idx)
         {
-            const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(in[0]);
-            const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(in[1]);
-            const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(in[2]);
+            const long blockIdx = idx % BlockSize;
+            if (blockIdx == 0)
+            {
+                const long num = std::min(long(BlockSize), numPixels - idx);
+                ConvertFloatToHalf((const float *)in, halfIn, 4 * size_t(num));
+            }
+
+            const half * h = &halfIn[4 * blockIdx];
+
+            const IndexPair redInterVals   = IndexPair::GetEdgeFloatValues(in[0], h[0]);
+            const IndexPair greenInterVals = IndexPair::GetEdgeFloatValues(in[1], h[1]);
+            const IndexPair blueInterVals  = IndexPair::GetEdgeFloatValues(in[2], h[2]);
 
             // Since fraction is in the domain [0, 1), interpolate using
             // 1-fraction in order to avoid cases like -/+Inf * 0.
@@ -516,13 +542,17 @@ void Lut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * outImg
 }
 
 IndexPair IndexPair::GetEdgeFloatValues(float fIn)
+{
+    return GetEdgeFloatValues(fIn, half(fIn));
+}
+
+IndexPair IndexPair::GetEdgeFloatValues(float fIn, half halfIn)
 {
     // TODO: Could we speed this up (perhaps alternate nan/inf behavior)?
 
-    half halfVal;
+    half halfVal = halfIn;
     IndexPair idxPair;
 
-    halfVal = half( fIn );
     if(halfVal.isInfinity())
     {
         halfVal = halfVal.isNegative() ? -HALF_MAX : HALF_MAX;
@@ -6,6 +6,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "AsyncProcessor.h"
 #include "BitDepthUtils.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
@@ -15,6 +16,7 @@
 #include "ops/matrix/MatrixOp.h"
 #include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
+#include "Profiling.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -766,6 +768,10 @@ Lut1DOpDataRcPtr MakeFastLut1DFromInverse(ConstLut1DOpDataRcPtr & lut)
         throw Exception("MakeFastLut1DFromInverse expects an inverse 1D LUT");
     }
 
+    ThrowIfCancelled();
+
+    ProfilingTimer timer(&ProcessorProfile::m_inverseLutTime, ProfilingTimer::DETAIL);
+
     auto depth = lut->getFileOutputBitDepth();
     if (depth == BIT_DEPTH_UNKNOWN || depth == BIT_DEPTH_UINT14 || depth == BIT_DEPTH_UINT32)
     {
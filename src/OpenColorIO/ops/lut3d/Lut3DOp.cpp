@@ -17,6 +17,7 @@
 #include "ops/lut3d/Lut3DOpGPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/OpTools.h"
+#include "Profiling.h"
 #include "transforms/Lut3DTransform.h"
 
 namespace OCIO_NAMESPACE
@@ -174,6 +175,8 @@ void Lut3DOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
     ConstLut3DOpRcPtr typedRcPtr = DynamicPtrCast<const Lut3DOp>(secondOp);
     auto secondLut = typedRcPtr->lut3DData();
     auto thisLut = lut3DData();
+
+    ProfilingTimer timer(&ProcessorProfile::m_lutCompositionTime, ProfilingTimer::DETAIL);
     auto composed = Lut3DOpData::Compose(thisLut, secondLut);
     auto composedOp = std::make_shared<Lut3DOp>(composed);
     ops.push_back(composedOp);
@@ -53,7 +53,15 @@ public:
     explicit Lut3DTetrahedralRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~Lut3DTetrahedralRenderer();
 
-    void apply(const void * inImg, void * outImg, long numPixels) const;
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    // Process RGBA or RGB (i.e. alpha is then zero) pixels.
+    template<int numChannels>
+    void process(const float * in, float * out, long numPixels) const;
 };
 
 class Lut3DRenderer : public BaseLut3DRenderer
@@ -62,7 +70,15 @@ public:
     explicit Lut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~Lut3DRenderer();
 
-    void apply(const void * inImg, void * outImg, long numPixels) const;
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+private:
+    // Process RGBA or RGB (i.e. alpha is then zero) pixels.
+    template<int numChannels>
+    void process(const float * in, float * out, long numPixels) const;
 
 };
 
@@ -381,9 +397,17 @@ Lut3DTetrahedralRenderer::~Lut3DTetrahedralRenderer()
 
 void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+void Lut3DTetrahedralRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
 
+template<int numChannels>
+void Lut3DTetrahedralRenderer::process(const float * in, float * out, long numPixels) const
+{
 #ifdef USE_SSE
 
     __m128 step = _mm_set1_ps(m_step);
@@ -395,9 +419,9 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = numChannels == 4 ? in[3] : 0.0f;
 
-        __m128 data = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 data = _mm_set_ps(newAlpha, in[2], in[1], in[0]);
 
         __m128 idx = _mm_mul_ps(data, step);
 
@@ -584,19 +608,25 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
         __m128 result = _mm_add_ps(_mm_add_ps(v[0], _mm_mul_ps(delta0, dv0)),
             _mm_add_ps(_mm_mul_ps(delta1, dv1), _mm_mul_ps(delta2, dv2)));
 
-        _mm_storeu_ps(out, result);
-
-        out[3] = newAlpha;
+        if (numChannels == 4)
+        {
+            _mm_storeu_ps(out, result);
+            out[3] = newAlpha;
+        }
+        else
+        {
+            sseStoreRGB(out, result);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += numChannels;
+        out += numChannels;
     }
 #else
     const float dimMinusOne = float(m_dim) - 1.f;
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = numChannels == 4 ? in[3] : 0.0f;
 
         float idx[3];
         idx[0] = in[0] * m_step;
@@ -777,10 +807,13 @@ void Lut3DTetrahedralRenderer::apply(const void * inImg, void * outImg, long num
             }
         }
 
-        out[3] = newAlpha;
+        if (numChannels == 4)
+        {
+            out[3] = newAlpha;
+        }
 
-        in  += 4;
-        out += 4;
+        in  += numChannels;
+        out += numChannels;
     }
 #endif
 }
@@ -796,9 +829,17 @@ Lut3DRenderer::~Lut3DRenderer()
 
 void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
+    process<4>((const float *)inImg, (float *)outImg, numPixels);
+}
 
+void Lut3DRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    process<3>((const float *)inImg, (float *)outImg, numPixels);
+}
+
+template<int numChannels>
+void Lut3DRenderer::process(const float * in, float * out, long numPixels) const
+{
 #ifdef USE_SSE
 
     __m128 step = _mm_set1_ps(m_step);
@@ -809,9 +850,9 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = numChannels == 4 ? in[3] : 0.0f;
 
-        __m128 data = _mm_set_ps(in[3], in[2], in[1], in[0]);
+        __m128 data = _mm_set_ps(newAlpha, in[2], in[1], in[0]);
 
         __m128 idx = _mm_mul_ps(data, step);
 
@@ -892,19 +933,25 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
         __m128 result = _mm_add_ps(_mm_mul_ps(green1, oneMinusWr),
             _mm_mul_ps(green2, wr));
 
-        _mm_storeu_ps(out, result);
-
-        out[3] = newAlpha;
+        if (numChannels == 4)
+        {
+            _mm_storeu_ps(out, result);
+            out[3] = newAlpha;
+        }
+        else
+        {
+            sseStoreRGB(out, result);
+        }
 
-        in  += 4;
-        out += 4;
+        in  += numChannels;
+        out += numChannels;
     }
 #else
     const float dimMinusOne = float(m_dim) - 1.f;
 
     for (long i = 0; i < numPixels; ++i)
     {
-        float newAlpha = (float)in[3];
+        const float newAlpha = numChannels == 4 ? in[3] : 0.0f;
 
         float idx[3];
         idx[0] = in[0] * m_step;
@@ -973,10 +1020,13 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
                  &m_optLut[n110], &m_optLut[n111],
                  x, y, z);
 
-        out[3] = newAlpha;
+        if (numChannels == 4)
+        {
+            out[3] = newAlpha;
+        }
 
-        in  += 4;
-        out += 4;
+        in  += numChannels;
+        out += numChannels;
     }
 #endif
 }
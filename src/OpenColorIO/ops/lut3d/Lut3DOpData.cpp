@@ -5,6 +5,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "AsyncProcessor.h"
 #include "BitDepthUtils.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
@@ -14,6 +15,7 @@
 #include "ops/OpTools.h"
 #include "ops/range/RangeOpData.h"
 #include "Platform.h"
+#include "Profiling.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -35,6 +37,10 @@ Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
         throw Exception("MakeFastLut3DFromInverse expects an inverse LUT");
     }
 
+    ThrowIfCancelled();
+
+    ProfilingTimer timer(&ProcessorProfile::m_inverseLutTime, ProfilingTimer::DETAIL);
+
     // TODO: The FastLut will limit inputs to [0,1].  If the forward LUT has an extended range
     // output, perhaps add a Range op before the FastLut to bring values into [0,1].
 
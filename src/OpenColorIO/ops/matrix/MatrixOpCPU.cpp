@@ -23,6 +23,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyPlanar() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_scale[4];
 };
@@ -36,6 +42,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyPlanar() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
@@ -50,6 +62,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyPlanar() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
 
     float m_column1[4];
@@ -69,6 +87,12 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasApplyRGB() const override { return true; }
+    void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasApplyPlanar() const override { return true; }
+    void applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const override;
+
 private:
     float m_column1[4];
     float m_column2[4];
@@ -104,6 +128,38 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0];
+        out[1] = in[1] * m_scale[1];
+        out[2] = in[2] * m_scale[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void ScaleRenderer::applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const float scale = m_scale[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            values[idx] = values[idx] * scale;
+        }
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +195,40 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[0] = in[0] * m_scale[0] + m_offset[0];
+        out[1] = in[1] * m_scale[1] + m_offset[1];
+        out[2] = in[2] * m_scale[2] + m_offset[2];
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void ScaleWithOffsetRenderer::applyPlanar(float * r, float * g, float * b, float * a,
+                                          long numPixels) const
+{
+    float * planes[4] = { r, g, b, a };
+
+    for (int c = 0; c < 4; ++c)
+    {
+        float * values = planes[c];
+        const float scale  = m_scale[c];
+        const float offset = m_offset[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            values[idx] = values[idx] * scale + offset;
+        }
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -287,6 +377,108 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+// Same as apply() but the alpha is zero so the alpha multipliers are not used.
+void MatrixWithOffsetRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    __m128 m0 = _mm_set_ps(m_column1[3], m_column1[2], m_column1[1], m_column1[0]);
+    __m128 m1 = _mm_set_ps(m_column2[3], m_column2[2], m_column2[1], m_column2[0]);
+    __m128 m2 = _mm_set_ps(m_column3[3], m_column3[2], m_column3[1], m_column3[0]);
+    __m128 o = _mm_set_ps(m_offset[3], m_offset[2], m_offset[1], m_offset[0]);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        __m128 r = _mm_set1_ps(in[0]);
+        __m128 g = _mm_set1_ps(in[1]);
+        __m128 b = _mm_set1_ps(in[2]);
+
+        __m128 img = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, r), _mm_mul_ps(m1, g)),
+                                _mm_mul_ps(m2, b));
+        img = _mm_add_ps(img, o);
+
+        sseStoreRGB(out, img);
+
+        in  += 3;
+        out += 3;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0]
+                + g*m_column2[0]
+                + b*m_column3[0]
+                + m_offset[0];
+        out[1] = r*m_column1[1]
+                + g*m_column2[1]
+                + b*m_column3[1]
+                + m_offset[1];
+        out[2] = r*m_column1[2]
+                + g*m_column2[2]
+                + b*m_column3[2]
+                + m_offset[2];
+
+        in  += 3;
+        out += 3;
+    }
+#endif
+}
+
+// Same as apply() but the 4 pixels of a group are processed at once i.e. each output channel is
+// computed from the broadcast matrix coefficients in the same order as apply().
+void MatrixWithOffsetRenderer::applyPlanar(float * r, float * g, float * b, float * a,
+                                           long numPixels) const
+{
+#ifdef USE_SSE
+    __m128 m0[4], m1[4], m2[4], m3[4], o[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        m0[c] = _mm_set1_ps(m_column1[c]);
+        m1[c] = _mm_set1_ps(m_column2[c]);
+        m2[c] = _mm_set1_ps(m_column3[c]);
+        m3[c] = _mm_set1_ps(m_column4[c]);
+        o[c]  = _mm_set1_ps(m_offset[c]);
+    }
+
+    sseProcessPlanes(r, g, b, a, numPixels, [&](__m128 & rr, __m128 & gg, __m128 & bb, __m128 & aa)
+    {
+        __m128 img[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            img[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0[c], rr), _mm_mul_ps(m1[c], gg)),
+                                _mm_add_ps(_mm_mul_ps(m2[c], bb), _mm_mul_ps(m3[c], aa)));
+            img[c] = _mm_add_ps(img[c], o[c]);
+        }
+
+        rr = img[0];
+        gg = img[1];
+        bb = img[2];
+        aa = img[3];
+    });
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float pix[4] = { r[idx], g[idx], b[idx], a[idx] };
+
+        float * out[4] = { r + idx, g + idx, b + idx, a + idx };
+        for (int c = 0; c < 4; ++c)
+        {
+            *out[c] = pix[0]*m_column1[c]
+                    + pix[1]*m_column2[c]
+                    + pix[2]*m_column3[c]
+                    + pix[3]*m_column4[c]
+                    + m_offset[c];
+        }
+    }
+#endif
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -395,6 +587,99 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+// Same as apply() but the alpha is zero so the alpha multipliers are not used.
+void MatrixRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+#ifdef USE_SSE
+    __m128 m0 = _mm_set_ps(m_column1[3], m_column1[2], m_column1[1], m_column1[0]);
+    __m128 m1 = _mm_set_ps(m_column2[3], m_column2[2], m_column2[1], m_column2[0]);
+    __m128 m2 = _mm_set_ps(m_column3[3], m_column3[2], m_column3[1], m_column3[0]);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        __m128 r = _mm_set1_ps(in[0]);
+        __m128 g = _mm_set1_ps(in[1]);
+        __m128 b = _mm_set1_ps(in[2]);
+
+        __m128 img = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, r), _mm_mul_ps(m1, g)),
+                                _mm_mul_ps(m2, b));
+
+        sseStoreRGB(out, img);
+
+        in  += 3;
+        out += 3;
+    }
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float r = in[0];
+        const float g = in[1];
+        const float b = in[2];
+
+        out[0] = r*m_column1[0]
+               + g*m_column2[0]
+               + b*m_column3[0];
+        out[1] = r*m_column1[1]
+               + g*m_column2[1]
+               + b*m_column3[1];
+        out[2] = r*m_column1[2]
+               + g*m_column2[2]
+               + b*m_column3[2];
+
+        in  += 3;
+        out += 3;
+    }
+#endif
+}
+
+
+// Same as MatrixWithOffsetRenderer::applyPlanar() without the offsets.
+void MatrixRenderer::applyPlanar(float * r, float * g, float * b, float * a, long numPixels) const
+{
+#ifdef USE_SSE
+    __m128 m0[4], m1[4], m2[4], m3[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        m0[c] = _mm_set1_ps(m_column1[c]);
+        m1[c] = _mm_set1_ps(m_column2[c]);
+        m2[c] = _mm_set1_ps(m_column3[c]);
+        m3[c] = _mm_set1_ps(m_column4[c]);
+    }
+
+    sseProcessPlanes(r, g, b, a, numPixels, [&](__m128 & rr, __m128 & gg, __m128 & bb, __m128 & aa)
+    {
+        __m128 img[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            img[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0[c], rr), _mm_mul_ps(m1[c], gg)),
+                                _mm_add_ps(_mm_mul_ps(m2[c], bb), _mm_mul_ps(m3[c], aa)));
+        }
+
+        rr = img[0];
+        gg = img[1];
+        bb = img[2];
+        aa = img[3];
+    });
+#else
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        const float pix[4] = { r[idx], g[idx], b[idx], a[idx] };
+
+        float * out[4] = { r + idx, g + idx, b + idx, a + idx };
+        for (int c = 0; c < 4; ++c)
+        {
+            *out[c] = pix[0]*m_column1[c]
+                    + pix[1]*m_column2[c]
+                    + pix[2]*m_column3[c]
+                    + pix[3]*m_column4[c];
+        }
+    }
+#endif
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
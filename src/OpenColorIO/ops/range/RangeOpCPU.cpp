@@ -19,6 +19,9 @@ public:
 
     RangeOpCPU(ConstRangeOpDataRcPtr & range);
 
+    bool hasApplyRGB() const override { return true; }
+    bool hasApplyPlanar() const override { return true; }
+
 protected:
     float m_scale;
     float m_offset;
@@ -35,6 +38,9 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a,
+                             long numPixels) const override;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +49,9 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a,
+                             long numPixels) const override;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +60,9 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a,
+                             long numPixels) const override;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +71,9 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyRGB(const void * inImg, void * outImg, long numPixels) const override;
+    virtual void applyPlanar(float * r, float * g, float * b, float * a,
+                             long numPixels) const override;
 };
 
 
@@ -102,6 +117,44 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void RangeScaleMinMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        const float t[3] = { in[0] * m_scale + m_offset,
+                             in[1] * m_scale + m_offset,
+                             in[2] * m_scale + m_offset };
+
+        // NaNs become m_lowerBound.
+        out[0] = Clamp(t[0], m_lowerBound, m_upperBound);
+        out[1] = Clamp(t[1], m_lowerBound, m_upperBound);
+        out[2] = Clamp(t[2], m_lowerBound, m_upperBound);
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void RangeScaleMinMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                           long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for(long idx=0; idx<numPixels; ++idx)
+        {
+            const float t = values[idx] * m_scale + m_offset;
+
+            // NaNs become m_lowerBound.
+            values[idx] = Clamp(t, m_lowerBound, m_upperBound);
+        }
+    }
+}
+
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -125,6 +178,38 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void RangeMinMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        // NaNs become m_lowerBound.
+        out[0] = Clamp(in[0], m_lowerBound, m_upperBound);
+        out[1] = Clamp(in[1], m_lowerBound, m_upperBound);
+        out[2] = Clamp(in[2], m_lowerBound, m_upperBound);
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void RangeMinMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                      long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for(long idx=0; idx<numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            values[idx] = Clamp(values[idx], m_lowerBound, m_upperBound);
+        }
+    }
+}
+
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -148,6 +233,38 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMinRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        // NaNs become m_lowerBound.
+        out[0] = std::max(m_lowerBound, in[0]);
+        out[1] = std::max(m_lowerBound, in[1]);
+        out[2] = std::max(m_lowerBound, in[2]);
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void RangeMinRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                   long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for(long idx=0; idx<numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            values[idx] = std::max(m_lowerBound, values[idx]);
+        }
+    }
+}
+
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -171,6 +288,38 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMaxRenderer::applyRGB(const void * inImg, void * outImg, long numPixels) const
+{
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for(long idx=0; idx<numPixels; ++idx)
+    {
+        // NaNs become m_upperBound.
+        out[0] = std::min(m_upperBound, in[0]);
+        out[1] = std::min(m_upperBound, in[1]);
+        out[2] = std::min(m_upperBound, in[2]);
+
+        in  += 3;
+        out += 3;
+    }
+}
+
+void RangeMaxRenderer::applyPlanar(float * r, float * g, float * b, float * /* a */,
+                                   long numPixels) const
+{
+    float * planes[3] = { r, g, b };
+
+    for (float * values : planes)
+    {
+        for(long idx=0; idx<numPixels; ++idx)
+        {
+            // NaNs become m_upperBound.
+            values[idx] = std::min(m_upperBound, values[idx]);
+        }
+    }
+}
+
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
@@ -269,18 +269,17 @@ void BuildColorSpaceOps(OpRcPtrVec & ops,
     BuildColorSpaceFromReferenceOps(ops, config, context, dstColorSpace, dataBypass);
 }
 
-void BuildColorSpaceToReferenceOps(OpRcPtrVec & ops,
-                                   const Config & config,
-                                   const ConstContextRcPtr & context,
-                                   const ConstColorSpaceRcPtr & srcColorSpace,
-                                   bool dataBypass)
+namespace
 {
-    if (!srcColorSpace)
-        throw Exception("BuildColorSpaceOps failed, null colorSpace.");
 
-    if (dataBypass && srcColorSpace->isData())
-        return;
+// Shared ops of the current thread, if any.
+thread_local SharedColorSpaceOps * t_sharedColorSpaceOps = nullptr;
 
+void BuildToReferenceOps(OpRcPtrVec & ops,
+                         const Config & config,
+                         const ConstContextRcPtr & context,
+                         const ConstColorSpaceRcPtr & srcColorSpace)
+{
     AllocationData srcAllocation;
     srcAllocation.allocation = srcColorSpace->getAllocation();
     srcAllocation.vars.resize(srcColorSpace->getAllocationNumVars());
@@ -307,18 +306,11 @@ void BuildColorSpaceToReferenceOps(OpRcPtrVec & ops,
     // Otherwise, both are not defined so its a no-op. This is not an error condition.
 }
 
-void BuildColorSpaceFromReferenceOps(OpRcPtrVec & ops,
-                                     const Config & config,
-                                     const ConstContextRcPtr & context,
-                                     const ConstColorSpaceRcPtr & dstColorSpace,
-                                     bool dataBypass)
+void BuildFromReferenceOps(OpRcPtrVec & ops,
+                           const Config & config,
+                           const ConstContextRcPtr & context,
+                           const ConstColorSpaceRcPtr & dstColorSpace)
 {
-    if (!dstColorSpace)
-        throw Exception("BuildColorSpaceOps failed, null colorSpace.");
-
-    if (dataBypass && dstColorSpace->isData())
-        return;
-
     // Go from the reference space, either by using:
     // * ref->cs in the forward direction.
     // * cs->ref in the inverse direction.
@@ -345,6 +337,108 @@ void BuildColorSpaceFromReferenceOps(OpRcPtrVec & ops,
     CreateGpuAllocationNoOp(ops, dstAllocation);
 }
 
+} // anon.
+
+void SharedColorSpaceOps::append(OpRcPtrVec & ops,
+                                 const ConstContextRcPtr & context,
+                                 const ConstColorSpaceRcPtr & colorSpace,
+                                 bool toReference,
+                                 const std::function<void(OpRcPtrVec &)> & build)
+{
+    std::shared_ptr<Entry> entry;
+    {
+        AutoMutex lock(m_mutex);
+
+        std::shared_ptr<Entry> & value
+            = m_entries[Key(context.get(), colorSpace.get(), toReference)];
+        if (!value)
+        {
+            value = std::make_shared<Entry>();
+            value->m_context    = context;
+            value->m_colorSpace = colorSpace;
+        }
+        entry = value;
+    }
+
+    // The other threads needing the same conversion wait for it. Note that a failed build is
+    // retried by the next thread, which then throws the same error.
+    AutoMutex lock(entry->m_mutex);
+
+    if (!entry->m_built)
+    {
+        build(entry->m_ops);
+        entry->m_built = true;
+    }
+
+    // The processor finalizes and optimizes its ops so it needs its own copies.
+    ops += entry->m_ops.clone();
+}
+
+SharedColorSpaceOpsScope::SharedColorSpaceOpsScope(SharedColorSpaceOps & sharedOps) noexcept
+    :   m_previous(t_sharedColorSpaceOps)
+{
+    t_sharedColorSpaceOps = &sharedOps;
+}
+
+SharedColorSpaceOpsScope::~SharedColorSpaceOpsScope()
+{
+    t_sharedColorSpaceOps = m_previous;
+}
+
+void BuildColorSpaceToReferenceOps(OpRcPtrVec & ops,
+                                   const Config & config,
+                                   const ConstContextRcPtr & context,
+                                   const ConstColorSpaceRcPtr & srcColorSpace,
+                                   bool dataBypass)
+{
+    if (!srcColorSpace)
+        throw Exception("BuildColorSpaceOps failed, null colorSpace.");
+
+    if (dataBypass && srcColorSpace->isData())
+        return;
+
+    if (t_sharedColorSpaceOps)
+    {
+        t_sharedColorSpaceOps->append(ops, context, srcColorSpace, true,
+                                      [&config, &context, &srcColorSpace](OpRcPtrVec & built)
+                                      {
+                                          BuildToReferenceOps(built, config, context,
+                                                              srcColorSpace);
+                                      });
+    }
+    else
+    {
+        BuildToReferenceOps(ops, config, context, srcColorSpace);
+    }
+}
+
+void BuildColorSpaceFromReferenceOps(OpRcPtrVec & ops,
+                                     const Config & config,
+                                     const ConstContextRcPtr & context,
+                                     const ConstColorSpaceRcPtr & dstColorSpace,
+                                     bool dataBypass)
+{
+    if (!dstColorSpace)
+        throw Exception("BuildColorSpaceOps failed, null colorSpace.");
+
+    if (dataBypass && dstColorSpace->isData())
+        return;
+
+    if (t_sharedColorSpaceOps)
+    {
+        t_sharedColorSpaceOps->append(ops, context, dstColorSpace, false,
+                                      [&config, &context, &dstColorSpace](OpRcPtrVec & built)
+                                      {
+                                          BuildFromReferenceOps(built, config, context,
+                                                                dstColorSpace);
+                                      });
+    }
+    else
+    {
+        BuildFromReferenceOps(ops, config, context, dstColorSpace);
+    }
+}
+
 void BuildReferenceConversionOps(OpRcPtrVec & ops,
                                  const Config & config,
                                  const ConstContextRcPtr & context,
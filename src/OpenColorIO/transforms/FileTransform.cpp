@@ -3,6 +3,7 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <map>
 #include <sstream>
@@ -17,7 +18,9 @@
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
 #include "Platform.h"
+#include "Profiling.h"
 #include "pystring/pystring.h"
+#include "transforms/PersistentFileCache.h"
 #include "utils/StringUtils.h"
 
 
@@ -707,6 +710,8 @@ struct FileCacheResult
     bool error = false;
     CachedFileRcPtr cachedFile;
     std::string exceptionText;
+    // Approximate memory used by the cached file (refer to GetFileTransformCacheStatistics()).
+    std::atomic<size_t> payloadBytes{ 0 };
 
     FileCacheResult() = default;
 };
@@ -756,14 +761,40 @@ void GetCachedFileAndFormat(FileFormat * & format,
     // If this file has already been loaded, return the result immediately.
 
     AutoMutex lock(result->mutex);
-    if (!result->ready)
+
+    if (ProcessorProfile * profile = GetCurrentProcessorProfile())
+    {
+        if (result->ready)
+        {
+            ++profile->m_numFilesCached;
+        }
+        else
+        {
+            ++profile->m_numFilesLoaded;
+        }
+    }
+
+    if (result->ready)
+    {
+        g_fileCache.counters().addHit();
+    }
+    else
     {
         result->ready = true;
         result->error = false;
 
+        CacheMissTimer missTimer(g_fileCache.counters());
+        ProfilingTimer timer(&ProcessorProfile::m_fileLoadingTime, ProfilingTimer::DETAIL);
+
         try
         {
-            LoadFileUncached(result->format, result->cachedFile, filepath, interp);
+            if (!LoadPersistentCachedFile(result->format, result->cachedFile, filepath, interp))
+            {
+                LoadFileUncached(result->format, result->cachedFile, filepath, interp);
+                SavePersistentCachedFile(result->format, result->cachedFile, filepath, interp);
+            }
+
+            result->payloadBytes = GetCachedFilePayloadSize(result->cachedFile);
         }
         catch (std::exception & e)
         {
@@ -814,6 +845,18 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+CacheStatistics GetFileTransformCacheStatistics()
+{
+    // Note: The size of the cached files is only known for the file formats supporting the
+    // persistent file cache (i.e. the size of the serialized payload).
+    return g_fileCache.getStatistics("file",
+        [](const std::string & key, const FileCacheResultPtr & result)
+        {
+            return key.size() + sizeof(FileCacheResult)
+                   + (result ? result->payloadBytes.load() : 0);
+        });
+}
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -21,6 +21,11 @@ namespace OCIO_NAMESPACE
 {
 void ClearFileTransformCaches();
 
+CacheStatistics GetFileTransformCacheStatistics();
+
+class PersistentCacheWriter;
+class PersistentCacheReader;
+
 class CachedFile
 {
 public:
@@ -31,6 +36,13 @@ public:
     {
         throw Exception("Not a CDL file format.");
     }
+
+    // Write the payload stored in the persistent file cache (refer to PersistentFileCache.h).
+    // Return false if the file format does not support the persistent file cache.
+    virtual bool serialize(PersistentCacheWriter & /*writer*/) const
+    {
+        return false;
+    }
 };
 
 typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
@@ -84,6 +96,12 @@ public:
                                 const FileTransform & fileTransform,
                                 TransformDirection dir) const = 0;
 
+    // Rebuild the cached file from the payload written by CachedFile::serialize().
+    virtual CachedFileRcPtr deserialize(PersistentCacheReader & /*reader*/) const
+    {
+        return CachedFileRcPtr();
+    }
+
     // True if the file is a binary rather than text-based format.
     virtual bool isBinary() const
     {
@@ -0,0 +1,529 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <streambuf>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Logging.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "pystring/pystring.h"
+#include "transforms/PersistentFileCache.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+constexpr char CacheMagic[] = { 'O', 'C', 'I', 'O', 'F', '\0' };
+
+// Increment the version when the payload of any file format changes.
+constexpr uint32_t CacheFormatVersion = 1;
+
+// The payload uses the native byte order so an entry is only usable on the same architecture.
+constexpr uint32_t CacheByteOrderMark = 0x01020304;
+
+// Read-only view of a cache entry. The file is memory mapped when the platform supports it.
+class CacheEntryView
+{
+public:
+    CacheEntryView() = delete;
+    CacheEntryView(const CacheEntryView &) = delete;
+    CacheEntryView & operator=(const CacheEntryView &) = delete;
+
+    explicit CacheEntryView(const std::string & filename)
+    {
+#ifdef _WIN32
+        std::ifstream istream(filename.c_str(), std::ios_base::in | std::ios_base::binary);
+        if (istream.good())
+        {
+            m_buffer.assign(std::istreambuf_iterator<char>(istream),
+                            std::istreambuf_iterator<char>());
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+        }
+#else
+        const int fd = open(filename.c_str(), O_RDONLY);
+        if (fd != -1)
+        {
+            struct stat fileInfo;
+            if (fstat(fd, &fileInfo) == 0 && fileInfo.st_size > 0)
+            {
+                void * addr = mmap(nullptr, static_cast<size_t>(fileInfo.st_size),
+                                   PROT_READ, MAP_PRIVATE, fd, 0);
+                if (addr != MAP_FAILED)
+                {
+                    m_mapped = addr;
+                    m_data   = static_cast<const char *>(addr);
+                    m_size   = static_cast<size_t>(fileInfo.st_size);
+                }
+            }
+            // The mapping stays valid after closing the file descriptor.
+            close(fd);
+        }
+#endif
+    }
+
+    ~CacheEntryView()
+    {
+#ifndef _WIN32
+        if (m_mapped)
+        {
+            munmap(m_mapped, m_size);
+        }
+#endif
+    }
+
+    const char * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+private:
+    const char * m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    std::vector<char> m_buffer;
+#else
+    void * m_mapped = nullptr;
+#endif
+};
+
+void ThrowCorruptedEntry()
+{
+    throw Exception("Corrupted persistent file cache entry.");
+}
+
+// Check an enumeration value read from a cache entry.
+void CheckRange(int32_t value, int32_t minValue, int32_t maxValue)
+{
+    if (value < minValue || value > maxValue)
+    {
+        ThrowCorruptedEntry();
+    }
+}
+
+Interpolation ReadInterpolation(int32_t value)
+{
+    if (value != INTERP_DEFAULT && value != INTERP_BEST)
+    {
+        CheckRange(value, INTERP_UNKNOWN, INTERP_CUBIC);
+    }
+    return static_cast<Interpolation>(value);
+}
+
+TransformDirection ReadDirection(int32_t value)
+{
+    CheckRange(value, TRANSFORM_DIR_FORWARD, TRANSFORM_DIR_INVERSE);
+    return static_cast<TransformDirection>(value);
+}
+
+BitDepth ReadBitDepth(int32_t value)
+{
+    CheckRange(value, BIT_DEPTH_UNKNOWN, BIT_DEPTH_F32);
+    return static_cast<BitDepth>(value);
+}
+
+// Return the canonical path of the file (i.e. absolute and without symbolic links) or the
+// file path itself if it cannot be resolved.
+std::string GetCanonicalPath(const std::string & filepath)
+{
+#ifdef _WIN32
+    char path[_MAX_PATH];
+    if (_fullpath(path, filepath.c_str(), _MAX_PATH))
+    {
+        return path;
+    }
+#else
+    char * path = realpath(filepath.c_str(), nullptr);
+    if (path)
+    {
+        const std::string canonicalPath(path);
+        free(path);
+        return canonicalPath;
+    }
+#endif
+    return filepath;
+}
+
+// Return the path of the cache entry for the file or an empty string if the persistent file
+// cache is disabled.
+std::string GetCacheEntryFilename(const std::string & filepath, Interpolation interp)
+{
+    std::string cacheDir;
+    if (!Platform::Getenv(OCIO_FILE_CACHE_DIR, cacheDir) || cacheDir.empty())
+    {
+        return "";
+    }
+
+    // The fast file hash identifies the file content (refer to SetComputeHashFunction()) and
+    // the file stamp detects the in-place modifications. As the default hash only identifies the
+    // file on its device, the path is added so two files never share an entry.
+    const std::string fileHash = GetFastFileHash(filepath);
+    const std::string fileStamp = GetFileStamp(filepath);
+    if (fileHash.empty() || fileStamp.empty())
+    {
+        return "";
+    }
+
+    std::ostringstream key;
+    key << GetCanonicalPath(filepath) << "|" << fileHash << "|" << fileStamp << "|" << interp << "|" << CacheFormatVersion
+        << "|" << GetVersionHex();
+    const std::string keyStr = key.str();
+
+    // Skip the leading '$' of the printable hash.
+    const std::string hash
+        = CacheIDHash(keyStr.c_str(), static_cast<int>(keyStr.size())).substr(1);
+
+    return pystring::os::path::join(cacheDir, hash + ".ociolut");
+}
+
+// Stream buffer only counting the written characters.
+class CountingBuffer : public std::streambuf
+{
+public:
+    size_t getCount() const noexcept { return m_count; }
+
+protected:
+    std::streamsize xsputn(const char * /*s*/, std::streamsize n) override
+    {
+        m_count += static_cast<size_t>(n);
+        return n;
+    }
+
+    int_type overflow(int_type c) override
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            ++m_count;
+        }
+        return traits_type::not_eof(c);
+    }
+
+private:
+    size_t m_count = 0;
+};
+
+} // anon.
+
+void PersistentCacheWriter::writeString(const std::string & str)
+{
+    write(static_cast<uint32_t>(str.size()));
+    write(str.data(), str.size());
+}
+
+void PersistentCacheWriter::writeLut1D(const ConstLut1DOpDataRcPtr & lut)
+{
+    write(static_cast<uint8_t>(lut ? 1 : 0));
+    if (lut)
+    {
+        const auto & array = lut->getArray();
+
+        write(static_cast<int32_t>(lut->getHalfFlags()));
+        write(static_cast<int32_t>(lut->getHueAdjust()));
+        write(static_cast<int32_t>(lut->getInterpolation()));
+        write(static_cast<int32_t>(lut->getDirection()));
+        write(static_cast<int32_t>(lut->getFileOutputBitDepth()));
+        write(static_cast<uint32_t>(array.getLength()));
+        write(static_cast<uint32_t>(array.getNumColorComponents()));
+        write(array.getValues().data(), array.getValues().size());
+    }
+}
+
+void PersistentCacheWriter::writeLut3D(const ConstLut3DOpDataRcPtr & lut)
+{
+    write(static_cast<uint8_t>(lut ? 1 : 0));
+    if (lut)
+    {
+        const auto & array = lut->getArray();
+
+        write(static_cast<int32_t>(lut->getInterpolation()));
+        write(static_cast<int32_t>(lut->getDirection()));
+        write(static_cast<int32_t>(lut->getFileOutputBitDepth()));
+        write(static_cast<uint32_t>(array.getLength()));
+        write(array.getValues().data(), array.getValues().size());
+    }
+}
+
+void PersistentCacheReader::check(uint64_t size) const
+{
+    if (size > static_cast<uint64_t>(m_end - m_data))
+    {
+        ThrowCorruptedEntry();
+    }
+}
+
+void PersistentCacheReader::readString(std::string & str)
+{
+    uint32_t size = 0;
+    read(size);
+    check(size);
+    str.assign(m_data, size);
+    m_data += size;
+}
+
+void PersistentCacheReader::readLut1D(Lut1DOpDataRcPtr & lut)
+{
+    lut.reset();
+
+    uint8_t present = 0;
+    read(present);
+    if (!present)
+    {
+        return;
+    }
+
+    int32_t halfFlags = 0, hueAdjust = 0, interp = 0, dir = 0, bitDepth = 0;
+    uint32_t length = 0, numComponents = 0;
+    read(halfFlags);
+    read(hueAdjust);
+    read(interp);
+    read(dir);
+    read(bitDepth);
+    read(length);
+    read(numComponents);
+
+    CheckRange(halfFlags, Lut1DOpData::LUT_STANDARD, Lut1DOpData::LUT_INPUT_OUTPUT_HALF_CODE);
+    CheckRange(hueAdjust, HUE_NONE, HUE_WYPN);
+
+    // Check the size before allocating anything. Note that the 64-bit product cannot overflow.
+    if (length < 2 || (numComponents != 1 && numComponents != 3))
+    {
+        ThrowCorruptedEntry();
+    }
+    check(static_cast<uint64_t>(length) * numComponents * sizeof(float));
+
+    // Avoid filling an identity LUT of the final size as all the values are then overwritten.
+    lut = std::make_shared<Lut1DOpData>(static_cast<Lut1DOpData::HalfFlags>(halfFlags), 2, false);
+    lut->setHueAdjust(static_cast<Lut1DHueAdjust>(hueAdjust));
+    lut->setInterpolation(ReadInterpolation(interp));
+    lut->setDirection(ReadDirection(dir));
+    lut->setFileOutputBitDepth(ReadBitDepth(bitDepth));
+
+    auto & array = lut->getArray();
+    array.resize(length, numComponents);
+    read(array.getValues().data(), array.getValues().size());
+}
+
+void PersistentCacheReader::readLut3D(Lut3DOpDataRcPtr & lut)
+{
+    lut.reset();
+
+    uint8_t present = 0;
+    read(present);
+    if (!present)
+    {
+        return;
+    }
+
+    int32_t interp = 0, dir = 0, bitDepth = 0;
+    uint32_t gridSize = 0;
+    read(interp);
+    read(dir);
+    read(bitDepth);
+    read(gridSize);
+
+    // Check the size before allocating anything. Limiting the grid size avoids an overflow of
+    // the 64-bit number of bytes.
+    if (gridSize < 2 || gridSize > 65536)
+    {
+        ThrowCorruptedEntry();
+    }
+    const uint64_t numEntries = static_cast<uint64_t>(gridSize) * gridSize * gridSize;
+    check(numEntries * 3 * sizeof(float));
+
+    lut = std::make_shared<Lut3DOpData>(2);
+    lut->setInterpolation(ReadInterpolation(interp));
+    lut->setDirection(ReadDirection(dir));
+    lut->setFileOutputBitDepth(ReadBitDepth(bitDepth));
+
+    auto & array = lut->getArray();
+    array.resize(gridSize, array.getNumColorComponents());
+    read(array.getValues().data(), array.getValues().size());
+}
+
+bool LoadPersistentCachedFile(FileFormat * & format,
+                              CachedFileRcPtr & cachedFile,
+                              const std::string & filepath,
+                              Interpolation interp)
+{
+    const std::string entryFilename = GetCacheEntryFilename(filepath, interp);
+    if (entryFilename.empty())
+    {
+        return false;
+    }
+
+    CacheEntryView entry(entryFilename);
+    if (!entry.data())
+    {
+        return false;
+    }
+
+    try
+    {
+        PersistentCacheReader reader(entry.data(), entry.size());
+
+        char magic[sizeof(CacheMagic)];
+        uint32_t formatVersion = 0, libraryVersion = 0, byteOrderMark = 0;
+        reader.read(magic, sizeof(magic));
+        reader.read(formatVersion);
+        reader.read(libraryVersion);
+        reader.read(byteOrderMark);
+
+        if (memcmp(magic, CacheMagic, sizeof(magic)) != 0
+            || formatVersion != CacheFormatVersion
+            || libraryVersion != static_cast<uint32_t>(GetVersionHex())
+            || byteOrderMark != CacheByteOrderMark)
+        {
+            return false;
+        }
+
+        std::string formatName;
+        reader.readString(formatName);
+
+        FileFormat * cachedFormat
+            = FormatRegistry::GetInstance().getFileFormatByName(formatName);
+        if (!cachedFormat)
+        {
+            return false;
+        }
+
+        CachedFileRcPtr file = cachedFormat->deserialize(reader);
+        if (!file)
+        {
+            return false;
+        }
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << "    Loaded " << filepath << " from the persistent file cache "
+                << entryFilename;
+            LogDebug(oss.str());
+        }
+
+        format = cachedFormat;
+        cachedFile = file;
+        return true;
+    }
+    catch (const std::exception & e)
+    {
+        // A corrupted entry is replaced once the file is parsed again.
+        std::ostringstream oss;
+        oss << "Ignoring the persistent file cache entry '" << entryFilename
+            << "' for the file '" << filepath << "': " << e.what();
+        LogDebug(oss.str());
+    }
+
+    return false;
+}
+
+size_t GetCachedFilePayloadSize(const CachedFileRcPtr & cachedFile)
+{
+    if (!cachedFile)
+    {
+        return 0;
+    }
+
+    CountingBuffer buffer;
+    std::ostream ostream(&buffer);
+
+    try
+    {
+        PersistentCacheWriter writer(ostream);
+        if (cachedFile->serialize(writer))
+        {
+            return buffer.getCount();
+        }
+    }
+    catch (const std::exception &)
+    {
+    }
+
+    return 0;
+}
+
+void SavePersistentCachedFile(const FileFormat * format,
+                              const CachedFileRcPtr & cachedFile,
+                              const std::string & filepath,
+                              Interpolation interp)
+{
+    if (!format || !cachedFile)
+    {
+        return;
+    }
+
+    const std::string entryFilename = GetCacheEntryFilename(filepath, interp);
+    if (entryFilename.empty())
+    {
+        return;
+    }
+
+    // Write a temporary file first so concurrent readers never see a partial entry. Concurrent
+    // writers of the same entry write identical contents so the last rename wins.
+    const std::string tmpFilename
+        = entryFilename + "." + pystring::os::path::basename(Platform::CreateTempFilename(""));
+
+    bool serialized = false;
+    {
+        std::ofstream ostream(tmpFilename.c_str(),
+                              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        if (ostream.fail())
+        {
+            std::ostringstream oss;
+            oss << "Could not write the persistent file cache entry '" << tmpFilename << "'.";
+            LogWarning(oss.str());
+            return;
+        }
+
+        try
+        {
+            PersistentCacheWriter writer(ostream);
+            writer.write(CacheMagic, sizeof(CacheMagic));
+            writer.write(CacheFormatVersion);
+            writer.write(static_cast<uint32_t>(GetVersionHex()));
+            writer.write(CacheByteOrderMark);
+            writer.writeString(format->getName());
+
+            serialized = cachedFile->serialize(writer) && ostream.good();
+        }
+        catch (const std::exception & e)
+        {
+            std::ostringstream oss;
+            oss << "Could not write the persistent file cache entry for the file '"
+                << filepath << "': " << e.what();
+            LogWarning(oss.str());
+        }
+    }
+
+    if (!serialized)
+    {
+        std::remove(tmpFilename.c_str());
+        return;
+    }
+
+    // Note: On Windows, the rename fails if the destination exists i.e. another process already
+    // wrote the same entry.
+    if (std::rename(tmpFilename.c_str(), entryFilename.c_str()) != 0)
+    {
+        std::remove(tmpFilename.c_str());
+    }
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_PERSISTENTFILECACHE_H
+#define INCLUDED_OCIO_PERSISTENTFILECACHE_H
+
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "transforms/FileTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The persistent file cache is an optional on-disk cache (refer to OCIO_FILE_CACHE_DIR) of the
+// parsed LUT files which is shared between processes. Each entry holds the binary payload of a
+// CachedFile and is only valid for the library version, and the cache format version, which
+// wrote it. A file format opts in by implementing CachedFile::serialize() and
+// FileFormat::deserialize().
+
+// Write the payload of a cached file.
+class PersistentCacheWriter
+{
+public:
+    PersistentCacheWriter() = delete;
+    PersistentCacheWriter(const PersistentCacheWriter &) = delete;
+    PersistentCacheWriter & operator=(const PersistentCacheWriter &) = delete;
+
+    explicit PersistentCacheWriter(std::ostream & ostream) : m_ostream(ostream) {}
+
+    template<typename T>
+    void write(const T & value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only supports plain values.");
+        m_ostream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    void write(const T * values, size_t numValues)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only supports plain values.");
+        m_ostream.write(reinterpret_cast<const char *>(values), numValues * sizeof(T));
+    }
+
+    void writeString(const std::string & str);
+
+    // Note: A null LUT is supported.
+    void writeLut1D(const ConstLut1DOpDataRcPtr & lut);
+    void writeLut3D(const ConstLut3DOpDataRcPtr & lut);
+
+private:
+    std::ostream & m_ostream;
+};
+
+// Read the payload of a cached file from a memory buffer. An exception is thrown if the
+// payload is truncated or corrupted.
+class PersistentCacheReader
+{
+public:
+    PersistentCacheReader() = delete;
+    PersistentCacheReader(const PersistentCacheReader &) = delete;
+    PersistentCacheReader & operator=(const PersistentCacheReader &) = delete;
+
+    PersistentCacheReader(const char * data, size_t size) : m_data(data), m_end(data + size) {}
+
+    template<typename T>
+    void read(T & value)
+    {
+        read(&value, 1);
+    }
+
+    template<typename T>
+    void read(T * values, size_t numValues)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only supports plain values.");
+        const size_t size = numValues * sizeof(T);
+        check(size);
+        memcpy(values, m_data, size);
+        m_data += size;
+    }
+
+    void readString(std::string & str);
+
+    // Note: The sizes & the enumeration values are validated before allocating the LUT.
+    void readLut1D(Lut1DOpDataRcPtr & lut);
+    void readLut3D(Lut3DOpDataRcPtr & lut);
+
+private:
+    // Throw if there are less than size bytes left.
+    void check(uint64_t size) const;
+
+    const char * m_data;
+    const char * m_end;
+};
+
+// Load the cached file from the persistent file cache. Return false if the cache is disabled,
+// or if there is no valid entry for the file.
+bool LoadPersistentCachedFile(FileFormat * & format,
+                              CachedFileRcPtr & cachedFile,
+                              const std::string & filepath,
+                              Interpolation interp);
+
+// Return the size of the payload of a cached file (i.e. an approximation of its memory footprint)
+// or 0 if its file format does not support the persistent file cache.
+size_t GetCachedFilePayloadSize(const CachedFileRcPtr & cachedFile);
+
+// Save the cached file in the persistent file cache (if enabled and supported by the format).
+// Errors are only logged as the cache is an optimization.
+void SavePersistentCachedFile(const FileFormat * format,
+                              const CachedFileRcPtr & cachedFile,
+                              const std::string & filepath,
+                              Interpolation interp);
+
+} // namespace OCIO_NAMESPACE
+
+#endif
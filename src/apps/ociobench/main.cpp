@@ -0,0 +1,1248 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "apputils/argparse.h"
+#include "OpenEXR/half.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO = OCIO_NAMESPACE;
+
+namespace
+{
+
+// A named task measured several times.
+struct Benchmark
+{
+    std::string m_name;
+    // Number of pixels processed by one iteration (zero when not relevant).
+    size_t m_numPixels = 0;
+    // Untimed work to perform before each iteration (optional).
+    std::function<void()> m_prepare;
+    // The measured work.
+    std::function<void()> m_run;
+};
+
+struct Result
+{
+    std::string m_name;
+    unsigned m_iterations = 0;
+
+    // All the durations are in ms.
+    double m_min    = 0.;
+    double m_median = 0.;
+    double m_mean   = 0.;
+    double m_max    = 0.;
+
+    double m_mpixelsPerSec = 0.;
+};
+
+Result Run(const Benchmark & benchmark, unsigned iterations)
+{
+    // The first iteration is not measured (i.e. warms up the caches and the lazy
+    // initializations).
+    if (benchmark.m_prepare)
+    {
+        benchmark.m_prepare();
+    }
+    benchmark.m_run();
+
+    std::vector<double> durations;
+    durations.reserve(iterations);
+
+    for (unsigned iter = 0; iter < iterations; ++iter)
+    {
+        if (benchmark.m_prepare)
+        {
+            benchmark.m_prepare();
+        }
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        benchmark.m_run();
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        durations.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    Result res;
+    res.m_name       = benchmark.m_name;
+    res.m_iterations = iterations;
+    res.m_min        = durations.front();
+    res.m_max        = durations.back();
+    res.m_median     = (iterations % 2) == 1
+                           ? durations[iterations / 2]
+                           : (durations[iterations / 2 - 1] + durations[iterations / 2]) / 2.;
+
+    for (const auto duration : durations)
+    {
+        res.m_mean += duration;
+    }
+    res.m_mean /= double(iterations);
+
+    if (benchmark.m_numPixels > 0 && res.m_median > 0.)
+    {
+        res.m_mpixelsPerSec = double(benchmark.m_numPixels) / (res.m_median * 1000.);
+    }
+
+    return res;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Synthetic images.
+
+struct ImageSize
+{
+    long m_width  = 0;
+    long m_height = 0;
+
+    size_t numPixels() const { return size_t(m_width) * size_t(m_height); }
+
+    std::string str() const
+    {
+        std::ostringstream oss;
+        oss << m_width << "x" << m_height;
+        return oss.str();
+    }
+};
+
+std::vector<ImageSize> ParseSizes(const std::string & sizes)
+{
+    std::vector<ImageSize> res;
+    for (const auto & token : StringUtils::Split(sizes, ','))
+    {
+        const std::vector<std::string> dims = StringUtils::Split(StringUtils::Lower(token), 'x');
+
+        ImageSize size;
+        if (dims.size() == 2)
+        {
+            size.m_width  = atol(dims[0].c_str());
+            size.m_height = atol(dims[1].c_str());
+        }
+
+        if (size.m_width <= 0 || size.m_height <= 0)
+        {
+            std::ostringstream oss;
+            oss << "Invalid image size '" << token << "', expecting WIDTHxHEIGHT.";
+            throw OCIO::Exception(oss.str().c_str());
+        }
+        res.push_back(size);
+    }
+    return res;
+}
+
+// The synthetic values cover the [0, 1] range with some variation between channels.
+float SyntheticValue(size_t pixel, size_t channel)
+{
+    return float((pixel * 7 + channel * 131) % 1024) / 1023.0f;
+}
+
+template<typename T>
+T ToBitDepth(float value, OCIO::BitDepth bitDepth);
+
+template<>
+uint8_t ToBitDepth<uint8_t>(float value, OCIO::BitDepth)
+{
+    return uint8_t(value * 255.0f + 0.5f);
+}
+
+template<>
+uint16_t ToBitDepth<uint16_t>(float value, OCIO::BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case OCIO::BIT_DEPTH_UINT10:
+            return uint16_t(value * 1023.0f + 0.5f);
+        case OCIO::BIT_DEPTH_UINT12:
+            return uint16_t(value * 4095.0f + 0.5f);
+        case OCIO::BIT_DEPTH_F16:
+            return half(value).bits();
+        default:
+            return uint16_t(value * 65535.0f + 0.5f);
+    }
+}
+
+template<>
+float ToBitDepth<float>(float value, OCIO::BitDepth)
+{
+    return value;
+}
+
+size_t GetChannelBytes(OCIO::BitDepth bitDepth)
+{
+    switch (bitDepth)
+    {
+        case OCIO::BIT_DEPTH_UINT8:
+            return 1;
+        case OCIO::BIT_DEPTH_UINT10:
+        case OCIO::BIT_DEPTH_UINT12:
+        case OCIO::BIT_DEPTH_UINT16:
+        case OCIO::BIT_DEPTH_F16:
+            return 2;
+        case OCIO::BIT_DEPTH_F32:
+            return 4;
+        default:
+            throw OCIO::Exception("Unsupported bit-depth.");
+    }
+}
+
+// Holds the channels of an image (packed or planar) in any bit-depth.
+class SyntheticImage
+{
+public:
+    SyntheticImage(const ImageSize & size, size_t numChannels, OCIO::BitDepth bitDepth)
+        :   m_size(size)
+        ,   m_numChannels(numChannels)
+        ,   m_bitDepth(bitDepth)
+        ,   m_channelBytes(GetChannelBytes(bitDepth))
+        ,   m_buffer(size.numPixels() * numChannels * m_channelBytes)
+    {
+        switch (m_channelBytes)
+        {
+            case 1:
+                fill<uint8_t>();
+                break;
+            case 2:
+                fill<uint16_t>();
+                break;
+            default:
+                fill<float>();
+                break;
+        }
+    }
+
+    void * data() { return m_buffer.data(); }
+
+    // Return a channel plane when the image is used as planar.
+    void * plane(size_t channel)
+    {
+        return m_buffer.data() + channel * m_size.numPixels() * m_channelBytes;
+    }
+
+private:
+    template<typename T>
+    void fill()
+    {
+        T * values = reinterpret_cast<T *>(m_buffer.data());
+        const size_t numValues = m_size.numPixels() * m_numChannels;
+        for (size_t idx = 0; idx < numValues; ++idx)
+        {
+            values[idx] = ToBitDepth<T>(SyntheticValue(idx / m_numChannels, idx % m_numChannels),
+                                        m_bitDepth);
+        }
+    }
+
+    const ImageSize m_size;
+    const size_t m_numChannels;
+    const OCIO::BitDepth m_bitDepth;
+    const size_t m_channelBytes;
+    std::vector<char> m_buffer;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Synthetic transforms.
+
+const double Matrix[16] = { 0.6954522414, 0.1406786965, 0.1638690622, 0.,
+                            0.0447945634, 0.8596711185, 0.0955343182, 0.,
+                           -0.0055258826, 0.0040252103, 1.0015006723, 0.,
+                            0.,           0.,           0.,           1. };
+
+// Return a 1D LUT applying a 1/2.2 gamma.
+OCIO::Lut1DTransformRcPtr CreateLut1D(unsigned long length)
+{
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(length, false);
+    for (unsigned long idx = 0; idx < length; ++idx)
+    {
+        const float v = std::pow(float(idx) / float(length - 1), 1.0f / 2.2f);
+        lut->setValue(idx, v, v, v);
+    }
+    return lut;
+}
+
+// Return a 3D LUT mixing the channels.
+float Lut3DValue(unsigned long idx, unsigned long gridSize)
+{
+    return std::pow(float(idx) / float(gridSize - 1), 1.0f / 2.2f);
+}
+
+OCIO::Lut3DTransformRcPtr CreateLut3D(unsigned long gridSize)
+{
+    OCIO::Lut3DTransformRcPtr lut = OCIO::Lut3DTransform::Create(gridSize);
+    for (unsigned long r = 0; r < gridSize; ++r)
+    {
+        for (unsigned long g = 0; g < gridSize; ++g)
+        {
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                const float rv = Lut3DValue(r, gridSize);
+                const float gv = Lut3DValue(g, gridSize);
+                const float bv = Lut3DValue(b, gridSize);
+                lut->setValue(r, g, b,
+                              0.8f * rv + 0.1f * gv + 0.1f * bv,
+                              0.1f * rv + 0.8f * gv + 0.1f * bv,
+                              0.1f * rv + 0.1f * gv + 0.8f * bv);
+            }
+        }
+    }
+    return lut;
+}
+
+// Return one transform per CPU renderer.
+std::vector<std::pair<std::string, OCIO::ConstTransformRcPtr>> CreateOpTransforms()
+{
+    std::vector<std::pair<std::string, OCIO::ConstTransformRcPtr>> transforms;
+
+    {
+        OCIO::MatrixTransformRcPtr t = OCIO::MatrixTransform::Create();
+        t->setMatrix(Matrix);
+        transforms.emplace_back("matrix", t);
+    }
+    {
+        OCIO::RangeTransformRcPtr t = OCIO::RangeTransform::Create();
+        t->setMinInValue(0.1);
+        t->setMaxInValue(0.9);
+        t->setMinOutValue(0.);
+        t->setMaxOutValue(1.);
+        transforms.emplace_back("range", t);
+    }
+    {
+        OCIO::ExponentTransformRcPtr t = OCIO::ExponentTransform::Create();
+        t->setValue({ 2.2, 2.2, 2.2, 1. });
+        transforms.emplace_back("exponent", t);
+    }
+    {
+        OCIO::ExponentWithLinearTransformRcPtr t = OCIO::ExponentWithLinearTransform::Create();
+        t->setGamma({ 2.4, 2.4, 2.4, 1. });
+        t->setOffset({ 0.055, 0.055, 0.055, 0. });
+        transforms.emplace_back("exponent_linear", t);
+    }
+    {
+        OCIO::LogTransformRcPtr t = OCIO::LogTransform::Create();
+        t->setBase(2.);
+        transforms.emplace_back("log", t);
+    }
+    {
+        OCIO::LogAffineTransformRcPtr t = OCIO::LogAffineTransform::Create();
+        t->setLogSideSlopeValue({ 0.18, 0.18, 0.18 });
+        t->setLinSideOffsetValue({ 0.01, 0.01, 0.01 });
+        transforms.emplace_back("log_affine", t);
+    }
+    {
+        OCIO::LogCameraTransformRcPtr t = OCIO::LogCameraTransform::Create({ 0.1, 0.1, 0.1 });
+        t->setLogSideSlopeValue({ 0.18, 0.18, 0.18 });
+        t->setLinSideOffsetValue({ 0.01, 0.01, 0.01 });
+        transforms.emplace_back("log_camera", t);
+    }
+    {
+        OCIO::CDLTransformRcPtr t = OCIO::CDLTransform::Create();
+        const double slope[3]  = { 1.1, 1.0, 0.9 };
+        const double offset[3] = { 0.01, 0.0, -0.01 };
+        const double power[3]  = { 1.2, 1.0, 0.8 };
+        t->setSlope(slope);
+        t->setOffset(offset);
+        t->setPower(power);
+        t->setSat(0.9);
+        transforms.emplace_back("cdl", t);
+    }
+    {
+        OCIO::ExposureContrastTransformRcPtr t = OCIO::ExposureContrastTransform::Create();
+        t->setStyle(OCIO::EXPOSURE_CONTRAST_LOGARITHMIC);
+        t->setExposure(0.5);
+        t->setContrast(1.2);
+        transforms.emplace_back("exposure_contrast", t);
+    }
+    {
+        OCIO::FixedFunctionTransformRcPtr t
+            = OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_ACES_GLOW_10);
+        transforms.emplace_back("fixed_function_aces_glow", t);
+    }
+    {
+        OCIO::FixedFunctionTransformRcPtr t
+            = OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_RGB_TO_HSV);
+        transforms.emplace_back("fixed_function_rgb_to_hsv", t);
+    }
+    {
+        OCIO::GradingPrimaryTransformRcPtr t
+            = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+        OCIO::GradingPrimary values(OCIO::GRADING_LOG);
+        values.m_contrast   = OCIO::GradingRGBM(1.1, 1.0, 0.9, 1.2);
+        values.m_saturation = 1.1;
+        t->setValue(values);
+        transforms.emplace_back("grading_primary", t);
+    }
+    {
+        OCIO::GradingBSplineCurveRcPtr curve
+            = OCIO::GradingBSplineCurve::Create({ { 0.0f, 0.0f }, { 0.5f, 0.6f }, { 1.0f, 1.0f } });
+        OCIO::GradingBSplineCurveRcPtr identity
+            = OCIO::GradingBSplineCurve::Create({ { 0.0f, 0.0f }, { 1.0f, 1.0f } });
+
+        OCIO::GradingRGBCurveTransformRcPtr t
+            = OCIO::GradingRGBCurveTransform::Create(OCIO::GRADING_LOG);
+        t->setValue(OCIO::GradingRGBCurve::Create(curve, identity, identity, curve));
+        transforms.emplace_back("grading_rgbcurve", t);
+    }
+    {
+        OCIO::GradingToneTransformRcPtr t = OCIO::GradingToneTransform::Create(OCIO::GRADING_LOG);
+        OCIO::GradingTone values(OCIO::GRADING_LOG);
+        values.m_midtones.m_master = 1.2;
+        values.m_scontrast = 1.1;
+        t->setValue(values);
+        transforms.emplace_back("grading_tone", t);
+    }
+    {
+        transforms.emplace_back("lut1d", CreateLut1D(4096));
+    }
+    {
+        OCIO::Lut1DTransformRcPtr t = CreateLut1D(4096);
+        t->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        transforms.emplace_back("lut1d_inverse", t);
+    }
+    {
+        OCIO::Lut3DTransformRcPtr t = CreateLut3D(33);
+        t->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+        transforms.emplace_back("lut3d_tetrahedral", t);
+    }
+    {
+        OCIO::Lut3DTransformRcPtr t = CreateLut3D(33);
+        t->setInterpolation(OCIO::INTERP_LINEAR);
+        transforms.emplace_back("lut3d_linear", t);
+    }
+    {
+        OCIO::Lut3DTransformRcPtr t = CreateLut3D(17);
+        t->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        transforms.emplace_back("lut3d_inverse", t);
+    }
+
+    return transforms;
+}
+
+// Return a typical scene to display pipeline.
+OCIO::ConstTransformRcPtr CreatePipelineTransform()
+{
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    for (const auto & t : CreateOpTransforms())
+    {
+        if (t.first == "matrix" || t.first == "log_camera" || t.first == "cdl"
+            || t.first == "grading_primary" || t.first == "lut3d_tetrahedral")
+        {
+            group->appendTransform(t.second->createEditableCopy());
+        }
+    }
+
+    return group;
+}
+
+OCIO::ConfigRcPtr CreateConfigWithoutCache()
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+    return config;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Synthetic files.
+
+constexpr char SyntheticConfig[] = R"(ocio_profile_version: 2
+
+search_path: luts
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: raw
+  scene_linear: ACEScg
+  compositing_log: ACEScct
+  color_timing: ACEScct
+  data: raw
+
+file_rules:
+  - !<Rule> {name: LogFiles, pattern: "*_log_*", colorspace: ACEScct}
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+    - !<View> {name: Film, colorspace: sRGB, looks: grade}
+  Rec709:
+    - !<View> {name: Raw, colorspace: raw}
+    - !<View> {name: Film, colorspace: Rec709, looks: grade}
+
+active_displays: []
+active_views: []
+
+looks:
+  - !<Look>
+    name: grade
+    process_space: ACEScct
+    transform: !<CDLTransform> {slope: [1.1, 1, 0.9], offset: [0.01, 0, -0.01], power: [1.2, 1, 0.8], sat: 0.9}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    isdata: true
+
+  - !<ColorSpace>
+    name: ACES2065-1
+    aliases: [aces]
+    to_reference: !<MatrixTransform> {matrix: [0.695452241357, 0.140678696470, 0.163869062172, 0, 0.044794563372, 0.859671118456, 0.095534318172, 0, -0.005525882558, 0.004025210306, 1.001500672252, 0, 0, 0, 0, 1]}
+
+  - !<ColorSpace>
+    name: ACEScg
+    aliases: [lin_ap1]
+
+  - !<ColorSpace>
+    name: ACEScct
+    aliases: [acescct_ap1]
+    to_reference: !<LogCameraTransform> {base: 2, log_side_slope: 0.0570776255707763, log_side_offset: 0.554794520547945, lin_side_break: 0.0078125, direction: inverse}
+
+  - !<ColorSpace>
+    name: Linear Rec.709
+    aliases: [lin_rec709]
+    from_reference: !<MatrixTransform> {matrix: [1.705051, -0.621792, -0.083259, 0, -0.130257, 1.140805, -0.010548, 0, -0.024004, -0.128969, 1.152972, 0, 0, 0, 0, 1]}
+
+  - !<ColorSpace>
+    name: sRGB
+    from_reference: !<GroupTransform>
+      children:
+        - !<MatrixTransform> {matrix: [1.705051, -0.621792, -0.083259, 0, -0.130257, 1.140805, -0.010548, 0, -0.024004, -0.128969, 1.152972, 0, 0, 0, 0, 1]}
+        - !<ExponentWithLinearTransform> {gamma: 2.4, offset: 0.055, direction: inverse}
+
+  - !<ColorSpace>
+    name: Rec709
+    from_reference: !<GroupTransform>
+      children:
+        - !<MatrixTransform> {matrix: [1.705051, -0.621792, -0.083259, 0, -0.130257, 1.140805, -0.010548, 0, -0.024004, -0.128969, 1.152972, 0, 0, 0, 0, 1]}
+        - !<ExponentWithLinearTransform> {gamma: 2.222222222222222, offset: 0.099, direction: inverse}
+)";
+
+std::string GetTempDirectory()
+{
+    for (const char * name : { "TMPDIR", "TEMP", "TMP" })
+    {
+        const char * dir = std::getenv(name);
+        if (dir && *dir)
+        {
+            return dir;
+        }
+    }
+#ifdef _WIN32
+    return ".";
+#else
+    return "/tmp";
+#endif
+}
+
+// Write the LUT files used by the file parsing benchmarks and remove them at the end.
+class SyntheticLutFiles
+{
+public:
+    SyntheticLutFiles()
+    {
+        constexpr unsigned long length   = 4096;
+        constexpr unsigned long gridSize = 33;
+
+        {
+            std::ostringstream oss;
+            oss << "Version 1\nFrom 0.0 1.0\nLength " << length << "\nComponents 1\n{\n";
+            for (unsigned long idx = 0; idx < length; ++idx)
+            {
+                oss << "    " << std::pow(float(idx) / float(length - 1), 1.0f / 2.2f) << "\n";
+            }
+            oss << "}\n";
+            write("lut1d.spi1d", oss.str());
+        }
+        {
+            // The red index changes the fastest.
+            std::ostringstream oss;
+            oss << "LUT_3D_SIZE " << gridSize << "\n";
+            for (unsigned long b = 0; b < gridSize; ++b)
+            {
+                for (unsigned long g = 0; g < gridSize; ++g)
+                {
+                    for (unsigned long r = 0; r < gridSize; ++r)
+                    {
+                        writeRGB(oss, r, g, b, gridSize);
+                    }
+                }
+            }
+            write("lut3d.cube", oss.str());
+        }
+        {
+            std::ostringstream oss;
+            oss << "SPILUT 1.0\n3 3\n" << gridSize << " " << gridSize << " " << gridSize << "\n";
+            for (unsigned long r = 0; r < gridSize; ++r)
+            {
+                for (unsigned long g = 0; g < gridSize; ++g)
+                {
+                    for (unsigned long b = 0; b < gridSize; ++b)
+                    {
+                        oss << r << " " << g << " " << b << " ";
+                        writeRGB(oss, r, g, b, gridSize);
+                    }
+                }
+            }
+            write("lut3d.spi3d", oss.str());
+        }
+        {
+            // The blue index changes the fastest.
+            std::ostringstream oss;
+            oss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                << "<ProcessList id=\"ociobench\" compCLFversion=\"3\">\n"
+                << "    <LUT3D inBitDepth=\"32f\" outBitDepth=\"32f\" interpolation=\"tetrahedral\">\n"
+                << "        <Array dim=\"" << gridSize << " " << gridSize << " " << gridSize
+                << " 3\">\n";
+            for (unsigned long r = 0; r < gridSize; ++r)
+            {
+                for (unsigned long g = 0; g < gridSize; ++g)
+                {
+                    for (unsigned long b = 0; b < gridSize; ++b)
+                    {
+                        writeRGB(oss, r, g, b, gridSize);
+                    }
+                }
+            }
+            oss << "        </Array>\n    </LUT3D>\n</ProcessList>\n";
+            write("lut3d.clf", oss.str());
+        }
+    }
+
+    ~SyntheticLutFiles()
+    {
+        for (const auto & file : m_files)
+        {
+            std::remove(file.second.c_str());
+        }
+    }
+
+    const std::map<std::string, std::string> & getFiles() const { return m_files; }
+
+private:
+    static void writeRGB(std::ostream & os,
+                         unsigned long r, unsigned long g, unsigned long b,
+                         unsigned long gridSize)
+    {
+        const float rv = Lut3DValue(r, gridSize);
+        const float gv = Lut3DValue(g, gridSize);
+        const float bv = Lut3DValue(b, gridSize);
+        os << (0.8f * rv + 0.1f * gv + 0.1f * bv) << " "
+           << (0.1f * rv + 0.8f * gv + 0.1f * bv) << " "
+           << (0.1f * rv + 0.1f * gv + 0.8f * bv) << "\n";
+    }
+
+    void write(const std::string & name, const std::string & content)
+    {
+        std::ostringstream filename;
+        filename << GetTempDirectory() << "/ociobench_" << std::hex
+                 << std::chrono::steady_clock::now().time_since_epoch().count() << "_" << name;
+
+        std::ofstream ofs(filename.str().c_str(), std::ios_base::out | std::ios_base::trunc);
+        if (!ofs.good())
+        {
+            std::ostringstream oss;
+            oss << "Could not write the file '" << filename.str() << "'.";
+            throw OCIO::Exception(oss.str().c_str());
+        }
+        ofs << content;
+
+        m_files[name] = filename.str();
+    }
+
+    std::map<std::string, std::string> m_files;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmark definitions.
+
+// Apply a CPU processor from a source image to a destination image.
+Benchmark CreateApplyBenchmark(const std::string & name,
+                               OCIO::ConstCPUProcessorRcPtr cpu,
+                               const ImageSize & size,
+                               OCIO::ChannelOrdering ordering,
+                               OCIO::BitDepth bitDepth)
+{
+    const bool hasAlpha = ordering == OCIO::CHANNEL_ORDERING_RGBA
+                          || ordering == OCIO::CHANNEL_ORDERING_BGRA
+                          || ordering == OCIO::CHANNEL_ORDERING_ABGR;
+    const size_t numChannels = hasAlpha ? 4 : 3;
+
+    auto src = std::make_shared<SyntheticImage>(size, numChannels, bitDepth);
+    auto dst = std::make_shared<SyntheticImage>(size, numChannels, bitDepth);
+
+    Benchmark benchmark;
+    benchmark.m_name      = name;
+    benchmark.m_numPixels = size.numPixels();
+    benchmark.m_run       = [cpu, src, dst, size, ordering, bitDepth]()
+    {
+        OCIO::PackedImageDesc srcDesc(src->data(), size.m_width, size.m_height, ordering,
+                                      bitDepth, OCIO::AutoStride, OCIO::AutoStride,
+                                      OCIO::AutoStride);
+        OCIO::PackedImageDesc dstDesc(dst->data(), size.m_width, size.m_height, ordering,
+                                      bitDepth, OCIO::AutoStride, OCIO::AutoStride,
+                                      OCIO::AutoStride);
+        cpu->apply(srcDesc, dstDesc);
+    };
+    return benchmark;
+}
+
+Benchmark CreatePlanarApplyBenchmark(const std::string & name,
+                                     OCIO::ConstCPUProcessorRcPtr cpu,
+                                     const ImageSize & size,
+                                     OCIO::BitDepth bitDepth)
+{
+    auto src = std::make_shared<SyntheticImage>(size, 4, bitDepth);
+    auto dst = std::make_shared<SyntheticImage>(size, 4, bitDepth);
+
+    Benchmark benchmark;
+    benchmark.m_name      = name;
+    benchmark.m_numPixels = size.numPixels();
+    benchmark.m_run       = [cpu, src, dst, size, bitDepth]()
+    {
+        OCIO::PlanarImageDesc srcDesc(src->plane(0), src->plane(1), src->plane(2), src->plane(3),
+                                      size.m_width, size.m_height, bitDepth,
+                                      OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PlanarImageDesc dstDesc(dst->plane(0), dst->plane(1), dst->plane(2), dst->plane(3),
+                                      size.m_width, size.m_height, bitDepth,
+                                      OCIO::AutoStride, OCIO::AutoStride);
+        cpu->apply(srcDesc, dstDesc);
+    };
+    return benchmark;
+}
+
+void AddCPUBenchmarks(std::vector<Benchmark> & benchmarks, const std::vector<ImageSize> & sizes)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    // Each CPU renderer i.e. without optimizations to preserve the ops.
+    const auto transforms = CreateOpTransforms();
+    for (const auto & size : sizes)
+    {
+        for (const auto & t : transforms)
+        {
+            OCIO::ConstCPUProcessorRcPtr cpu
+                = config->getProcessor(t.second)->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE);
+
+            benchmarks.push_back(CreateApplyBenchmark("cpu/op/" + t.first + "/" + size.str(),
+                                                      cpu, size, OCIO::CHANNEL_ORDERING_RGBA,
+                                                      OCIO::BIT_DEPTH_F32));
+        }
+    }
+
+    // The pack and unpack of all the bit-depths and channel orderings.
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    matrix->setMatrix(Matrix);
+    OCIO::ConstProcessorRcPtr matrixProc = config->getProcessor(matrix);
+
+    const std::vector<std::pair<std::string, OCIO::BitDepth>> bitDepths{
+        { "uint8",  OCIO::BIT_DEPTH_UINT8  },
+        { "uint10", OCIO::BIT_DEPTH_UINT10 },
+        { "uint12", OCIO::BIT_DEPTH_UINT12 },
+        { "uint16", OCIO::BIT_DEPTH_UINT16 },
+        { "f16",    OCIO::BIT_DEPTH_F16    },
+        { "f32",    OCIO::BIT_DEPTH_F32    }
+    };
+
+    const std::vector<std::pair<std::string, OCIO::ChannelOrdering>> orderings{
+        { "rgba", OCIO::CHANNEL_ORDERING_RGBA },
+        { "bgra", OCIO::CHANNEL_ORDERING_BGRA },
+        { "abgr", OCIO::CHANNEL_ORDERING_ABGR },
+        { "rgb",  OCIO::CHANNEL_ORDERING_RGB  },
+        { "bgr",  OCIO::CHANNEL_ORDERING_BGR  }
+    };
+
+    for (const auto & size : sizes)
+    {
+        for (const auto & bd : bitDepths)
+        {
+            OCIO::ConstCPUProcessorRcPtr cpu
+                = matrixProc->getOptimizedCPUProcessor(bd.second, bd.second,
+                                                       OCIO::OPTIMIZATION_DEFAULT);
+
+            for (const auto & ordering : orderings)
+            {
+                benchmarks.push_back(
+                    CreateApplyBenchmark("cpu/scanline/" + bd.first + "/" + ordering.first
+                                             + "/" + size.str(),
+                                         cpu, size, ordering.second, bd.second));
+            }
+
+            benchmarks.push_back(
+                CreatePlanarApplyBenchmark("cpu/scanline/" + bd.first + "/planar/" + size.str(),
+                                           cpu, size, bd.second));
+        }
+    }
+
+    // A typical pipeline processed in one call, line by line and pixel per pixel.
+    OCIO::ConstCPUProcessorRcPtr pipeline
+        = config->getProcessor(CreatePipelineTransform())->getDefaultCPUProcessor();
+
+    for (const auto & size : sizes)
+    {
+        benchmarks.push_back(CreateApplyBenchmark("cpu/pipeline/image/" + size.str(),
+                                                  pipeline, size, OCIO::CHANNEL_ORDERING_RGBA,
+                                                  OCIO::BIT_DEPTH_F32));
+
+        auto img = std::make_shared<SyntheticImage>(size, 4, OCIO::BIT_DEPTH_F32);
+
+        Benchmark lines;
+        lines.m_name      = "cpu/pipeline/lines/" + size.str();
+        lines.m_numPixels = size.numPixels();
+        lines.m_run       = [pipeline, img, size]()
+        {
+            float * line = reinterpret_cast<float *>(img->data());
+            for (long h = 0; h < size.m_height; ++h)
+            {
+                OCIO::PackedImageDesc desc(line, size.m_width, 1, 4);
+                pipeline->apply(desc);
+                line += size.m_width * 4;
+            }
+        };
+        benchmarks.push_back(lines);
+
+        Benchmark pixels;
+        pixels.m_name      = "cpu/pipeline/pixels/" + size.str();
+        pixels.m_numPixels = size.numPixels();
+        pixels.m_run       = [pipeline, img, size]()
+        {
+            float * pixel = reinterpret_cast<float *>(img->data());
+            for (size_t idx = 0; idx < size.numPixels(); ++idx)
+            {
+                pipeline->applyRGBA(pixel);
+                pixel += 4;
+            }
+        };
+        benchmarks.push_back(pixels);
+    }
+}
+
+void AddProcessorBenchmarks(std::vector<Benchmark> & benchmarks)
+{
+    OCIO::ConstTransformRcPtr pipeline = CreatePipelineTransform();
+
+    {
+        Benchmark benchmark;
+        benchmark.m_name = "processor/create/pipeline";
+        benchmark.m_run  = [pipeline]()
+        {
+            CreateConfigWithoutCache()->getProcessor(pipeline);
+        };
+        benchmarks.push_back(benchmark);
+    }
+
+    const std::vector<std::pair<std::string, OCIO::OptimizationFlags>> flags{
+        { "none",      OCIO::OPTIMIZATION_NONE      },
+        { "lossless",  OCIO::OPTIMIZATION_LOSSLESS  },
+        { "very_good", OCIO::OPTIMIZATION_VERY_GOOD },
+        { "good",      OCIO::OPTIMIZATION_GOOD      },
+        { "draft",     OCIO::OPTIMIZATION_DRAFT     }
+    };
+
+    for (const auto & flag : flags)
+    {
+        // A new processor for each iteration as the processor caches its CPU processors.
+        auto proc = std::make_shared<OCIO::ConstProcessorRcPtr>();
+
+        Benchmark benchmark;
+        benchmark.m_name    = "processor/optimize_cpu/" + flag.first;
+        benchmark.m_prepare = [pipeline, proc]()
+        {
+            *proc = CreateConfigWithoutCache()->getProcessor(pipeline);
+        };
+        const OCIO::OptimizationFlags oFlags = flag.second;
+        benchmark.m_run = [proc, oFlags]()
+        {
+            (*proc)->getOptimizedCPUProcessor(oFlags);
+        };
+        benchmarks.push_back(benchmark);
+    }
+
+    {
+        Benchmark benchmark;
+        benchmark.m_name    = "processor/config/display_view";
+        benchmark.m_prepare = []()
+        {
+            OCIO::ClearAllCaches();
+        };
+        benchmark.m_run = []()
+        {
+            std::istringstream iss(SyntheticConfig);
+            OCIO::ConfigRcPtr config = OCIO::Config::CreateFromStream(iss)->createEditableCopy();
+            config->setProcessorCacheFlags(OCIO::PROCESSOR_CACHE_OFF);
+            config->getProcessor("ACES2065-1", "sRGB", "Film", OCIO::TRANSFORM_DIR_FORWARD);
+        };
+        benchmarks.push_back(benchmark);
+    }
+}
+
+void AddConfigBenchmarks(std::vector<Benchmark> & benchmarks)
+{
+    {
+        Benchmark benchmark;
+        benchmark.m_name = "config/load";
+        benchmark.m_run  = []()
+        {
+            std::istringstream iss(SyntheticConfig);
+            OCIO::Config::CreateFromStream(iss);
+        };
+        benchmarks.push_back(benchmark);
+    }
+    {
+        Benchmark benchmark;
+        benchmark.m_name = "config/validate";
+        auto config = std::make_shared<OCIO::ConstConfigRcPtr>();
+        benchmark.m_prepare = [config]()
+        {
+            std::istringstream iss(SyntheticConfig);
+            *config = OCIO::Config::CreateFromStream(iss);
+        };
+        benchmark.m_run = [config]()
+        {
+            (*config)->validate();
+        };
+        benchmarks.push_back(benchmark);
+    }
+    {
+        Benchmark benchmark;
+        benchmark.m_name = "config/serialize";
+        std::istringstream iss(SyntheticConfig);
+        OCIO::ConstConfigRcPtr config = OCIO::Config::CreateFromStream(iss);
+        benchmark.m_run = [config]()
+        {
+            std::ostringstream oss;
+            config->serialize(oss);
+        };
+        benchmarks.push_back(benchmark);
+    }
+}
+
+void AddLutFileBenchmarks(std::vector<Benchmark> & benchmarks, const SyntheticLutFiles & files)
+{
+    for (const auto & file : files.getFiles())
+    {
+        OCIO::FileTransformRcPtr transform = OCIO::FileTransform::Create();
+        transform->setSrc(file.second.c_str());
+        transform->setInterpolation(OCIO::INTERP_BEST);
+
+        Benchmark benchmark;
+        benchmark.m_name    = "lut_file/parse/" + file.first;
+        // Note: Only the in-memory file cache is cleared i.e. the OCIO_FILE_CACHE_DIR env.
+        // variable must not be set to measure the file parsing.
+        benchmark.m_prepare = []()
+        {
+            OCIO::ClearAllCaches();
+        };
+        benchmark.m_run = [transform]()
+        {
+            CreateConfigWithoutCache()->getProcessor(transform);
+        };
+        benchmarks.push_back(benchmark);
+    }
+}
+
+void AddGPUBenchmarks(std::vector<Benchmark> & benchmarks)
+{
+    const std::vector<std::pair<std::string, OCIO::GpuLanguage>> languages{
+        { "glsl_1.3",  OCIO::GPU_LANGUAGE_GLSL_1_3  },
+        { "glsl_4.0",  OCIO::GPU_LANGUAGE_GLSL_4_0  },
+        { "hlsl_dx11", OCIO::GPU_LANGUAGE_HLSL_DX11 }
+    };
+
+    OCIO::ConstTransformRcPtr pipeline = CreatePipelineTransform();
+
+    for (const auto & language : languages)
+    {
+        // A new processor for each iteration as the processor caches its GPU processors.
+        auto proc = std::make_shared<OCIO::ConstProcessorRcPtr>();
+
+        Benchmark benchmark;
+        benchmark.m_name    = "gpu/shader/" + language.first + "/pipeline";
+        benchmark.m_prepare = [pipeline, proc]()
+        {
+            *proc = CreateConfigWithoutCache()->getProcessor(pipeline);
+        };
+        const OCIO::GpuLanguage lang = language.second;
+        benchmark.m_run = [proc, lang]()
+        {
+            OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+            shaderDesc->setLanguage(lang);
+
+            OCIO::ConstGPUProcessorRcPtr gpu
+                = (*proc)->getOptimizedGPUProcessor(OCIO::OPTIMIZATION_DEFAULT);
+            gpu->extractGpuShaderInfo(shaderDesc);
+
+            // Force the shader text generation.
+            shaderDesc->getShaderText();
+        };
+        benchmarks.push_back(benchmark);
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Reports.
+
+std::string JsonEscape(const std::string & str)
+{
+    std::string res;
+    for (const char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            res += '\\';
+        }
+        res += c;
+    }
+    return res;
+}
+
+// Note: Each benchmark is on its own line so the baseline file is easy to read back
+// (refer to ReadBaseline()).
+void WriteJson(std::ostream & os, const std::vector<Result> & results)
+{
+    os << "{\n"
+       << "  \"ocio_version\": \"" << OCIO::GetVersion() << "\",\n"
+       << "  \"benchmarks\": [\n";
+
+    for (size_t idx = 0; idx < results.size(); ++idx)
+    {
+        const Result & res = results[idx];
+        os << "    { \"name\": \"" << JsonEscape(res.m_name) << "\""
+           << ", \"iterations\": " << res.m_iterations
+           << std::setprecision(6)
+           << ", \"min_ms\": " << res.m_min
+           << ", \"median_ms\": " << res.m_median
+           << ", \"mean_ms\": " << res.m_mean
+           << ", \"max_ms\": " << res.m_max
+           << ", \"mpixels_per_s\": " << res.m_mpixelsPerSec
+           << " }" << (idx + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    os << "  ]\n"
+       << "}\n";
+}
+
+// Read back the median durations from a JSON file written by WriteJson().
+std::map<std::string, double> ReadBaseline(const std::string & filename)
+{
+    std::ifstream ifs(filename.c_str());
+    if (!ifs.good())
+    {
+        std::ostringstream oss;
+        oss << "Could not read the baseline file '" << filename << "'.";
+        throw OCIO::Exception(oss.str().c_str());
+    }
+
+    static const std::string nameKey("\"name\": \"");
+    static const std::string medianKey("\"median_ms\": ");
+
+    std::map<std::string, double> medians;
+
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        const size_t namePos   = line.find(nameKey);
+        const size_t medianPos = line.find(medianKey);
+        if (namePos == std::string::npos || medianPos == std::string::npos)
+        {
+            continue;
+        }
+
+        const size_t nameStart = namePos + nameKey.size();
+        const size_t nameEnd   = line.find('"', nameStart);
+        if (nameEnd == std::string::npos)
+        {
+            continue;
+        }
+
+        medians[line.substr(nameStart, nameEnd - nameStart)]
+            = std::strtod(line.c_str() + medianPos + medianKey.size(), nullptr);
+    }
+
+    return medians;
+}
+
+} // anon.
+
+
+int main(int argc, const char ** argv)
+{
+    bool help = false;
+    bool list = false;
+    std::string filter;
+    int iterations = 10;
+    std::string sizesStr("256x256,1920x1080");
+    std::string jsonFile;
+    std::string baselineFile;
+    float threshold = 0.0f;
+
+    ArgParse ap;
+    ap.options("ociobench -- measure the performance of OpenColorIO on synthetic data\n\n"
+               "usage: ociobench [options]\n\n",
+               "--help", &help, "Display the help and exit",
+               "--list", &list, "List the benchmark names and exit",
+               "--filter %s", &filter, "Only run the benchmarks whose name contains the string",
+               "--iter %d", &iterations, "Number of measured iterations per benchmark. Default is 10",
+               "--sizes %s", &sizesStr, "Comma separated list of image sizes. "\
+                                        "Default is 256x256,1920x1080",
+               "--json %s", &jsonFile, "Write the results in a JSON file ('-' for the standard output)",
+               "--baseline %s", &baselineFile, "Compare with the JSON file of a previous run",
+               "--threshold %f", &threshold, "Exit with an error if a benchmark is slower than "\
+                                             "the baseline by more than this percentage",
+               NULL);
+
+    if (ap.parse(argc, argv) < 0)
+    {
+        std::cerr << ap.geterror() << std::endl;
+        ap.usage();
+        return 1;
+    }
+
+    if (help)
+    {
+        ap.usage();
+        return 0;
+    }
+
+    if (iterations <= 0)
+    {
+        std::cerr << "ERROR: The number of iterations must be positive." << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        const std::vector<ImageSize> sizes = ParseSizes(sizesStr);
+
+        std::map<std::string, double> baseline;
+        if (!baselineFile.empty())
+        {
+            baseline = ReadBaseline(baselineFile);
+        }
+
+        const SyntheticLutFiles lutFiles;
+
+        std::vector<Benchmark> benchmarks;
+        AddCPUBenchmarks(benchmarks, sizes);
+        AddProcessorBenchmarks(benchmarks);
+        AddConfigBenchmarks(benchmarks);
+        AddLutFileBenchmarks(benchmarks, lutFiles);
+        AddGPUBenchmarks(benchmarks);
+
+        if (list)
+        {
+            for (const auto & benchmark : benchmarks)
+            {
+                std::cout << benchmark.m_name << std::endl;
+            }
+            return 0;
+        }
+
+        // The report goes to the standard error when the JSON goes to the standard output.
+        std::ostream & report = (jsonFile == "-") ? std::cerr : std::cout;
+
+        report << "OCIO Version: " << OCIO::GetVersion() << std::endl << std::endl;
+
+        std::vector<Result> results;
+        unsigned numRegressions = 0;
+
+        for (const auto & benchmark : benchmarks)
+        {
+            if (!filter.empty() && benchmark.m_name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            const Result res = Run(benchmark, unsigned(iterations));
+            results.push_back(res);
+
+            report << std::left << std::setw(48) << res.m_name << std::right
+                   << std::fixed << std::setprecision(4)
+                   << " median: " << std::setw(10) << res.m_median << " ms"
+                   << "  min: " << std::setw(10) << res.m_min << " ms";
+
+            if (res.m_mpixelsPerSec > 0.)
+            {
+                report << std::setprecision(2)
+                       << "  " << std::setw(9) << res.m_mpixelsPerSec << " Mpix/s";
+            }
+
+            const auto ref = baseline.find(res.m_name);
+            if (ref != baseline.end() && ref->second > 0.)
+            {
+                const double change = (res.m_median - ref->second) / ref->second * 100.;
+                report << std::setprecision(1) << "  " << std::showpos << change << std::noshowpos
+                       << "%";
+
+                if (threshold > 0.0f && change > double(threshold))
+                {
+                    report << " REGRESSION";
+                    ++numRegressions;
+                }
+            }
+
+            report << std::defaultfloat << std::endl;
+        }
+
+        if (!jsonFile.empty())
+        {
+            if (jsonFile == "-")
+            {
+                WriteJson(std::cout, results);
+            }
+            else
+            {
+                std::ofstream ofs(jsonFile.c_str(), std::ios_base::out | std::ios_base::trunc);
+                if (!ofs.good())
+                {
+                    std::ostringstream oss;
+                    oss << "Could not write the file '" << jsonFile << "'.";
+                    throw OCIO::Exception(oss.str().c_str());
+                }
+                WriteJson(ofs, results);
+            }
+        }
+
+        if (numRegressions > 0)
+        {
+            std::cerr << std::endl << "ERROR: " << numRegressions
+                      << " benchmark(s) slower than the baseline by more than "
+                      << threshold << "%." << std::endl;
+            return 1;
+        }
+    }
+    catch (std::exception & ex)
+    {
+        std::cerr << "ERROR: " << ex.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "ERROR: Unknown error encountered." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
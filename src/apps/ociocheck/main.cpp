@@ -1,10 +1,15 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <fstream>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -19,11 +24,85 @@ const char * DESC_STRING = "\n\n"
 "For example, it is possible that the configuration may reference\n"
 "lookup tables that do not exist. ociocheck will find these cases.\n\n"
 "ociocheck can also be used to clean up formatting on an existing profile\n"
-"that has been manually edited, using the '-o' option.\n";
+"that has been manually edited, using the '-o' option.\n\n"
+"ociocheck can also write the precompiled version of a valid configuration\n"
+"(i.e. 'config.ocioc' next to 'config.ocio') using the '--precompile' option.\n"
+"The precompiled configuration is then used when loading the configuration file.\n\n"
+"The processors are built in parallel (refer to the '--threads' option) and the\n"
+"slowest ones are listed at the end of the checks.\n";
+
+namespace
+{
+
+// A processor to build i.e. a check which could be run concurrently with the others.
+struct Check
+{
+    Check(std::string label, std::function<void()> check)
+        :   m_label(std::move(label))
+        ,   m_check(std::move(check))
+    {
+    }
+
+    std::string m_label;
+    std::function<void()> m_check;
+
+    bool m_failed = false;
+    std::string m_errorText;
+    double m_seconds = 0.;
+};
+
+// Run the checks using a pool of threads.
+void RunChecks(std::vector<Check> & checks, int numThreads)
+{
+    std::atomic<size_t> nextCheck{ 0 };
+
+    auto worker = [&checks, &nextCheck]()
+    {
+        for (size_t idx = nextCheck++; idx < checks.size(); idx = nextCheck++)
+        {
+            Check & check = checks[idx];
+
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                check.m_check();
+            }
+            catch (std::exception & e)
+            {
+                check.m_failed    = true;
+                check.m_errorText = e.what();
+            }
+            catch (...)
+            {
+                check.m_failed    = true;
+                check.m_errorText = "Unknown error encountered.";
+            }
+            check.m_seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int idx = 1; idx < numThreads; ++idx)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+}
+
+} // anon.
 
 int main(int argc, const char **argv)
 {
     bool help = false;
+    bool precompile = false;
+    int numThreads = 0;
+    int numSlowest = 10;
     int errorcount = 0;
     std::string inputconfig;
     std::string outputconfig;
@@ -34,6 +113,10 @@ int main(int argc, const char **argv)
                "--help", &help, "Print help message",
                "--iconfig %s", &inputconfig, "Input .ocio configuration file (default: $OCIO)",
                "--oconfig %s", &outputconfig, "Output .ocio file",
+               "--precompile", &precompile, "Write the precompiled version of the input config",
+               "--threads %d", &numThreads, "Number of threads building the processors "
+                                            "(default: the number of cores)",
+               "--slowest %d", &numSlowest, "Number of slowest processors to list (default: 10)",
                NULL);
 
     if (ap.parse(argc, argv) < 0)
@@ -51,9 +134,15 @@ int main(int argc, const char **argv)
         return 1;
     }
 
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    }
+
     try
     {
         OCIO::ConstConfigRcPtr config;
+        std::string configFilename;
 
         std::cout << std::endl;
         std::cout << "OpenColorIO Library Version: " << OCIO::GetVersion() << std::endl;
@@ -64,12 +153,14 @@ int main(int argc, const char **argv)
             std::cout << std::endl;
             std::cout << "Loading " << inputconfig << std::endl;
             config = OCIO::Config::CreateFromFile(inputconfig.c_str());
+            configFilename = inputconfig;
         }
         else if(OCIO::GetEnvVariable("OCIO"))
         {
             std::cout << std::endl;
             std::cout << "Loading $OCIO " << OCIO::GetEnvVariable("OCIO") << std::endl;
             config = OCIO::Config::CreateFromEnv();
+            configFilename = OCIO::GetEnvVariable("OCIO");
         }
         else
         {
@@ -110,6 +201,95 @@ int main(int argc, const char **argv)
         std::cout << "Search Path: " << config->getSearchPath() << std::endl;
         std::cout << "Working Dir: " << config->getWorkingDir() << std::endl;
 
+        // Build all the processors upfront (i.e. in parallel), the results are then reported
+        // section by section.
+
+        std::vector<Check> checks;
+
+        // Check the (display, view) pairs.
+        const size_t viewChecksBegin = checks.size();
+        if (config->getNumDisplays() > 0 && config->getNumColorSpaces() > 0)
+        {
+            const std::string inputColorSpace = config->getColorSpaceNameByIndex(0);
+
+            for (int idxDisp = 0; idxDisp < config->getNumDisplays(); ++idxDisp)
+            {
+                const std::string displayName = config->getDisplay(idxDisp);
+                for (int idxView = 0; idxView < config->getNumViews(displayName.c_str()); ++idxView)
+                {
+                    const std::string viewName = config->getView(displayName.c_str(), idxView);
+
+                    checks.emplace_back("(" + displayName + ", " + viewName + ")",
+                        [config, inputColorSpace, displayName, viewName]()
+                        {
+                            config->getProcessor(inputColorSpace.c_str(),
+                                                 displayName.c_str(),
+                                                 viewName.c_str(),
+                                                 OCIO::TRANSFORM_DIR_FORWARD);
+                        });
+                }
+            }
+        }
+        const size_t viewChecksEnd = checks.size();
+
+        // Check the color spaces to & from the scene_linear role.
+        OCIO::ConstColorSpaceRcPtr lin = config->getColorSpace(OCIO::ROLE_SCENE_LINEAR);
+        const size_t colorSpaceChecksBegin = checks.size();
+        if (lin)
+        {
+            for (int i = 0; i < config->getNumColorSpaces(); ++i)
+            {
+                OCIO::ConstColorSpaceRcPtr cs
+                    = config->getColorSpace(config->getColorSpaceNameByIndex(i));
+
+                checks.emplace_back(std::string(cs->getName()) + " to " + lin->getName(),
+                                    [config, cs, lin]() { config->getProcessor(cs, lin); });
+                checks.emplace_back(std::string(lin->getName()) + " to " + cs->getName(),
+                                    [config, cs, lin]() { config->getProcessor(lin, cs); });
+            }
+        }
+
+        // Check the look transforms (-1 when a look does not have the transform).
+        std::vector<std::pair<int, int>> lookChecks;
+        for (int i = 0; i < config->getNumLooks(); ++i)
+        {
+            OCIO::ConstLookRcPtr look = config->getLook(config->getLookNameByIndex(i));
+
+            std::pair<int, int> lookCheck{ -1, -1 };
+
+            OCIO::ConstTransformRcPtr transform = look->getTransform();
+            if (transform)
+            {
+                lookCheck.first = (int)checks.size();
+                checks.emplace_back(std::string("look ") + look->getName(),
+                                    [config, transform]() { config->getProcessor(transform); });
+            }
+
+            OCIO::ConstTransformRcPtr invTransform = look->getInverseTransform();
+            if (invTransform)
+            {
+                lookCheck.second = (int)checks.size();
+                checks.emplace_back(std::string("inverse look ") + look->getName(),
+                                    [config, invTransform]()
+                                    {
+                                        config->getProcessor(invTransform);
+                                    });
+            }
+
+            lookChecks.push_back(lookCheck);
+        }
+
+        const auto checksStart = std::chrono::steady_clock::now();
+        RunChecks(checks, numThreads);
+        const double checksTime = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - checksStart).count();
+
+        // Report the errors like the exceptions thrown by the processor creation.
+        auto printCheckError = [](const Check & check)
+        {
+            std::cerr << "ERROR: " << check.m_errorText << std::endl;
+        };
+
         if (config->getNumDisplays() == 0)
         {
             std::cout << std::endl;
@@ -127,31 +307,17 @@ int main(int argc, const char **argv)
                 std::cout << std::endl;
                 std::cout << "** (Display, View) pairs **" << std::endl;
 
-                const char * inputColorSpace = config->getColorSpaceNameByIndex(0);
-
-                for (int idxDisp = 0; idxDisp < config->getNumDisplays(); ++idxDisp)
+                for (size_t idx = viewChecksBegin; idx < viewChecksEnd; ++idx)
                 {
-                    const char * displayName = config->getDisplay(idxDisp);
-                    for (int idxView = 0; idxView < config->getNumViews(displayName); ++idxView)
+                    const Check & check = checks[idx];
+                    if (check.m_failed)
                     {
-                        const char * viewName = config->getView(displayName, idxView);
-
-                        try
-                        {
-                            OCIO::ConstProcessorRcPtr process 
-                                = config->getProcessor(inputColorSpace, 
-                                                       displayName,
-                                                       viewName,
-                                                       OCIO::TRANSFORM_DIR_FORWARD);
-
-                            std::cout << "(" << displayName << ", " << viewName << ")"
-                                      << std::endl;
-                        }
-                        catch(OCIO::Exception & exception)
-                        {
-                            std::cerr << "ERROR: " << exception.what() << std::endl;
-                            errorcount += 1;
-                        }
+                        printCheckError(check);
+                        errorcount += 1;
+                    }
+                    else
+                    {
+                        std::cout << check.m_label << std::endl;
                     }
                 }
             }
@@ -210,7 +376,6 @@ int main(int argc, const char **argv)
 
         std::cout << std::endl;
         std::cout << "** ColorSpaces **" << std::endl;
-        OCIO::ConstColorSpaceRcPtr lin = config->getColorSpace(OCIO::ROLE_SCENE_LINEAR);
         if(!lin)
         {
             std::cout << "Error: scene_linear role must be defined." << std::endl;
@@ -222,31 +387,14 @@ int main(int argc, const char **argv)
             {
                 OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace(config->getColorSpaceNameByIndex(i));
 
-                bool convertsToLinear = true;
-                std::string convertsToLinearErrorText;
+                const Check & toLinear   = checks[colorSpaceChecksBegin + 2 * i];
+                const Check & fromLinear = checks[colorSpaceChecksBegin + 2 * i + 1];
 
-                bool convertsFromLinear = true;
-                std::string convertsFromLinearErrorText;
-
-                try
-                {
-                    OCIO::ConstProcessorRcPtr p = config->getProcessor(cs, lin);
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    convertsToLinear = false;
-                    convertsToLinearErrorText = exception.what();
-                }
+                const bool convertsToLinear = !toLinear.m_failed;
+                const std::string & convertsToLinearErrorText = toLinear.m_errorText;
 
-                try
-                {
-                    OCIO::ConstProcessorRcPtr p = config->getProcessor(lin, cs);
-                }
-                catch(OCIO::Exception & exception)
-                {
-                    convertsFromLinear = false;
-                    convertsFromLinearErrorText = exception.what();
-                }
+                const bool convertsFromLinear = !fromLinear.m_failed;
+                const std::string & convertsFromLinearErrorText = fromLinear.m_errorText;
 
                 if(convertsToLinear && convertsFromLinear)
                 {
@@ -282,40 +430,24 @@ int main(int argc, const char **argv)
             {
                 std::cout << config->getLookNameByIndex(i) << std::endl;
 
-                OCIO::ConstLookRcPtr look = config->getLook(config->getLookNameByIndex(i)); 
-
-                OCIO::ConstTransformRcPtr transform = look->getTransform();         
-
-                if(transform)
+                for (int checkIdx : { lookChecks[i].first, lookChecks[i].second })
                 {
-                    try
+                    if (checkIdx < 0)
                     {
-                        OCIO::ConstProcessorRcPtr process = config->getProcessor(transform);
-                        std::cout << "src file found" << std::endl;
+                        continue;
                     }
-                    catch(OCIO::Exception & exception)
+
+                    const Check & check = checks[checkIdx];
+                    if (check.m_failed)
                     {
-                        std::cerr << "ERROR: " << exception.what() << std::endl;
+                        printCheckError(check);
                         errorcount += 1;
                     }
-                }
-
-                OCIO::ConstTransformRcPtr invTransform = look->getInverseTransform();         
-
-                if(invTransform)
-                {
-                    try
+                    else
                     {
-                        OCIO::ConstProcessorRcPtr process = config->getProcessor(invTransform);
                         std::cout << "src file found" << std::endl;
                     }
-                    catch(OCIO::Exception & exception)
-                    {
-                        std::cerr << "ERROR: " << exception.what() << std::endl;
-                        errorcount += 1;
-                    }
                 }
-
             }
         }
         else
@@ -337,6 +469,34 @@ int main(int argc, const char **argv)
             std::cout << exception.what() << std::endl;
         }
 
+        std::cout << std::endl;
+        std::cout << "** Processors **" << std::endl;
+        std::cout << checks.size() << " processors built in " << checksTime * 1000.0
+                  << " ms using " << numThreads << " threads." << std::endl;
+
+        if (numSlowest > 0 && !checks.empty())
+        {
+            std::vector<const Check *> slowest;
+            for (const auto & check : checks)
+            {
+                slowest.push_back(&check);
+            }
+
+            const size_t numListed = std::min(slowest.size(), (size_t)numSlowest);
+            std::partial_sort(slowest.begin(), slowest.begin() + numListed, slowest.end(),
+                              [](const Check * a, const Check * b)
+                              {
+                                  return a->m_seconds > b->m_seconds;
+                              });
+
+            std::cout << "Slowest:" << std::endl;
+            for (size_t idx = 0; idx < numListed; ++idx)
+            {
+                std::cout << "  " << slowest[idx]->m_seconds * 1000.0 << " ms  "
+                          << slowest[idx]->m_label << std::endl;
+            }
+        }
+
         if(!outputconfig.empty())
         {
             std::ofstream output;
@@ -353,6 +513,20 @@ int main(int argc, const char **argv)
                 std::cout << "Wrote " << outputconfig << std::endl;
             }
         }
+
+        if (precompile)
+        {
+            if (errorcount == 0)
+            {
+                OCIO::Config::PrecompileFile(configFilename.c_str());
+                std::cout << "Wrote " << configFilename << "c" << std::endl;
+            }
+            else
+            {
+                std::cout << "Skipped the precompilation of an invalid config." << std::endl;
+                errorcount += 1;
+            }
+        }
     }
     catch(OCIO::Exception & exception)
     {
@@ -1,10 +1,15 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -53,6 +58,69 @@ bool StringToInt(int * ival, const char * str);
 
 bool StringToVector(std::vector<int> * ivector, const char * str);
 
+bool SetAttributes(OIIO::ImageSpec & spec,
+                   const std::vector<std::string> & floatAttrs,
+                   const std::vector<std::string> & intAttrs,
+                   const std::vector<std::string> & stringAttrs);
+
+int StreamConvert(const char * inputimage,
+                  const char * outputimage,
+                  const OCIO::ConstProcessorRcPtr & processor,
+                  const std::vector<std::string> & floatAttrs,
+                  const std::vector<std::string> & intAttrs,
+                  const std::vector<std::string> & stringAttrs,
+                  int numThreads,
+                  int chunkHeight,
+                  bool verbose);
+
+// Get the processor from the current config, or from the LUT file when lutFile is not null,
+// or to the (display, view) pair when display is not null. Exit on failure.
+OCIO::ConstProcessorRcPtr GetProcessor(const char * lutFile,
+                                       const char * inputcolorspace,
+                                       const char * outputcolorspace,
+                                       const char * display,
+                                       const char * view)
+{
+    try
+    {
+        // Load the current config.
+        OCIO::ConstConfigRcPtr config
+            = lutFile ? OCIO::Config::CreateRaw() : OCIO::GetCurrentConfig();
+
+        if (lutFile)
+        {
+            // Create the OCIO processor for the specified transform.
+            OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
+            t->setSrc(lutFile);
+            t->setInterpolation(OCIO::INTERP_BEST);
+
+            return config->getProcessor(t);
+        }
+        else if (display)
+        {
+            OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
+            t->setSrc(inputcolorspace);
+            t->setDisplay(display);
+            t->setView(view);
+            return config->getProcessor(t);
+        }
+        else
+        {
+            return config->getProcessor(inputcolorspace, outputcolorspace);
+        }
+    }
+    catch (const OCIO::Exception & e)
+    {
+        std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
+        exit(1);
+    }
+    catch (...)
+    {
+        std::cout << "ERROR: Creating processor unknown failure." << std::endl;
+        exit(1);
+    }
+}
+
 int main(int argc, const char **argv)
 {
     ArgParse ap;
@@ -70,6 +138,9 @@ int main(int argc, const char **argv)
     bool help           = false;
     bool useLut         = false;
     bool useDisplayView = false;
+    bool useStreaming   = false;
+    int numThreads      = 0;
+    int chunkHeight     = 64;
 
     ap.options("ocioconvert -- apply colorspace transform to an image \n\n"
                "usage: ocioconvert [options]  inputimage inputcolorspace outputimage outputcolorspace\n"
@@ -84,6 +155,14 @@ int main(int argc, const char **argv)
                "--gpulegacy", &usegpuLegacy,   "Use the legacy (i.e. baked) GPU color processing "
                                                "instead of the CPU one (--gpu is ignored)",
                "--gpuinfo",  &outputgpuInfo,   "Output the OCIO shader program",
+               "--stream",   &useStreaming,    "Convert the image by chunks of scanlines (i.e. "
+                                               "bounded memory) and overlap the reads, the CPU "
+                                               "processing and the writes",
+               "--threads %d", &numThreads,    "Number of processing threads for --stream, "
+                                               "which replace the OCIO internal threads "
+                                               "(default: the number of cores)",
+               "--chunk %d", &chunkHeight,     "Number of scanlines per chunk for --stream, "
+                                               "tiled images use rows of tiles (default: 64)",
                "--help",     &help,            "Print help message",
                "-v" ,        &verbose,         "Display general information",
                "<SEPARATOR>", "\nOpenImageIO options:",
@@ -112,6 +191,19 @@ int main(int argc, const char **argv)
         return 0;
     }
 
+    if (useStreaming && (usegpu || usegpuLegacy || croptofull || !keepChannels.empty()))
+    {
+        std::cerr << "ERROR: Option stream can't be used with gpu, gpulegacy, croptofull "
+                  << "or ch options." << std::endl;
+        exit(1);
+    }
+
+    if (chunkHeight <= 0 || numThreads < 0)
+    {
+        std::cerr << "ERROR: Options chunk & threads must be positive." << std::endl;
+        exit(1);
+    }
+
 #ifndef OCIO_GPU_ENABLED
     if (usegpu || outputgpuInfo || usegpuLegacy)
     {
@@ -220,6 +312,21 @@ int main(int argc, const char **argv)
         std::cout << "Using GPU color processing." << std::endl;
     }
 
+    if (useStreaming)
+    {
+        const OCIO::ConstProcessorRcPtr processor
+            = GetProcessor(lutFile, inputcolorspace, outputcolorspace, display, view);
+
+        if (numThreads == 0)
+        {
+            numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+        }
+
+        return StreamConvert(inputimage, outputimage, processor,
+                             floatAttrs, intAttrs, stringAttrs,
+                             numThreads, chunkHeight, verbose);
+    }
+
     OIIO::ImageSpec spec;
     OCIO::ImgBuffer img;
     int imgwidth = 0;
@@ -447,47 +554,9 @@ int main(int argc, const char **argv)
     // Process the image.
     try
     {
-        // Load the current config.
-        OCIO::ConstConfigRcPtr config
-            = useLut ? OCIO::Config::CreateRaw() : OCIO::GetCurrentConfig();
-
         // Get the processor.
-        OCIO::ConstProcessorRcPtr processor;
-
-        try
-        {
-            if (useLut)
-            {
-                // Create the OCIO processor for the specified transform.
-                OCIO::FileTransformRcPtr t = OCIO::FileTransform::Create();
-                t->setSrc(lutFile);
-                t->setInterpolation(OCIO::INTERP_BEST);
-    
-                processor = config->getProcessor(t);
-            }
-            else if (useDisplayView)
-            {
-                OCIO::DisplayViewTransformRcPtr t = OCIO::DisplayViewTransform::Create();
-                t->setSrc(inputcolorspace);
-                t->setDisplay(display);
-                t->setView(view);
-                processor = config->getProcessor(t);
-            }
-            else
-            {
-                processor = config->getProcessor(inputcolorspace, outputcolorspace);
-            }
-        }
-        catch (const OCIO::Exception & e)
-        {
-            std::cout << "ERROR: OCIO failed with: " << e.what() << std::endl;
-            exit(1);
-        }
-        catch (...)
-        {
-            std::cout << "ERROR: Creating processor unknown failure." << std::endl;
-            exit(1);
-        }
+        OCIO::ConstProcessorRcPtr processor
+            = GetProcessor(lutFile, inputcolorspace, outputcolorspace, display, view);
 
 #ifdef OCIO_GPU_ENABLED
         if (usegpu || usegpuLegacy)
@@ -549,55 +618,7 @@ int main(int argc, const char **argv)
     //
     // set the provided OpenImageIO attributes.
     //
-    bool parseerror = false;
-    for(unsigned int i=0; i<floatAttrs.size(); ++i)
-    {
-        std::string name, value;
-        float fval = 0.0f;
-
-        if(!ParseNameValuePair(name, value, floatAttrs[i]) ||
-           !StringToFloat(&fval,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
-                      << "' should be in the form name=floatvalue." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, fval);
-    }
-
-    for(unsigned int i=0; i<intAttrs.size(); ++i)
-    {
-        std::string name, value;
-        int ival = 0;
-        if(!ParseNameValuePair(name, value, intAttrs[i]) ||
-           !StringToInt(&ival,value.c_str()))
-        {
-            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
-                      << "' should be in the form name=intvalue." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, ival);
-    }
-
-    for(unsigned int i=0; i<stringAttrs.size(); ++i)
-    {
-        std::string name, value;
-        if(!ParseNameValuePair(name, value, stringAttrs[i]))
-        {
-            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
-                      << "' should be in the form name=value." << std::endl;
-            parseerror = true;
-            continue;
-        }
-
-        spec.attribute(name, value);
-    }
-
-    if(parseerror)
+    if (!SetAttributes(spec, floatAttrs, intAttrs, stringAttrs))
     {
         exit(1);
     }
@@ -705,6 +726,516 @@ bool StringToVector(std::vector<int> * ivector, const char * str)
     return ivector->size() != 0;
 }
 
+// Set the OpenImageIO attributes from the "name=value" pairs.
+// return true on success.
+bool SetAttributes(OIIO::ImageSpec & spec,
+                   const std::vector<std::string> & floatAttrs,
+                   const std::vector<std::string> & intAttrs,
+                   const std::vector<std::string> & stringAttrs)
+{
+    bool parseerror = false;
+    for(unsigned int i=0; i<floatAttrs.size(); ++i)
+    {
+        std::string name, value;
+        float fval = 0.0f;
 
+        if(!ParseNameValuePair(name, value, floatAttrs[i]) ||
+           !StringToFloat(&fval,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << floatAttrs[i]
+                      << "' should be in the form name=floatvalue." << std::endl;
+            parseerror = true;
+            continue;
+        }
 
+        spec.attribute(name, fval);
+    }
 
+    for(unsigned int i=0; i<intAttrs.size(); ++i)
+    {
+        std::string name, value;
+        int ival = 0;
+        if(!ParseNameValuePair(name, value, intAttrs[i]) ||
+           !StringToInt(&ival,value.c_str()))
+        {
+            std::cerr << "ERROR: Attribute string '" << intAttrs[i]
+                      << "' should be in the form name=intvalue." << std::endl;
+            parseerror = true;
+            continue;
+        }
+
+        spec.attribute(name, ival);
+    }
+
+    for(unsigned int i=0; i<stringAttrs.size(); ++i)
+    {
+        std::string name, value;
+        if(!ParseNameValuePair(name, value, stringAttrs[i]))
+        {
+            std::cerr << "ERROR: Attribute string '" << stringAttrs[i]
+                      << "' should be in the form name=value." << std::endl;
+            parseerror = true;
+            continue;
+        }
+
+        spec.attribute(name, value);
+    }
+
+    return !parseerror;
+}
+
+namespace
+{
+
+// A chunk of scanlines (or a row of tiles) flowing through the streaming pipeline.
+struct StreamChunk
+{
+    enum State
+    {
+        FREE,       // Available for the next read.
+        READ,       // Waiting for, or under, the CPU processing.
+        PROCESSED   // Waiting for the write.
+    };
+
+    State m_state = FREE;
+    int m_ybegin  = 0;
+    int m_yend    = 0;
+    OCIO::ImgBuffer m_buffer;
+};
+
+typedef std::chrono::steady_clock Clock;
+
+double ToMilliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Accumulated times of the streaming pipeline stages.
+struct StreamTimes
+{
+    Clock::duration m_read{ 0 };
+    Clock::duration m_process{ 0 };    // Accumulated over all the processing threads.
+    Clock::duration m_write{ 0 };
+};
+
+// Stream the current subimage of the input image to the current subimage of the output image.
+// The main thread reads the chunks, the worker threads process them and a writer thread writes
+// them in order, so the reads, the processing and the writes overlap. The chunk buffers are
+// recycled once written so the memory footprint is bounded by (numThreads + 2) chunks whatever
+// the image size. A tiled image is read one row of tiles at a time (i.e. chunkHeight is then the
+// tile height), and also written that way when the output is tiled. Return an empty string on
+// success, otherwise the error text.
+std::string StreamSubimage(OIIO::ImageInput & in,
+                           OIIO::ImageOutput & out,
+                           const std::string & inputimage,
+                           const std::string & outputimage,
+                           const OIIO::ImageSpec & spec,
+                           const OIIO::ImageSpec & outSpec,
+                           const OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
+                           int numThreads,
+                           int chunkHeight,
+                           StreamTimes & times,
+                           int & numChunks)
+{
+    const bool readTiles  = spec.tile_width > 0;
+    const bool writeTiles = outSpec.tile_width > 0;
+
+    if (readTiles)
+    {
+        chunkHeight = spec.tile_height;
+    }
+
+    numChunks = (spec.height + chunkHeight - 1) / chunkHeight;
+    const int numSlots = std::max(1, std::min(numChunks, numThreads + 2));
+
+    OIIO::ImageSpec chunkSpec = spec;
+    chunkSpec.height = chunkHeight;
+
+    std::vector<StreamChunk> slots(numSlots);
+    for (auto & slot : slots)
+    {
+        slot.m_buffer.allocate(chunkSpec);
+    }
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<int> toProcess;
+    bool readDone = false;
+    bool failed   = false;
+    std::string errorText;
+
+    auto fail = [&](const std::string & text)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failed)
+            {
+                failed    = true;
+                errorText = text;
+            }
+        }
+        cond.notify_all();
+    };
+
+    std::vector<std::thread> workers;
+    for (int idx = 0; idx < numThreads; ++idx)
+    {
+        workers.emplace_back([&]()
+        {
+            for (;;)
+            {
+                int chunkIdx = 0;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cond.wait(lock, [&]() { return failed || readDone || !toProcess.empty(); });
+                    if (failed || toProcess.empty())
+                    {
+                        return;
+                    }
+                    chunkIdx = toProcess.front();
+                    toProcess.pop_front();
+                }
+
+                StreamChunk & chunk = slots[chunkIdx % numSlots];
+
+                const Clock::time_point begin = Clock::now();
+                try
+                {
+                    OIIO::ImageSpec imgSpec = spec;
+                    imgSpec.height = chunk.m_yend - chunk.m_ybegin;
+
+                    OCIO::ImageDescRcPtr imgDesc = OCIO::CreateImageDesc(imgSpec, chunk.m_buffer);
+                    cpuProcessor->apply(*imgDesc);
+                }
+                catch (const OCIO::Exception & e)
+                {
+                    fail(std::string("OCIO failed with: ") + e.what());
+                    return;
+                }
+                catch (const std::exception & e)
+                {
+                    fail(std::string("Processing failed with: ") + e.what());
+                    return;
+                }
+                catch (...)
+                {
+                    fail("Processing failed with an unknown exception.");
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    times.m_process += Clock::now() - begin;
+                    chunk.m_state = StreamChunk::PROCESSED;
+                }
+                cond.notify_all();
+            }
+        });
+    }
+
+    // The chunks are written in order.
+    std::thread writer([&]()
+    {
+        for (int chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+        {
+            StreamChunk & chunk = slots[chunkIdx % numSlots];
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cond.wait(lock, [&]() { return failed || chunk.m_state == StreamChunk::PROCESSED; });
+                if (failed)
+                {
+                    return;
+                }
+            }
+
+            const Clock::time_point begin = Clock::now();
+            try
+            {
+                const bool written
+                    = writeTiles
+                        ? out.write_tiles(spec.x, spec.x + spec.width,
+                                          chunk.m_ybegin, chunk.m_yend,
+                                          spec.z, spec.z + 1,
+                                          spec.format, chunk.m_buffer.getBuffer())
+                        : out.write_scanlines(chunk.m_ybegin, chunk.m_yend, spec.z,
+                                              spec.format, chunk.m_buffer.getBuffer());
+                if (!written)
+                {
+                    fail("Writing \"" + outputimage + "\" failed with: " + out.geterror());
+                    return;
+                }
+            }
+            catch (const std::exception & e)
+            {
+                fail("Writing \"" + outputimage + "\" failed with: " + e.what());
+                return;
+            }
+            catch (...)
+            {
+                fail("Writing \"" + outputimage + "\" failed with an unknown exception.");
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                times.m_write += Clock::now() - begin;
+                chunk.m_state = StreamChunk::FREE;
+            }
+            cond.notify_all();
+        }
+    });
+
+    // Read the chunks as soon as a buffer is available.
+    for (int chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx)
+    {
+        StreamChunk & chunk = slots[chunkIdx % numSlots];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]() { return failed || chunk.m_state == StreamChunk::FREE; });
+            if (failed)
+            {
+                break;
+            }
+        }
+
+        chunk.m_ybegin = spec.y + chunkIdx * chunkHeight;
+        chunk.m_yend   = std::min(chunk.m_ybegin + chunkHeight, spec.y + spec.height);
+
+        const Clock::time_point begin = Clock::now();
+        try
+        {
+            const bool read
+                = readTiles
+                    ? in.read_tiles(spec.x, spec.x + spec.width,
+                                    chunk.m_ybegin, chunk.m_yend,
+                                    spec.z, spec.z + 1,
+                                    spec.format, chunk.m_buffer.getBuffer())
+                    : in.read_scanlines(chunk.m_ybegin, chunk.m_yend, spec.z,
+                                        spec.format, chunk.m_buffer.getBuffer());
+            if (!read)
+            {
+                fail("Reading \"" + inputimage + "\" failed with: " + in.geterror());
+                break;
+            }
+        }
+        catch (const std::exception & e)
+        {
+            fail("Reading \"" + inputimage + "\" failed with: " + e.what());
+            break;
+        }
+        catch (...)
+        {
+            fail("Reading \"" + inputimage + "\" failed with an unknown exception.");
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            times.m_read += Clock::now() - begin;
+            chunk.m_state = StreamChunk::READ;
+            toProcess.push_back(chunkIdx);
+        }
+        cond.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        readDone = true;
+    }
+    cond.notify_all();
+
+    for (auto & worker : workers)
+    {
+        worker.join();
+    }
+    writer.join();
+
+    return failed ? errorText : std::string();
+}
+
+} // anon.
+
+// Convert the image by chunks of scanlines, or by rows of tiles for a tiled image, to bound the
+// memory footprint. All the subimages (e.g. the parts of a multi-part OpenEXR file) are streamed
+// in turn. The processing threads replace the OCIO internal ones so numThreads bounds the number
+// of threads processing the pixels.
+int StreamConvert(const char * inputimage,
+                  const char * outputimage,
+                  const OCIO::ConstProcessorRcPtr & processor,
+                  const std::vector<std::string> & floatAttrs,
+                  const std::vector<std::string> & intAttrs,
+                  const std::vector<std::string> & stringAttrs,
+                  int numThreads,
+                  int chunkHeight,
+                  bool verbose)
+{
+    std::cout << std::endl;
+    std::cout << "Streaming " << inputimage << std::endl;
+
+#if OIIO_VERSION < 10903
+    OIIO::ImageInput * in = OIIO::ImageInput::create(inputimage);
+#else
+    auto in = OIIO::ImageInput::create(inputimage);
+#endif
+    OIIO::ImageSpec spec;
+    if (!in || !in->open(inputimage, spec))
+    {
+        std::cerr << "ERROR: Could not load image: "
+                  << (in ? in->geterror() : OIIO::geterror()) << std::endl;
+        return 1;
+    }
+
+    std::vector<OIIO::ImageSpec> specs{ spec };
+    while (in->seek_subimage(int(specs.size()), 0, spec))
+    {
+        specs.push_back(spec);
+    }
+
+    for (const auto & subimageSpec : specs)
+    {
+        if (subimageSpec.deep || subimageSpec.depth > 1)
+        {
+            std::cerr << "ERROR: Option stream does not support deep or volume images."
+                      << std::endl;
+            return 1;
+        }
+    }
+
+#if OIIO_VERSION < 10903
+    OIIO::ImageOutput * out = OIIO::ImageOutput::create(outputimage);
+#else
+    auto out = OIIO::ImageOutput::create(outputimage);
+#endif
+    if (!out)
+    {
+        std::cerr << "ERROR: Could not create output image: " << OIIO::geterror() << std::endl;
+        return 1;
+    }
+
+    if (specs.size() > 1 && !out->supports("multiimage"))
+    {
+        std::cerr << "WARNING: The output format does not support multiple subimages, only the "
+                  << "first of the " << specs.size() << " subimages is converted." << std::endl;
+        specs.resize(1);
+    }
+
+    // The tiled images stay tiled when the output format supports it.
+    std::vector<OIIO::ImageSpec> outSpecs(specs);
+    for (auto & outSpec : outSpecs)
+    {
+        if (outSpec.tile_width > 0 && !out->supports("tiles"))
+        {
+            outSpec.tile_width  = 0;
+            outSpec.tile_height = 0;
+            outSpec.tile_depth  = 0;
+        }
+
+        if (!SetAttributes(outSpec, floatAttrs, intAttrs, stringAttrs))
+        {
+            return 1;
+        }
+    }
+
+    const bool opened = outSpecs.size() > 1
+                            ? out->open(outputimage, int(outSpecs.size()), outSpecs.data())
+                            : out->open(outputimage, outSpecs[0]);
+    if (!opened)
+    {
+        std::cerr << "ERROR: Could not create output image: " << out->geterror() << std::endl;
+        return 1;
+    }
+
+    // Avoid nesting the OCIO threads in the processing threads.
+    OCIO::SetNumThreads(1);
+
+    StreamTimes times;
+    int numChunks = 0;
+    double numPixels = 0.;
+    double numBytes  = 0.;
+    std::string errorText;
+
+    const Clock::time_point start = Clock::now();
+
+    for (size_t idx = 0; idx < specs.size() && errorText.empty(); ++idx)
+    {
+        if (specs.size() > 1)
+        {
+            std::cout << std::endl;
+            std::cout << "Subimage " << idx << std::endl;
+        }
+        OCIO::PrintImageSpec(specs[idx], verbose);
+
+        if (!in->seek_subimage(int(idx), 0, spec))
+        {
+            errorText = "Reading \"" + std::string(inputimage) + "\" failed with: "
+                        + in->geterror();
+            break;
+        }
+
+        if (idx > 0 && !out->open(outputimage, outSpecs[idx], OIIO::ImageOutput::AppendSubimage))
+        {
+            errorText = "Writing \"" + std::string(outputimage) + "\" failed with: "
+                        + out->geterror();
+            break;
+        }
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+        try
+        {
+            const OCIO::BitDepth bitDepth = OCIO::GetBitDepth(spec);
+            cpuProcessor = processor->getOptimizedCPUProcessor(bitDepth, bitDepth,
+                                                               OCIO::OPTIMIZATION_DEFAULT);
+        }
+        catch (const OCIO::Exception & e)
+        {
+            errorText = std::string("OCIO failed with: ") + e.what();
+            break;
+        }
+
+        int numSubimageChunks = 0;
+        errorText = StreamSubimage(*in, *out, inputimage, outputimage, spec, outSpecs[idx],
+                                   cpuProcessor, numThreads, chunkHeight, times,
+                                   numSubimageChunks);
+
+        numChunks += numSubimageChunks;
+        numPixels += double(spec.width) * spec.height;
+        numBytes  += double(spec.scanline_bytes()) * spec.height;
+    }
+
+    const Clock::duration totalTime = Clock::now() - start;
+
+    in->close();
+    if (errorText.empty())
+    {
+        out->close();
+    }
+
+#if OIIO_VERSION < 10903
+    OIIO::ImageInput::destroy(in);
+    OIIO::ImageOutput::destroy(out);
+#endif
+
+    if (!errorText.empty())
+    {
+        std::cerr << "ERROR: " << errorText << std::endl;
+        return 1;
+    }
+
+    const double seconds = ToMilliseconds(totalTime) / 1000.0;
+
+    std::cout << std::endl;
+    std::cout << "Streamed " << specs.size() << " subimage(s) in " << numChunks
+              << " chunks using " << numThreads << " processing threads." << std::endl;
+    std::cout << "Total time: " << ToMilliseconds(totalTime) << " ms, "
+              << (seconds > 0. ? numPixels / seconds / 1e6 : 0.) << " Mpixels/s, "
+              << (seconds > 0. ? numBytes / seconds / (1024. * 1024.) : 0.) << " MiB/s"
+              << std::endl;
+    std::cout << "Read time: " << ToMilliseconds(times.m_read) << " ms, "
+              << "processing time (all threads): " << ToMilliseconds(times.m_process) << " ms, "
+              << "write time: " << ToMilliseconds(times.m_write) << " ms" << std::endl;
+
+    std::cout << std::endl;
+    std::cout << "Wrote " << outputimage << std::endl;
+
+    return 0;
+}
@@ -1,7 +1,11 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "PyDynamicProperty.h"
@@ -12,8 +16,139 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// Min number of pixels per band, as smaller bands cost more to dispatch than to process.
+constexpr long MIN_BAND_PIXELS = 16 * 1024;
+
+// Apply in place to the pixels of a Python buffer, without copying the values. A contiguous 
+// buffer of any shape is a single row of pixels, while a strided buffer must have a (width, N) 
+// or (height, width, N) shape where N is the number of channels. The image is split in bands 
+// processed in parallel by up to numThreads threads, or all the available threads when 
+// numThreads is 0.
+void applyBuffer(const CPUProcessorRcPtr & proc, 
+                 py::buffer & data, 
+                 long numChannels, 
+                 unsigned numThreads)
+{
+    py::buffer_info info = data.request();
+    checkBufferDivisible(info, numChannels);
+
+    BitDepth bitDepth = getBufferBitDepth(info);
+
+    long width = 0;
+    long height = 1;
+    ptrdiff_t chanStrideBytes = (ptrdiff_t)info.itemsize;
+    ptrdiff_t xStrideBytes = chanStrideBytes * numChannels;
+    ptrdiff_t yStrideBytes = 0;
+
+    if (isBufferContiguous(info))
+    {
+        // Interpret as single row of pixels
+        width = (long)info.size / numChannels;
+        yStrideBytes = xStrideBytes * width;
+    }
+    else if ((info.ndim == 2 || info.ndim == 3) && info.shape[info.ndim-1] == numChannels)
+    {
+        chanStrideBytes = (ptrdiff_t)info.strides[info.ndim-1];
+        xStrideBytes = (ptrdiff_t)info.strides[info.ndim-2];
+        width = (long)info.shape[info.ndim-2];
+
+        if (info.ndim == 3)
+        {
+            height = (long)info.shape[0];
+            yStrideBytes = (ptrdiff_t)info.strides[0];
+        }
+        else
+        {
+            yStrideBytes = xStrideBytes * width;
+        }
+    }
+    else
+    {
+        std::ostringstream os;
+        os << "Incompatible buffer dimensions: expected a contiguous array, or a strided array ";
+        os << "of shape (W, " << numChannels << ") or (H, W, " << numChannels << "), ";
+        os << "but received a strided array of shape " << getBufferShapeStr(info);
+        throw std::runtime_error(os.str().c_str());
+    }
+
+    if (info.size == 0)
+    {
+        return;
+    }
+
+    py::gil_scoped_release release;
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Split the rows, or the pixels of a single row, in bands.
+    const bool splitRows = height > 1;
+    const long numLines = splitRows ? height : width;
+    const long numBands = std::max(1L, std::min({ numLines, 
+                                                  width * height / MIN_BAND_PIXELS, 
+                                                  (long)numThreads }));
+
+    if (numBands == 1)
+    {
+        PackedImageDesc img(info.ptr, 
+                            width, height, 
+                            numChannels, 
+                            bitDepth, 
+                            chanStrideBytes, 
+                            xStrideBytes, 
+                            yStrideBytes);
+        proc->apply(img);
+        return;
+    }
+
+    std::vector<std::unique_ptr<PackedImageDesc>> bands;
+    std::vector<ImageDesc *> imgs;
+
+    for (long band = 0; band < numBands; band++)
+    {
+        const long begin = numLines * band / numBands;
+        const long end = numLines * (band + 1) / numBands;
+
+        char * bandData = static_cast<char *>(info.ptr) 
+                          + begin * (splitRows ? yStrideBytes : xStrideBytes);
+
+        bands.emplace_back(new PackedImageDesc(bandData, 
+                                               splitRows ? width : end - begin, 
+                                               splitRows ? end - begin : 1, 
+                                               numChannels, 
+                                               bitDepth, 
+                                               chanStrideBytes, 
+                                               xStrideBytes, 
+                                               yStrideBytes));
+        imgs.push_back(bands.back().get());
+    }
+
+    // The bands are processed in parallel, with one thread per band at most.
+    proc->apply(imgs.data(), imgs.size());
+}
+
+// Own the step name as the C++ one is only valid for the lifetime of the CPU processor.
+struct PyCPUOpStatistics
+{
+    std::string m_name;
+    double m_seconds;
+    unsigned long long m_numPixels;
+};
+
+} // namespace
+
 void bindPyCPUProcessor(py::module & m)
 {
+    py::class_<PyCPUOpStatistics>(m, "CPUOpStatistics", DOC(CPUOpStatistics))
+        .def_readonly("name", &PyCPUOpStatistics::m_name)
+        .def_readonly("seconds", &PyCPUOpStatistics::m_seconds)
+        .def_readonly("numPixels", &PyCPUOpStatistics::m_numPixels);
+
     auto clsCPUProcessor = 
         py::class_<CPUProcessor, CPUProcessorRcPtr>(
             m.attr("CPUProcessor"))
@@ -36,6 +171,25 @@ void bindPyCPUProcessor(py::module & m)
             }, 
             "type"_a, 
              DOC(CPUProcessor, getDynamicProperty))
+        .def("getLastEngineType", &CPUProcessor::getLastEngineType, 
+             DOC(CPUProcessor, getLastEngineType))
+        .def("enableStatistics", &CPUProcessor::enableStatistics, "enable"_a,
+             DOC(CPUProcessor, enableStatistics))
+        .def("isStatisticsEnabled", &CPUProcessor::isStatisticsEnabled,
+             DOC(CPUProcessor, isStatisticsEnabled))
+        .def("getStatistics", [](CPUProcessorRcPtr & self)
+            {
+                std::vector<PyCPUOpStatistics> statistics;
+                for (int idx = 0; idx < self->getNumStatistics(); ++idx)
+                {
+                    const CPUOpStatistics stats = self->getStatistics(idx);
+                    statistics.push_back({ stats.m_name, stats.m_seconds, stats.m_numPixels });
+                }
+                return statistics;
+            },
+             DOC(CPUProcessor, getStatistics))
+        .def("resetStatistics", &CPUProcessor::resetStatistics,
+             DOC(CPUProcessor, resetStatistics))
 
         .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc) 
             {
@@ -84,58 +238,87 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     ``ImageDesc`` on the C++ side so avoid the copy.
 
 )doc")
-        .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
+        .def("apply", [](CPUProcessorRcPtr & self, std::vector<PyImageDesc *> & imgDescs) 
+            {
+                std::vector<ImageDesc *> imgs;
+                for (PyImageDesc * imgDesc : imgDescs)
+                {
+                    imgs.push_back(imgDesc ? imgDesc->m_img.get() : nullptr);
+                }
+                self->apply(imgs.data(), imgs.size());
+            },
+             "imgDescs"_a,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Apply to a list of images, in parallel, while respecting the input and
+output bit-depths. Image values are modified in place. This is much 
+faster than applying to each image when the images are small.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         std::vector<PyImageDesc *> & srcImgDescs, 
+                         std::vector<PyImageDesc *> & dstImgDescs)
+            {
+                if (srcImgDescs.size() != dstImgDescs.size())
+                {
+                    throw Exception("The source and destination image lists must have "
+                                    "the same length.");
+                }
+
+                std::vector<const ImageDesc *> srcImgs;
+                std::vector<ImageDesc *> dstImgs;
+                for (size_t idx = 0; idx < srcImgDescs.size(); ++idx)
+                {
+                    srcImgs.push_back(srcImgDescs[idx] ? srcImgDescs[idx]->m_img.get() : nullptr);
+                    dstImgs.push_back(dstImgDescs[idx] ? dstImgDescs[idx]->m_img.get() : nullptr);
+                }
+                self->apply(srcImgs.data(), dstImgs.data(), srcImgs.size());
+            },
+             "srcImgDescs"_a, "dstImgDescs"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Apply to lists of images, in parallel, while respecting the input and
+output bit-depths. Modified srcImgDescs image values are written to the
+dstImgDescs images of the same index, leaving srcImgDescs unchanged.
+
+.. note::
+    The GIL is released during processing, freeing up Python to execute 
+    other threads concurrently.
+
+)doc")
+        .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data, unsigned numThreads) 
             {
-                py::buffer_info info = data.request();
-                checkBufferDivisible(info, 3);
-
-                // Interpret as single row of RGB pixels
-                BitDepth bitDepth = getBufferBitDepth(info);
-
-                py::gil_scoped_release release;
-
-                long numChannels = 3;
-                long width = (long)info.size / numChannels;
-                long height = 1;
-                ptrdiff_t chanStrideBytes = (ptrdiff_t)info.itemsize;
-                ptrdiff_t xStrideBytes = chanStrideBytes * numChannels;
-                ptrdiff_t yStrideBytes = xStrideBytes * width;
-
-                PackedImageDesc img(info.ptr, 
-                                    width, height, 
-                                    numChannels, 
-                                    bitDepth, 
-                                    chanStrideBytes, 
-                                    xStrideBytes, 
-                                    yStrideBytes);
-                self->apply(img);
+                applyBuffer(self, data, 3, numThreads);
             },
-             "data"_a, 
+             "data"_a, "numThreads"_a = 0,
              R"doc(
 Apply to a packed RGB array adhering to the Python buffer protocol. 
-This will typically be a NumPy array. Input and output bit-depths are
-respected but must match. Any array size or shape is supported as long
-as the flattened array size is divisible by 3. Array values are 
-modified in place.
+This will typically be a NumPy array of uint8, uint16, float16 or 
+float32 values. Input and output bit-depths are respected but must 
+match. Any contiguous array size or shape is supported as long as the
+flattened array size is divisible by 3. Strided arrays (e.g. an 
+array slice) must have a (W, 3) or (H, W, 3) shape. Array values 
+are modified in place.
+
+The array is split in bands processed in parallel by up to numThreads
+threads, or by all the available threads when numThreads is 0.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
-    during processing, freeing up Python to execute other threads 
-    concurrently.
+    This method uses ``PackedImageDesc`` instances under the hood, 
+    following the array strides, so the array values are never copied.
+    The GIL is released during processing, freeing up Python to execute
+    other threads concurrently.
 
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, std::vector<float> & data) 
             {
                 checkVectorDivisible(data, 3);
 
-                long numChannels = 3;
-                long width = (long)data.size() / numChannels;
-                long height = 1;
-
-                PackedImageDesc img(&data[0], width, height, numChannels);
-                self->apply(img);
+                self->applyRGB(data.data(), data.size() / 3);
 
                 return data;
             },
@@ -144,14 +327,13 @@ modified in place.
              R"doc(
 Apply to a packed RGB list of float values. Any size is supported as 
 long as the list length is divisible by 3. A new list with processed
-float values is returned, leaving the input list unchanged.
+float values is returned, leaving the input list unchanged. Input and 
+output bit-depths must be 32-bit float.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
-    during processing, freeing up Python to execute other threads 
-    concurrently.
+    The pixels are processed in parallel when there are many of them. 
+    The GIL is released during processing, freeing up Python to execute
+    other threads concurrently.
 
 .. note::
     For large images, a NumPy array should be preferred over a list.
@@ -159,58 +341,35 @@ float values is returned, leaving the input list unchanged.
     modified in place.
 
 )doc")
-        .def("applyRGBA", [](CPUProcessorRcPtr & self, py::buffer & data) 
+        .def("applyRGBA", [](CPUProcessorRcPtr & self, py::buffer & data, unsigned numThreads) 
             {
-                py::buffer_info info = data.request();
-                checkBufferDivisible(info, 4);
-
-                // Interpret as single row of RGBA pixels
-                BitDepth bitDepth = getBufferBitDepth(info);
-
-                py::gil_scoped_release release;
-
-                long numChannels = 4;
-                long width = (long)info.size / numChannels;
-                long height = 1;
-                ptrdiff_t chanStrideBytes = (ptrdiff_t)info.itemsize;
-                ptrdiff_t xStrideBytes = chanStrideBytes * numChannels;
-                ptrdiff_t yStrideBytes = xStrideBytes * width;
-
-                PackedImageDesc img(info.ptr, 
-                                    width, height, 
-                                    numChannels, 
-                                    bitDepth, 
-                                    chanStrideBytes, 
-                                    xStrideBytes, 
-                                    yStrideBytes);
-                self->apply(img);
+                applyBuffer(self, data, 4, numThreads);
             },
-             "data"_a, 
+             "data"_a, "numThreads"_a = 0,
              R"doc(
 Apply to a packed RGBA array adhering to the Python buffer protocol. 
-This will typically be a NumPy array. Input and output bit-depths are
-respected but must match. Any array size or shape is supported as long
-as the flattened array size is divisible by 4. Array values are 
-modified in place.
+This will typically be a NumPy array of uint8, uint16, float16 or 
+float32 values. Input and output bit-depths are respected but must 
+match. Any contiguous array size or shape is supported as long as the
+flattened array size is divisible by 4. Strided arrays (e.g. an 
+array slice) must have a (W, 4) or (H, W, 4) shape. Array values 
+are modified in place.
+
+The array is split in bands processed in parallel by up to numThreads
+threads, or by all the available threads when numThreads is 0.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
-    during processing, freeing up Python to execute other threads 
-    concurrently.
+    This method uses ``PackedImageDesc`` instances under the hood, 
+    following the array strides, so the array values are never copied.
+    The GIL is released during processing, freeing up Python to execute
+    other threads concurrently.
 
 )doc")
         .def("applyRGBA", [](CPUProcessorRcPtr & self, std::vector<float> & data) 
             {
                 checkVectorDivisible(data, 4);
 
-                long numChannels = 4;
-                long width = (long)data.size() / numChannels;
-                long height = 1;
-
-                PackedImageDesc img(&data[0], width, height, numChannels);
-                self->apply(img);
+                self->applyRGBA(data.data(), data.size() / 4);
 
                 return data;
             },
@@ -219,14 +378,13 @@ modified in place.
              R"doc(
 Apply to a packed RGBA list of float values. Any size is supported as 
 long as the list length is divisible by 4. A new list with processed
-float values is returned, leaving the input list unchanged.
+float values is returned, leaving the input list unchanged. Input and 
+output bit-depths must be 32-bit float.
 
 .. note::
-    This differs from the C++ implementation which only applies to a 
-    single pixel. This method uses a ``PackedImageDesc`` under the 
-    hood to apply to an entire image at once. The GIL is released 
-    during processing, freeing up Python to execute other threads 
-    concurrently.
+    The pixels are processed in parallel when there are many of them. 
+    The GIL is released during processing, freeing up Python to execute
+    other threads concurrently.
 
 .. note::
     For large images, a NumPy array should be preferred over a list.
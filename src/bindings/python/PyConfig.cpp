@@ -171,6 +171,8 @@ void bindPyConfig(py::module & m)
             }, 
              "str"_a, 
              DOC(Config, CreateFromStream))
+        .def_static("PrecompileFile", &Config::PrecompileFile, "fileName"_a,
+                    DOC(Config, PrecompileFile))
                     
         .def("getMajorVersion", &Config::getMajorVersion, 
              DOC(Config, getMajorVersion))
@@ -574,6 +576,38 @@ void bindPyConfig(py::module & m)
              &Config::getProcessor, 
              "context"_a, "transform"_a, "direction"_a, 
              DOC(Config, getProcessor, 9))
+        .def("getProcessors", 
+             [](ConfigRcPtr & self,
+                const ConstContextRcPtr & context,
+                const std::vector<ConstTransformRcPtr> & transforms,
+                TransformDirection direction)
+            {
+                std::vector<ConstProcessorRcPtr> processors(transforms.size());
+                self->getProcessors(context, transforms.data(), transforms.size(), direction,
+                                    processors.data());
+                return processors;
+            },
+             "context"_a, "transforms"_a, "direction"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(Config, getProcessors))
+        .def("getProcessors", 
+             [](ConfigRcPtr & self,
+                const ConstContextRcPtr & context,
+                const std::vector<ConstTransformRcPtr> & transforms,
+                TransformDirection direction,
+                BitDepth inBitDepth,
+                BitDepth outBitDepth,
+                OptimizationFlags oFlags)
+            {
+                std::vector<ConstProcessorRcPtr> processors(transforms.size());
+                self->getProcessors(context, transforms.data(), transforms.size(), direction,
+                                    inBitDepth, outBitDepth, oFlags, processors.data());
+                return processors;
+            },
+             "context"_a, "transforms"_a, "direction"_a,
+             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(Config, getProcessors, 2))
 
         .def_static("GetProcessorFromConfigs", [](const ConstConfigRcPtr & srcConfig,
                                                   const char * srcColorSpaceName,
@@ -639,6 +673,18 @@ void bindPyConfig(py::module & m)
 
         .def("setProcessorCacheFlags", &Config::setProcessorCacheFlags, "flags"_a, 
              DOC(Config, setProcessorCacheFlags))
+        .def("getCacheStatistics", [](ConfigRcPtr & self)
+            {
+                std::vector<CacheStatistics> stats;
+                for (int idx = 0; idx < self->getNumCacheStatistics(); ++idx)
+                {
+                    stats.push_back(self->getCacheStatistics(idx));
+                }
+                return stats;
+            },
+             DOC(Config, getCacheStatistics))
+        .def("clearProcessorCache", &Config::clearProcessorCache,
+             DOC(Config, clearProcessorCache))
                 
         .def("__str__", [](ConfigRcPtr & self)
             {
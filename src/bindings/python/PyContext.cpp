@@ -189,7 +189,19 @@ void bindPyContext(py::module & m)
              (const char * (Context::*)(const char *, ContextRcPtr &) const) 
              &Context::resolveFileLocation, 
              "filename"_a, "usedContextVars"_a, 
-             DOC(Context, resolveFileLocation, 2));
+             DOC(Context, resolveFileLocation, 2))
+        .def("getCacheStatistics", [](ContextRcPtr & self)
+            {
+                std::vector<CacheStatistics> stats;
+                for (int idx = 0; idx < self->getNumCacheStatistics(); ++idx)
+                {
+                    stats.push_back(self->getCacheStatistics(idx));
+                }
+                return stats;
+            },
+             DOC(Context, getCacheStatistics))
+        .def("clearCaches", &Context::clearCaches,
+             DOC(Context, clearCaches));
 
     defRepr(clsContext);
 
@@ -40,6 +40,23 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+
+    py::class_<CacheStatistics>(m, "CacheStatistics", DOC(CacheStatistics))
+        .def_readonly("name", &CacheStatistics::m_name)
+        .def_readonly("numEntries", &CacheStatistics::m_numEntries)
+        .def_readonly("approximateBytes", &CacheStatistics::m_approximateBytes)
+        .def_readonly("numHits", &CacheStatistics::m_numHits)
+        .def_readonly("numMisses", &CacheStatistics::m_numMisses)
+        .def_readonly("missTime", &CacheStatistics::m_missTime);
+
+    m.def("GetCacheStatistics", &GetCacheStatistics, "type"_a,
+          DOC(PyOpenColorIO, GetCacheStatistics));
+    m.def("ClearCache", &ClearCache, "type"_a,
+          DOC(PyOpenColorIO, ClearCache));
+    m.def("SetNumThreads", &SetNumThreads, "numThreads"_a,
+          DOC(PyOpenColorIO, SetNumThreads));
+    m.def("GetNumThreads", &GetNumThreads,
+          DOC(PyOpenColorIO, GetNumThreads));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
@@ -58,6 +75,26 @@ PYBIND11_MODULE(PyOpenColorIO, m)
           DOC(PyOpenColorIO, SetComputeHashFunction));
     m.def("ResetComputeHashFunction", &ResetComputeHashFunction,
           DOC(PyOpenColorIO, ResetComputeHashFunction));
+
+    py::class_<ProcessorProfile>(m, "ProcessorProfile", DOC(ProcessorProfile))
+        .def_readonly("type", &ProcessorProfile::m_type)
+        .def_readonly("totalTime", &ProcessorProfile::m_totalTime)
+        .def_readonly("buildOpsTime", &ProcessorProfile::m_buildOpsTime)
+        .def_readonly("finalizeTime", &ProcessorProfile::m_finalizeTime)
+        .def_readonly("optimizeTime", &ProcessorProfile::m_optimizeTime)
+        .def_readonly("optimizeForBitDepthTime", &ProcessorProfile::m_optimizeForBitDepthTime)
+        .def_readonly("rendererTime", &ProcessorProfile::m_rendererTime)
+        .def_readonly("fileLoadingTime", &ProcessorProfile::m_fileLoadingTime)
+        .def_readonly("lutCompositionTime", &ProcessorProfile::m_lutCompositionTime)
+        .def_readonly("inverseLutTime", &ProcessorProfile::m_inverseLutTime)
+        .def_readonly("numFilesLoaded", &ProcessorProfile::m_numFilesLoaded)
+        .def_readonly("numFilesCached", &ProcessorProfile::m_numFilesCached)
+        .def_readonly("numOptimizationPasses", &ProcessorProfile::m_numOptimizationPasses)
+        .def_readonly("numOpsCombined", &ProcessorProfile::m_numOpsCombined);
+
+    m.def("SetProcessorProfilingFunction", &SetProcessorProfilingFunction,
+          "profilingFunction"_a,
+          DOC(PyOpenColorIO, SetProcessorProfilingFunction));
     m.def("GetEnvVariable", &GetEnvVariable, "name"_a,
           DOC(PyOpenColorIO, GetEnvVariable));
     m.def("SetEnvVariable", &SetEnvVariable, "name"_a, "value"_a,
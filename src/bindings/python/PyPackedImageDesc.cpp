@@ -110,6 +110,41 @@ void bindPyPackedImageDesc(py::module & m)
              "data"_a, "width"_a, "height"_a, "chanOrder"_a, "bitDepth"_a, "chanStrideBytes"_a, 
              "xStrideBytes"_a, "yStrideBytes"_a,
              DOC(PackedImageDesc, PackedImageDesc, 4))
+        .def(py::init([](py::buffer & data,
+                         long width, long height,
+                         ChannelOrdering chanOrder,
+                         ChannelPacking chanPacking,
+                         ptrdiff_t yStrideBytes) 
+            { 
+                PyPackedImageDesc * p = new PyPackedImageDesc();
+
+                py::gil_scoped_release release;
+                p->m_data[0] = data;
+                py::gil_scoped_acquire acquire;
+
+                py::buffer_info info = p->m_data[0].request();
+
+                p->m_img = std::make_shared<PackedImageDesc>(info.ptr, 
+                                                             width, height, 
+                                                             chanOrder, 
+                                                             chanPacking, 
+                                                             yStrideBytes);
+
+                // The words could be of any type so only the size in bytes is checked.
+                const ssize_t numBytes = p->m_img->getYStrideBytes() * height;
+                if (info.size * info.itemsize < numBytes)
+                {
+                    std::ostringstream os;
+                    os << "Incompatible buffer dimensions: expected at least " << numBytes;
+                    os << " bytes, but received " << info.size * info.itemsize << " bytes";
+                    throw std::runtime_error(os.str().c_str());
+                }
+
+                return p;
+            }),
+             "data"_a, "width"_a, "height"_a, "chanOrder"_a, "chanPacking"_a, 
+             "yStrideBytes"_a = AutoStride,
+             DOC(PackedImageDesc, PackedImageDesc, 5))
         
         .def("getData", [](const PyPackedImageDesc & self) 
             {
@@ -125,6 +160,11 @@ void bindPyPackedImageDesc(py::module & m)
                 return self.getImg()->getChannelOrder();
             },
              DOC(PackedImageDesc, getChannelOrder))
+        .def("getChannelPacking", [](const PyPackedImageDesc & self) 
+            {
+                return self.getImg()->getChannelPacking();
+            },
+             DOC(PackedImageDesc, getChannelPacking))
         .def("getNumChannels", [](const PyPackedImageDesc & self) 
             {
                 return self.getImg()->getNumChannels();
@@ -18,6 +18,24 @@ enum ProcessorIterator
 
 using TransformFormatMetadataIterator = PyIterator<ProcessorRcPtr, IT_TRANSFORM_FORMAT_METADATA>;
 
+template<typename Handle>
+void bindPyAsyncProcessor(py::module & m, const char * name, const char * doc)
+{
+    py::class_<Handle, OCIO_SHARED_PTR<Handle>>(m, name, doc)
+        .def("isReady", &Handle::isReady,
+             DOC(AsyncProcessor, isReady))
+        .def("wait", &Handle::wait,
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(AsyncProcessor, wait))
+        .def("get", &Handle::get,
+             py::call_guard<py::gil_scoped_release>(),
+             DOC(AsyncProcessor, get))
+        .def("cancel", &Handle::cancel,
+             DOC(AsyncProcessor, cancel))
+        .def("isCancelled", &Handle::isCancelled,
+             DOC(AsyncProcessor, isCancelled));
+}
+
 } // namespace
 
 void bindPyProcessor(py::module & m)
@@ -89,7 +107,19 @@ void bindPyProcessor(py::module & m)
              (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags) const) 
              &Processor::getOptimizedCPUProcessor, 
              "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
-             DOC(Processor, getOptimizedCPUProcessor));
+             DOC(Processor, getOptimizedCPUProcessor))
+        .def("getCacheStatistics", [](ProcessorRcPtr & self)
+            {
+                std::vector<CacheStatistics> stats;
+                for (int idx = 0; idx < self->getNumCacheStatistics(); ++idx)
+                {
+                    stats.push_back(self->getCacheStatistics(idx));
+                }
+                return stats;
+            },
+             DOC(Processor, getCacheStatistics))
+        .def("clearCaches", &Processor::clearCaches,
+             DOC(Processor, clearCaches));
 
     clsTransformFormatMetadataIterator
         .def("__len__", [](TransformFormatMetadataIterator & it) 
@@ -114,6 +144,20 @@ void bindPyProcessor(py::module & m)
                 return it.m_obj->getTransformFormatMetadata(i);
             }, 
              py::return_value_policy::reference_internal);
+
+    bindPyAsyncProcessor<AsyncProcessor>(m, "AsyncProcessor", DOC(AsyncProcessor));
+    bindPyAsyncProcessor<AsyncCPUProcessor>(m, "AsyncCPUProcessor", DOC(AsyncCPUProcessor));
+    bindPyAsyncProcessor<AsyncGPUProcessor>(m, "AsyncGPUProcessor", DOC(AsyncGPUProcessor));
+
+    m.def("GetProcessorAsync", &GetProcessorAsync,
+          "config"_a, "context"_a, "transform"_a, "direction"_a,
+          DOC(PyOpenColorIO, GetProcessorAsync));
+    m.def("GetOptimizedCPUProcessorAsync", &GetOptimizedCPUProcessorAsync,
+          "processor"_a, "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
+          DOC(PyOpenColorIO, GetOptimizedCPUProcessorAsync));
+    m.def("GetOptimizedGPUProcessorAsync", &GetOptimizedGPUProcessorAsync,
+          "processor"_a, "oFlags"_a,
+          DOC(PyOpenColorIO, GetOptimizedGPUProcessorAsync));
 }
 
 } // namespace OCIO_NAMESPACE
@@ -490,6 +490,22 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, ChannelOrdering, CHANNEL_ORDERING_BGR))
         .export_values();
 
+    py::enum_<ChannelPacking>(
+        m, "ChannelPacking", 
+        DOC(PyOpenColorIO, ChannelPacking))
+
+        .value("CHANNEL_PACKING_NONE", CHANNEL_PACKING_NONE, 
+               DOC(PyOpenColorIO, ChannelPacking, CHANNEL_PACKING_NONE))
+        .value("CHANNEL_PACKING_10BIT_FILLED_A", CHANNEL_PACKING_10BIT_FILLED_A, 
+               DOC(PyOpenColorIO, ChannelPacking, CHANNEL_PACKING_10BIT_FILLED_A))
+        .value("CHANNEL_PACKING_10BIT_FILLED_B", CHANNEL_PACKING_10BIT_FILLED_B, 
+               DOC(PyOpenColorIO, ChannelPacking, CHANNEL_PACKING_10BIT_FILLED_B))
+        .value("CHANNEL_PACKING_12BIT_FILLED_A", CHANNEL_PACKING_12BIT_FILLED_A, 
+               DOC(PyOpenColorIO, ChannelPacking, CHANNEL_PACKING_12BIT_FILLED_A))
+        .value("CHANNEL_PACKING_12BIT_PACKED", CHANNEL_PACKING_12BIT_PACKED, 
+               DOC(PyOpenColorIO, ChannelPacking, CHANNEL_PACKING_12BIT_PACKED))
+        .export_values();
+
     py::enum_<Allocation>(
         m, "Allocation", 
         DOC(PyOpenColorIO, Allocation))
@@ -724,6 +740,11 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SIMPLIFY_OPS))
         .value("OPTIMIZATION_NO_DYNAMIC_PROPERTIES", OPTIMIZATION_NO_DYNAMIC_PROPERTIES, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_NO_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES", 
+               OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES))
+        .value("OPTIMIZATION_INTEGER_DOMAIN", OPTIMIZATION_INTEGER_DOMAIN, 
+               DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_INTEGER_DOMAIN))
         .value("OPTIMIZATION_ALL", OPTIMIZATION_ALL, 
                DOC(PyOpenColorIO, OptimizationFlags, OPTIMIZATION_ALL))
         .value("OPTIMIZATION_LOSSLESS", OPTIMIZATION_LOSSLESS, 
@@ -752,6 +773,28 @@ void bindPyTypes(py::module & m)
                DOC(PyOpenColorIO, ProcessorCacheFlags, PROCESSOR_CACHE_DEFAULT))
         .export_values();
 
+    py::enum_<GlobalCacheType>(
+        m, "GlobalCacheType", 
+        DOC(PyOpenColorIO, GlobalCacheType))
+
+        .value("GLOBAL_CACHE_FILE_HASH", GLOBAL_CACHE_FILE_HASH, 
+               DOC(PyOpenColorIO, GlobalCacheType, GLOBAL_CACHE_FILE_HASH))
+        .value("GLOBAL_CACHE_FILE", GLOBAL_CACHE_FILE, 
+               DOC(PyOpenColorIO, GlobalCacheType, GLOBAL_CACHE_FILE))
+        .value("GLOBAL_CACHE_OP_COMPOSITION", GLOBAL_CACHE_OP_COMPOSITION, 
+               DOC(PyOpenColorIO, GlobalCacheType, GLOBAL_CACHE_OP_COMPOSITION))
+        .export_values();
+
+    py::enum_<CPUEngineType>(
+        m, "CPUEngineType", 
+        DOC(PyOpenColorIO, CPUEngineType))
+
+        .value("CPU_ENGINE_GENERIC", CPU_ENGINE_GENERIC, 
+               DOC(PyOpenColorIO, CPUEngineType, CPU_ENGINE_GENERIC))
+        .value("CPU_ENGINE_SPECIALIZED", CPU_ENGINE_SPECIALIZED, 
+               DOC(PyOpenColorIO, CPUEngineType, CPU_ENGINE_SPECIALIZED))
+        .export_values();
+
     // Conversion
     m.def("BoolToString", &BoolToString, "value"_a, 
           DOC(PyOpenColorIO, BoolToString));
@@ -839,6 +882,7 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
+    m.attr("OCIO_LAZY_LOADING_ENVVAR") = OCIO_LAZY_LOADING_ENVVAR;
 
     // Roles
     m.attr("ROLE_DEFAULT") = ROLE_DEFAULT;
@@ -869,6 +913,7 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_DISABLE_ALL_CACHES") = OCIO_DISABLE_ALL_CACHES;
     m.attr("OCIO_DISABLE_PROCESSOR_CACHES") = OCIO_DISABLE_PROCESSOR_CACHES;
     m.attr("OCIO_DISABLE_CACHE_FALLBACK") = OCIO_DISABLE_CACHE_FALLBACK;
+    m.attr("OCIO_FILE_CACHE_DIR") = OCIO_FILE_CACHE_DIR;
 }
 
 } // namespace OCIO_NAMESPACE
@@ -67,6 +67,9 @@ py::dtype bitDepthToDtype(BitDepth bitDepth)
         case BIT_DEPTH_UINT16:
             name = "uint16";
             break;
+        case BIT_DEPTH_UINT32:
+            name = "uint32";
+            break;
         case BIT_DEPTH_F16:
             name = "float16";
             break;
@@ -74,7 +77,6 @@ py::dtype bitDepthToDtype(BitDepth bitDepth)
             name = "float32";
             break;
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_UNKNOWN:
         default:
             err = "Error: Unsupported bit-depth: ";
@@ -98,10 +100,10 @@ ssize_t bitDepthToBytes(BitDepth bitDepth)
         case BIT_DEPTH_UINT16:
         case BIT_DEPTH_F16:
             return 2;
+        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_F32:
             return 4;
         case BIT_DEPTH_UINT14:
-        case BIT_DEPTH_UINT32:
         case BIT_DEPTH_UNKNOWN:
         default:
             err = "Error: Unsupported bit-depth: ";
@@ -150,6 +152,8 @@ BitDepth getBufferBitDepth(const py::buffer_info & info)
         bitDepth = BIT_DEPTH_F16;
     else if (dtName == "uint16" || dtName == "uint12" || dtName == "uint10")
         bitDepth = BIT_DEPTH_UINT16;
+    else if (dtName == "uint32")
+        bitDepth = BIT_DEPTH_UINT32;
     else if (dtName == "uint8")
         bitDepth = BIT_DEPTH_UINT8;
     else 
@@ -162,6 +166,21 @@ BitDepth getBufferBitDepth(const py::buffer_info & info)
     return bitDepth;
 }
 
+bool isBufferContiguous(const py::buffer_info & info)
+{
+    ssize_t strideBytes = info.itemsize;
+    for (ssize_t i = info.ndim - 1; i >= 0; i--)
+    {
+        // The stride of a dimension of size 1 is irrelevant.
+        if (info.shape[i] != 1 && info.strides[i] != strideBytes)
+        {
+            return false;
+        }
+        strideBytes *= info.shape[i];
+    }
+    return true;
+}
+
 void checkBufferType(const py::buffer_info & info, const py::dtype & dt)
 {
     if (!py::dtype(info).is(dt))
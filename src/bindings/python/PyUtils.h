@@ -73,6 +73,8 @@ long chanOrderToNumChannels(ChannelOrdering chanOrder);
 std::string getBufferShapeStr(const py::buffer_info & info);
 // Return BitDepth for a supported Python buffer data type
 BitDepth getBufferBitDepth(const py::buffer_info & info);
+// Return true if Python buffer values are packed in C order (i.e. not strided)
+bool isBufferContiguous(const py::buffer_info & info);
 
 // Throw if Python buffer format is incompatible with a NumPy dtype
 void checkBufferType(const py::buffer_info & info, const py::dtype & dt);
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "AsyncProcessor.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Queue the tasks so the test decides when they run.
+struct DeferredTasks
+{
+    DeferredTasks()
+    {
+        OCIO::SetAsyncTaskFunction([this](std::function<void()> task)
+        {
+            m_tasks.push_back(task);
+        });
+    }
+
+    ~DeferredTasks()
+    {
+        OCIO::SetAsyncTaskFunction(nullptr);
+    }
+
+    void run()
+    {
+        for (auto & task : m_tasks)
+        {
+            task();
+        }
+        m_tasks.clear();
+    }
+
+    std::vector<std::function<void()>> m_tasks;
+};
+
+OCIO::ConstTransformRcPtr CreateMatrix()
+{
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4] = { 0.1, 0.2, 0.3, 0. };
+    matrix->setOffset(offset);
+    return matrix;
+}
+
+} // anon.
+
+
+OCIO_ADD_TEST(AsyncProcessor, get_processor)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    auto asyncProc = OCIO::GetProcessorAsync(config, config->getCurrentContext(), CreateMatrix(),
+                                             OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_REQUIRE_ASSERT(asyncProc);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = asyncProc->get());
+    OCIO_REQUIRE_ASSERT(proc);
+    OCIO_CHECK_ASSERT(asyncProc->isReady());
+    OCIO_CHECK_ASSERT(!asyncProc->isCancelled());
+
+    auto asyncCPU = OCIO::GetOptimizedCPUProcessorAsync(proc, OCIO::BIT_DEPTH_F32,
+                                                        OCIO::BIT_DEPTH_F32,
+                                                        OCIO::OPTIMIZATION_DEFAULT);
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = asyncCPU->get());
+    OCIO_REQUIRE_ASSERT(cpu);
+
+    float pixel[3] = { 0.5f, 0.5f, 0.5f };
+    cpu->applyRGB(pixel);
+    OCIO_CHECK_CLOSE(pixel[0], 0.6f, 1e-6f);
+    OCIO_CHECK_CLOSE(pixel[1], 0.7f, 1e-6f);
+    OCIO_CHECK_CLOSE(pixel[2], 0.8f, 1e-6f);
+
+    auto asyncGPU = OCIO::GetOptimizedGPUProcessorAsync(proc, OCIO::OPTIMIZATION_DEFAULT);
+    OCIO::ConstGPUProcessorRcPtr gpu;
+    OCIO_CHECK_NO_THROW(gpu = asyncGPU->get());
+    OCIO_CHECK_ASSERT(gpu);
+
+    // The creation errors are thrown by get().
+    OCIO::ColorSpaceTransformRcPtr cst = OCIO::ColorSpaceTransform::Create();
+    cst->setSrc("unknown");
+    cst->setDst("raw");
+    auto asyncFailure = OCIO::GetProcessorAsync(config, config->getCurrentContext(), cst,
+                                                OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_THROW_WHAT(asyncFailure->get(), OCIO::Exception, "unknown");
+
+    OCIO_CHECK_THROW_WHAT(OCIO::GetProcessorAsync(config, config->getCurrentContext(), nullptr,
+                                                  OCIO::TRANSFORM_DIR_FORWARD),
+                          OCIO::Exception, "must not be null");
+    OCIO_CHECK_THROW_WHAT(OCIO::GetOptimizedGPUProcessorAsync(nullptr, OCIO::OPTIMIZATION_DEFAULT),
+                          OCIO::Exception, "The processor is null");
+}
+
+OCIO_ADD_TEST(AsyncProcessor, cancel)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    DeferredTasks tasks;
+
+    auto asyncProc1 = OCIO::GetProcessorAsync(config, config->getCurrentContext(), CreateMatrix(),
+                                              OCIO::TRANSFORM_DIR_FORWARD);
+    auto asyncProc2 = OCIO::GetProcessorAsync(config, config->getCurrentContext(), CreateMatrix(),
+                                              OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_REQUIRE_EQUAL(tasks.m_tasks.size(), size_t(2));
+    OCIO_CHECK_ASSERT(!asyncProc1->isReady());
+
+    // The copies share the creation.
+    OCIO::AsyncProcessorRcPtr copy = asyncProc1;
+    copy->cancel();
+    OCIO_CHECK_ASSERT(asyncProc1->isCancelled());
+    OCIO_CHECK_ASSERT(!asyncProc2->isCancelled());
+
+    tasks.run();
+
+    OCIO_CHECK_ASSERT(asyncProc1->isReady());
+    OCIO_CHECK_THROW_WHAT(asyncProc1->get(), OCIO::Exception, "creation was cancelled");
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = asyncProc2->get());
+    OCIO_CHECK_ASSERT(proc);
+}
+
+OCIO_ADD_TEST(AsyncProcessor, cancel_running)
+{
+    // Mimic a cancellation once the creation is running.
+    std::atomic<bool> cancelled{ true };
+    OCIO::CancellationScope scope(&cancelled);
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO_CHECK_THROW_WHAT(config->getProcessor(CreateMatrix()),
+                          OCIO::Exception, "creation was cancelled");
+
+    // Outside of an asynchronous creation, nothing is cancelled.
+    OCIO::CancellationScope noScope(nullptr);
+    OCIO_CHECK_NO_THROW(config->getProcessor(CreateMatrix()));
+}
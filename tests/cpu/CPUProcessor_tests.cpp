@@ -2,6 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <chrono>
+#include <thread>
+
 #include "CPUProcessor.cpp"
 
 #include "ops/lut1d/Lut1DOp.h"
@@ -12,6 +15,20 @@
 
 namespace OCIO = OCIO_NAMESPACE;
 
+namespace
+{
+
+std::vector<OCIO::CPUOpStatistics> GetStatistics(const OCIO::CPUProcessor & cpu)
+{
+    std::vector<OCIO::CPUOpStatistics> statistics;
+    for (int idx = 0; idx < cpu.getNumStatistics(); ++idx)
+    {
+        statistics.push_back(cpu.getStatistics(idx));
+    }
+    return statistics;
+}
+
+} // anon.
 
 OCIO_ADD_TEST(CPUProcessor, flag_composition)
 {
@@ -2645,6 +2662,1242 @@ OCIO_ADD_TEST(CPUProcessor, scanline_planar_custom)
     }
 }
 
+namespace
+{
+
+template<OCIO::BitDepth bd>
+void ValidatePackedLayouts(const OCIO::ConstProcessorRcPtr & proc)
+{
+    typedef typename OCIO::BitDepthInfo<bd>::Type Type;
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(bd, bd, OCIO::OPTIMIZATION_DEFAULT);
+
+    // Not a multiple of 4 pixels.
+    constexpr long width = 37;
+
+    std::vector<Type> rgba(4 * width);
+    for (size_t idx = 0; idx < rgba.size(); ++idx)
+    {
+        rgba[idx] = Type(float(idx % 97) / 96.0f * float(OCIO::BitDepthInfo<bd>::maxValue));
+    }
+
+    struct Layout
+    {
+        OCIO::ChannelOrdering m_order;
+        long m_numChannels;
+        int m_r, m_g, m_b, m_a;
+    };
+
+    const Layout layouts[] = { { OCIO::CHANNEL_ORDERING_RGB,  3, 0, 1, 2, -1 },
+                               { OCIO::CHANNEL_ORDERING_BGR,  3, 2, 1, 0, -1 },
+                               { OCIO::CHANNEL_ORDERING_BGRA, 4, 2, 1, 0,  3 },
+                               { OCIO::CHANNEL_ORDERING_ABGR, 4, 3, 2, 1,  0 } };
+
+    for (const auto & layout : layouts)
+    {
+        const long n = layout.m_numChannels;
+
+        // The reference is the RGBA processing. The alpha of the RGB layouts is 0.
+        std::vector<Type> refImg(rgba);
+        std::vector<Type> inImg(n * width);
+        for (long px = 0; px < width; ++px)
+        {
+            if (n == 3)
+            {
+                refImg[4 * px + 3] = Type(0.0f);
+            }
+            inImg[n * px + layout.m_r] = refImg[4 * px + 0];
+            inImg[n * px + layout.m_g] = refImg[4 * px + 1];
+            inImg[n * px + layout.m_b] = refImg[4 * px + 2];
+            if (n == 4)
+            {
+                inImg[n * px + layout.m_a] = refImg[4 * px + 3];
+            }
+        }
+
+        OCIO::PackedImageDesc refDesc(refImg.data(), width, 1, OCIO::CHANNEL_ORDERING_RGBA, bd,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpu->apply(refDesc));
+
+        std::vector<Type> outImg(inImg.size());
+        OCIO::PackedImageDesc inDesc(inImg.data(), width, 1, layout.m_order, bd,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc outDesc(outImg.data(), width, 1, layout.m_order, bd,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+
+        // In place processing.
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc));
+
+        for (long px = 0; px < width; ++px)
+        {
+            for (const auto & img : { outImg, inImg })
+            {
+                OCIO_CHECK_EQUAL(float(img[n * px + layout.m_r]), float(refImg[4 * px + 0]));
+                OCIO_CHECK_EQUAL(float(img[n * px + layout.m_g]), float(refImg[4 * px + 1]));
+                OCIO_CHECK_EQUAL(float(img[n * px + layout.m_b]), float(refImg[4 * px + 2]));
+                if (n == 4)
+                {
+                    OCIO_CHECK_EQUAL(float(img[n * px + layout.m_a]), float(refImg[4 * px + 3]));
+                }
+            }
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, packed_layouts)
+{
+    // The packed layouts other than RGBA use dedicated kernels which must produce the same
+    // results as the RGBA processing.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    // The bit-depth conversions are merged with the packing.
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.6, 0.1,
+                             0.0, 0.0, 0.0, 0.9 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.05 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(matrix);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_UINT8>(proc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_UINT10>(proc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_UINT16>(proc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_F16>(proc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_F32>(proc);
+
+    // The bit-depth conversions are done by the 1D LUT.
+    OCIO::ConstProcessorRcPtr lutProc;
+    OCIO_CHECK_NO_THROW(lutProc = OCIO::GetFileTransformProcessor("lut1d_1.spi1d"));
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_UINT8>(lutProc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_UINT16>(lutProc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_F16>(lutProc);
+    ValidatePackedLayouts<OCIO::BIT_DEPTH_F32>(lutProc);
+}
+
+namespace
+{
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateRGBProcessing(const OCIO::ConstProcessorRcPtr & proc, bool statistics)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(inBD, outBD, OCIO::OPTIMIZATION_DEFAULT);
+    cpu->enableStatistics(statistics);
+    cpu->resetStatistics();
+
+    constexpr long width = 37;
+    constexpr long height = 3;
+
+    // The reference is the RGBA processing with a zero alpha.
+    std::vector<InType> rgbaIn(4 * width * height);
+    std::vector<InType> rgbIn(3 * width * height);
+    for (long px = 0; px < width * height; ++px)
+    {
+        for (long c = 0; c < 3; ++c)
+        {
+            // Also test values outside of [0, 1] for the float bit-depths.
+            const float v = float((px * 3 + c) % 101) / 90.0f - 0.05f;
+            const float maxValue = float(OCIO::BitDepthInfo<inBD>::maxValue);
+            const InType value
+                = OCIO::BitDepthInfo<inBD>::isFloat ? InType(v)
+                                                    : InType(OCIO::Clamp(v, 0.0f, 1.0f) * maxValue);
+            rgbaIn[4 * px + c] = value;
+            rgbIn[3 * px + c]  = value;
+        }
+        rgbaIn[4 * px + 3] = InType(0.0f);
+    }
+
+    std::vector<OutType> rgbaOut(rgbaIn.size());
+    OCIO::PackedImageDesc rgbaInDesc(rgbaIn.data(), width, height, 4, inBD,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc rgbaOutDesc(rgbaOut.data(), width, height, 4, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(rgbaInDesc, rgbaOutDesc));
+
+    std::vector<OutType> rgbOut(rgbIn.size());
+    OCIO::PackedImageDesc rgbInDesc(rgbIn.data(), width, height, 3, inBD,
+                                    OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc rgbOutDesc(rgbOut.data(), width, height, 3, outBD,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(rgbInDesc, rgbOutDesc));
+
+    for (long px = 0; px < width * height; ++px)
+    {
+        for (long c = 0; c < 3; ++c)
+        {
+            OCIO_CHECK_EQUAL(float(rgbOut[3 * px + c]), float(rgbaOut[4 * px + c]));
+        }
+    }
+
+    if (inBD == outBD)
+    {
+        // In place processing.
+        OCIO_CHECK_NO_THROW(cpu->apply(rgbInDesc));
+
+        for (long px = 0; px < width * height; ++px)
+        {
+            for (long c = 0; c < 3; ++c)
+            {
+                OCIO_CHECK_EQUAL(float(rgbIn[3 * px + c]), float(rgbaOut[4 * px + c]));
+            }
+        }
+    }
+
+    if (statistics)
+    {
+        const long numImages = inBD == outBD ? 3 : 2;
+        for (const auto & step : GetStatistics(*cpu))
+        {
+            OCIO_CHECK_EQUAL(step.m_numPixels, (unsigned long long)(numImages * width * height));
+        }
+        cpu->enableStatistics(false);
+    }
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidateRGBProcessing(const OCIO::ConstProcessorRcPtr & proc)
+{
+    ValidateRGBProcessing<inBD, outBD>(proc, false);
+    ValidateRGBProcessing<inBD, outBD>(proc, true);
+}
+
+void ValidateRGBProcessing(const OCIO::ConstProcessorRcPtr & proc)
+{
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_F16>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT8>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT10>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16>(proc);
+    ValidateRGBProcessing<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_UINT16>(proc);
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidatePlanarProcessing(const OCIO::ConstProcessorRcPtr & proc, bool hasAlpha)
+{
+    typedef typename OCIO::BitDepthInfo<inBD>::Type InType;
+    typedef typename OCIO::BitDepthInfo<outBD>::Type OutType;
+
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(inBD, outBD, OCIO::OPTIMIZATION_DEFAULT);
+
+    // Not a multiple of 4 pixels to also test the remaining pixels.
+    constexpr long width = 37;
+    constexpr long height = 3;
+    constexpr long numPixels = width * height;
+
+    // The reference is the RGBA processing (with a zero alpha if the planar image has none).
+    std::vector<InType> rgbaIn(4 * numPixels);
+    std::vector<InType> planarIn(4 * numPixels);
+    for (long px = 0; px < numPixels; ++px)
+    {
+        for (long c = 0; c < 4; ++c)
+        {
+            // Also test values outside of [0, 1] for the float bit-depths.
+            const float v = (c == 3 && !hasAlpha) ? 0.0f
+                                                  : float((px * 4 + c) % 101) / 90.0f - 0.05f;
+            const float maxValue = float(OCIO::BitDepthInfo<inBD>::maxValue);
+            const InType value
+                = OCIO::BitDepthInfo<inBD>::isFloat ? InType(v)
+                                                    : InType(OCIO::Clamp(v, 0.0f, 1.0f) * maxValue);
+            rgbaIn[4 * px + c]           = value;
+            planarIn[c * numPixels + px] = value;
+        }
+    }
+
+    std::vector<OutType> rgbaOut(rgbaIn.size());
+    OCIO::PackedImageDesc rgbaInDesc(rgbaIn.data(), width, height, 4, inBD,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc rgbaOutDesc(rgbaOut.data(), width, height, 4, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(rgbaInDesc, rgbaOutDesc));
+
+    const long numChannels = hasAlpha ? 4 : 3;
+
+    std::vector<OutType> planarOut(planarIn.size());
+    OCIO::PlanarImageDesc planarInDesc(&planarIn[0], &planarIn[numPixels],
+                                       &planarIn[2 * numPixels],
+                                       hasAlpha ? &planarIn[3 * numPixels] : nullptr,
+                                       width, height, inBD,
+                                       OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PlanarImageDesc planarOutDesc(&planarOut[0], &planarOut[numPixels],
+                                        &planarOut[2 * numPixels],
+                                        hasAlpha ? &planarOut[3 * numPixels] : nullptr,
+                                        width, height, outBD,
+                                        OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpu->apply(planarInDesc, planarOutDesc));
+
+    for (long px = 0; px < numPixels; ++px)
+    {
+        for (long c = 0; c < numChannels; ++c)
+        {
+            OCIO_CHECK_EQUAL(float(planarOut[c * numPixels + px]), float(rgbaOut[4 * px + c]));
+        }
+    }
+
+    if (inBD == outBD)
+    {
+        // In place processing.
+        OCIO_CHECK_NO_THROW(cpu->apply(planarInDesc));
+
+        for (long px = 0; px < numPixels; ++px)
+        {
+            for (long c = 0; c < numChannels; ++c)
+            {
+                OCIO_CHECK_EQUAL(float(planarIn[c * numPixels + px]),
+                                 float(rgbaOut[4 * px + c]));
+            }
+        }
+    }
+}
+
+template<OCIO::BitDepth inBD, OCIO::BitDepth outBD>
+void ValidatePlanarProcessing(const OCIO::ConstProcessorRcPtr & proc)
+{
+    ValidatePlanarProcessing<inBD, outBD>(proc, true);
+    ValidatePlanarProcessing<inBD, outBD>(proc, false);
+}
+
+void ValidatePlanarProcessing(const OCIO::ConstProcessorRcPtr & proc)
+{
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_F16>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_UINT8>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT10>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F16>(proc);
+    ValidatePlanarProcessing<OCIO::BIT_DEPTH_F16, OCIO::BIT_DEPTH_UINT16>(proc);
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, rgb_processing)
+{
+    // The packed RGB images are processed without any alpha when all the CPU ops support it.
+    // The results must be the ones of the RGBA processing with a zero alpha.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.1);
+    range->setMaxInValue(0.9);
+    range->setMinOutValue(0.);
+    range->setMaxOutValue(1.);
+
+    // The blue channel depends on the alpha channel.
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.6, 0.1,
+                             0.0, 0.0, 0.0, 0.9 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.05 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    for (const auto interp : { OCIO::INTERP_TETRAHEDRAL, OCIO::INTERP_LINEAR })
+    {
+        OCIO::FileTransformRcPtr lut = OCIO::CreateFileTransform("lut3d_1.spi3d");
+        lut->setInterpolation(interp);
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(range);
+        group->appendTransform(lut);
+        group->appendTransform(matrix);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+        ValidateRGBProcessing(proc);
+    }
+
+    // A scale only matrix and a clamping range.
+    {
+        OCIO::MatrixTransformRcPtr scale = OCIO::MatrixTransform::Create();
+        const double s44[16] = { 1.5, 0.0, 0.0, 0.0,
+                                 0.0, 0.5, 0.0, 0.0,
+                                 0.0, 0.0, 0.9, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+        scale->setMatrix(s44);
+
+        OCIO::RangeTransformRcPtr clamp = OCIO::RangeTransform::Create();
+        clamp->setMinInValue(0.);
+        clamp->setMinOutValue(0.);
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(scale);
+        group->appendTransform(clamp);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+        ValidateRGBProcessing(proc);
+    }
+
+    // The log op does not support the RGB processing so the RGBA processing is used.
+    {
+        OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(log);
+        group->appendTransform(range);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+        ValidateRGBProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(proc);
+        ValidateRGBProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F16>(proc);
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, planar_processing)
+{
+    // The planar images are processed without interleaving the channels when all the CPU ops
+    // support it. The results must be the ones of the RGBA processing.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.1);
+    range->setMaxInValue(0.9);
+    range->setMinOutValue(0.);
+    range->setMaxOutValue(1.);
+
+    // The blue channel depends on the alpha channel.
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.6, 0.1,
+                             0.0, 0.0, 0.0, 0.9 };
+    const double offset[4] = { 0.01, -0.02, 0.03, 0.05 };
+    matrix->setMatrix(m44);
+    matrix->setOffset(offset);
+
+    OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+
+    OCIO::CDLTransformRcPtr cdl = OCIO::CDLTransform::Create();
+    const double slope[3] = { 1.2, 0.9, 1.1 };
+    const double offs[3]  = { 0.01, -0.02, 0.03 };
+    const double power[3] = { 1.1, 0.9, 1.2 };
+    cdl->setSlope(slope);
+    cdl->setOffset(offs);
+    cdl->setPower(power);
+    cdl->setSat(1.3);
+
+    OCIO::ExponentTransformRcPtr gamma = OCIO::ExponentTransform::Create();
+    const double exponent[4] = { 2.2, 2.4, 2.6, 1.0 };
+    gamma->setValue(exponent);
+    gamma->setNegativeStyle(OCIO::NEGATIVE_MIRROR);
+
+    OCIO::ExponentWithLinearTransformRcPtr moncurve
+        = OCIO::ExponentWithLinearTransform::Create();
+    const double mgamma[4]  = { 2.4, 2.2, 2.0, 1.0 };
+    const double moffset[4] = { 0.055, 0.09, 0.1, 0.0 };
+    moncurve->setGamma(mgamma);
+    moncurve->setOffset(moffset);
+    moncurve->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(matrix);
+        group->appendTransform(range);
+        group->appendTransform(cdl);
+        group->appendTransform(gamma);
+        group->appendTransform(moncurve);
+        group->appendTransform(log);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+        ValidatePlanarProcessing(proc);
+    }
+
+    // The 3D LUT does not support the planar processing so the RGBA processing is used.
+    {
+        OCIO::FileTransformRcPtr lut = OCIO::CreateFileTransform("lut3d_1.spi3d");
+
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(range);
+        group->appendTransform(lut);
+        group->appendTransform(matrix);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+        ValidatePlanarProcessing<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>(proc);
+        ValidatePlanarProcessing<OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F16>(proc);
+    }
+}
+
+namespace
+{
+
+// Encode the uint16_t values of an image line using a channel packing. The values are already
+// in the channel ordering of the image.
+std::vector<uint8_t> EncodeChannels(OCIO::ChannelPacking packing,
+                                    const std::vector<uint16_t> & values)
+{
+    std::vector<uint8_t> bytes;
+
+    switch (packing)
+    {
+        case OCIO::CHANNEL_PACKING_10BIT_FILLED_A:
+        case OCIO::CHANNEL_PACKING_10BIT_FILLED_B:
+        {
+            const bool methodA = packing == OCIO::CHANNEL_PACKING_10BIT_FILLED_A;
+            for (size_t idx = 0; idx < values.size(); idx += 3)
+            {
+                const uint32_t word = methodA ? (uint32_t(values[idx + 0]) << 22)
+                                                | (uint32_t(values[idx + 1]) << 12)
+                                                | (uint32_t(values[idx + 2]) << 2)
+                                              : (uint32_t(values[idx + 0]) << 20)
+                                                | (uint32_t(values[idx + 1]) << 10)
+                                                | uint32_t(values[idx + 2]);
+                const uint8_t * b = reinterpret_cast<const uint8_t *>(&word);
+                bytes.insert(bytes.end(), b, b + sizeof(uint32_t));
+            }
+            break;
+        }
+        case OCIO::CHANNEL_PACKING_12BIT_FILLED_A:
+        {
+            for (const uint16_t value : values)
+            {
+                const uint16_t v = uint16_t(value << 4);
+                const uint8_t * b = reinterpret_cast<const uint8_t *>(&v);
+                bytes.insert(bytes.end(), b, b + sizeof(uint16_t));
+            }
+            break;
+        }
+        case OCIO::CHANNEL_PACKING_12BIT_PACKED:
+        {
+            bytes.resize((values.size() * 12 + 7) / 8, 0);
+            for (size_t idx = 0; idx < values.size(); ++idx)
+            {
+                for (unsigned bit = 0; bit < 12; ++bit)
+                {
+                    // The most significant bit first.
+                    if (values[idx] & (1 << (11 - bit)))
+                    {
+                        const size_t pos = idx * 12 + bit;
+                        bytes[pos / 8] |= uint8_t(0x80 >> (pos % 8));
+                    }
+                }
+            }
+            break;
+        }
+        case OCIO::CHANNEL_PACKING_NONE:
+            break;
+    }
+
+    return bytes;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, packed_channels)
+{
+    // The images having the channels packed in words (e.g. DPX and Cineon images) must be
+    // processed like the same values stored as one uint16_t per channel.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    // The exponent becomes a 1D LUT doing the look-up of the integer input values.
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 1.8, 2.0, 2.2, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.6, 0.1,
+                             0.0, 0.0, 0.0, 0.9 };
+    matrix->setMatrix(m44);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(exponent);
+    group->appendTransform(matrix);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+
+    constexpr long width = 5;
+    constexpr long height = 3;
+
+    struct Format
+    {
+        OCIO::ChannelPacking m_packing;
+        OCIO::ChannelOrdering m_order;
+    };
+
+    const Format formats[] = {
+        { OCIO::CHANNEL_PACKING_10BIT_FILLED_A, OCIO::CHANNEL_ORDERING_RGB },
+        { OCIO::CHANNEL_PACKING_10BIT_FILLED_A, OCIO::CHANNEL_ORDERING_BGR },
+        { OCIO::CHANNEL_PACKING_10BIT_FILLED_B, OCIO::CHANNEL_ORDERING_RGB },
+        { OCIO::CHANNEL_PACKING_12BIT_FILLED_A, OCIO::CHANNEL_ORDERING_RGB },
+        { OCIO::CHANNEL_PACKING_12BIT_FILLED_A, OCIO::CHANNEL_ORDERING_BGRA },
+        { OCIO::CHANNEL_PACKING_12BIT_PACKED,   OCIO::CHANNEL_ORDERING_RGB },
+        { OCIO::CHANNEL_PACKING_12BIT_PACKED,   OCIO::CHANNEL_ORDERING_ABGR },
+    };
+
+    for (const auto & format : formats)
+    {
+        const long numChannels = (format.m_order == OCIO::CHANNEL_ORDERING_RGB
+                                  || format.m_order == OCIO::CHANNEL_ORDERING_BGR) ? 3 : 4;
+        const bool is10Bit = format.m_packing == OCIO::CHANNEL_PACKING_10BIT_FILLED_A
+                             || format.m_packing == OCIO::CHANNEL_PACKING_10BIT_FILLED_B;
+        const OCIO::BitDepth bitDepth = is10Bit ? OCIO::BIT_DEPTH_UINT10 : OCIO::BIT_DEPTH_UINT12;
+        const unsigned maxValue = is10Bit ? 1023 : 4095;
+
+        std::vector<uint16_t> values(numChannels * width * height);
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            values[idx] = uint16_t((idx * 997 + 13) % (maxValue + 1));
+        }
+
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(bitDepth,
+                                                                  bitDepth,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        // The reference is the processing of the uint16_t values.
+        std::vector<uint16_t> refValues(values.size());
+        OCIO::PackedImageDesc refIn(values.data(), width, height, format.m_order,
+                                    bitDepth,
+                                    OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc refOut(refValues.data(), width, height, format.m_order,
+                                     bitDepth,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpu->apply(refIn, refOut));
+
+        // Each line is encoded separately (i.e. the lines start on a byte boundary).
+        std::vector<uint8_t> in, ref;
+        ptrdiff_t yStrideBytes = 0;
+        for (long y = 0; y < height; ++y)
+        {
+            const auto first = values.begin() + y * width * numChannels;
+            const std::vector<uint16_t> line(first, first + width * numChannels);
+            const std::vector<uint8_t> bytes = EncodeChannels(format.m_packing, line);
+            yStrideBytes = ptrdiff_t(bytes.size());
+            in.insert(in.end(), bytes.begin(), bytes.end());
+
+            const auto refFirst = refValues.begin() + y * width * numChannels;
+            const std::vector<uint16_t> refLine(refFirst, refFirst + width * numChannels);
+            const std::vector<uint8_t> refBytes = EncodeChannels(format.m_packing, refLine);
+            ref.insert(ref.end(), refBytes.begin(), refBytes.end());
+        }
+
+        // Use 4-byte words to have aligned buffers.
+        std::vector<uint32_t> inWords((in.size() + 3) / 4, 0);
+        memcpy(inWords.data(), in.data(), in.size());
+        std::vector<uint32_t> outWords(inWords.size(), 0);
+
+        OCIO::PackedImageDesc inDesc(inWords.data(), width, height, format.m_order,
+                                     format.m_packing, yStrideBytes);
+        OCIO::PackedImageDesc outDesc(outWords.data(), width, height, format.m_order,
+                                      format.m_packing, OCIO::AutoStride);
+
+        OCIO_CHECK_EQUAL(inDesc.getBitDepth(), bitDepth);
+        OCIO_CHECK_EQUAL(inDesc.getChannelPacking(), format.m_packing);
+        OCIO_CHECK_EQUAL(inDesc.getYStrideBytes(), yStrideBytes);
+        OCIO_CHECK_EQUAL(outDesc.getYStrideBytes(), yStrideBytes);
+        OCIO_CHECK_ASSERT(!inDesc.isRGBAPacked());
+
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+        OCIO_CHECK_ASSERT(memcmp(outWords.data(), ref.data(), ref.size()) == 0);
+
+        // In place processing.
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc));
+        OCIO_CHECK_ASSERT(memcmp(inWords.data(), ref.data(), ref.size()) == 0);
+    }
+
+    // Only the 10-bit images without alpha are supported.
+    uint32_t words[4];
+    OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(words, 2, 2, OCIO::CHANNEL_ORDERING_RGBA,
+                                                OCIO::CHANNEL_PACKING_10BIT_FILLED_A,
+                                                OCIO::AutoStride),
+                          OCIO::Exception, "only support the RGB and BGR channel orderings");
+
+    OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(words, 2, 2, OCIO::CHANNEL_ORDERING_RGB,
+                                                OCIO::CHANNEL_PACKING_10BIT_FILLED_A, 4),
+                          OCIO::Exception, "Invalid y stride");
+
+    OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(words, 2, 2, OCIO::CHANNEL_ORDERING_RGB,
+                                                OCIO::CHANNEL_PACKING_NONE, OCIO::AutoStride),
+                          OCIO::Exception, "Invalid channel packing");
+}
+
+OCIO_ADD_TEST(CPUProcessor, uint32_bit_depth)
+{
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double scale4[4] = { 0.5, 0.25, 2.0, 1.0 };
+    double m44[16];
+    double offset4[4];
+    OCIO::MatrixTransform::Scale(m44, offset4, scale4);
+    matrix->setMatrix(m44);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(matrix));
+
+    constexpr uint32_t maxValue = 4294967295u;
+
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT32,
+                                                                  OCIO::BIT_DEPTH_UINT32,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<uint32_t> img = { maxValue, maxValue, maxValue, maxValue,
+                                      0,        0,        0,        0 };
+
+        OCIO::PackedImageDesc desc(img.data(), 2, 1, 4, OCIO::BIT_DEPTH_UINT32,
+                                   OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_ASSERT(desc.isRGBAPacked());
+        OCIO_CHECK_NO_THROW(cpu->apply(desc));
+
+        // The values are clamped to the max value.
+        OCIO_CHECK_EQUAL(img[0], 2147483648u);
+        OCIO_CHECK_EQUAL(img[1], 1073741824u);
+        OCIO_CHECK_EQUAL(img[2], maxValue);
+        OCIO_CHECK_EQUAL(img[3], maxValue);
+        OCIO_CHECK_EQUAL(img[4], 0u);
+        OCIO_CHECK_EQUAL(img[5], 0u);
+        OCIO_CHECK_EQUAL(img[6], 0u);
+        OCIO_CHECK_EQUAL(img[7], 0u);
+    }
+
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                  OCIO::BIT_DEPTH_UINT32,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<float> in = { 1.0f, -1.0f, 0.25f };
+        std::vector<uint32_t> out(3, 1);
+
+        OCIO::PackedImageDesc inDesc(in.data(), 1, 1, 3);
+        OCIO::PackedImageDesc outDesc(out.data(), 1, 1, 3, OCIO::BIT_DEPTH_UINT32,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+
+        OCIO_CHECK_EQUAL(out[0], 2147483648u);
+        OCIO_CHECK_EQUAL(out[1], 0u);
+        OCIO_CHECK_EQUAL(out[2], 2147483648u);
+    }
+
+    // A 1D LUT can not do the look-up of the 32-bit integer values.
+    OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create();
+    lut->setLength(3);
+    lut->setValue(1, 0.25f, 0.25f, 0.25f);
+    lut->setValue(2, 1.0f, 1.0f, 1.0f);
+
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(lut));
+
+    for (const auto bitDepth : { OCIO::BIT_DEPTH_UINT32, OCIO::BIT_DEPTH_UINT16 })
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT32,
+                                                                  bitDepth,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        const double outMax = bitDepth == OCIO::BIT_DEPTH_UINT32 ? double(maxValue) : 65535.;
+
+        std::vector<uint32_t> in = { maxValue, 0, maxValue / 2 + 1 };
+        std::vector<uint32_t> out32(3, 1);
+        std::vector<uint16_t> out16(3, 1);
+
+        OCIO::PackedImageDesc inDesc(in.data(), 1, 1, 3, OCIO::BIT_DEPTH_UINT32,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        void * outData = bitDepth == OCIO::BIT_DEPTH_UINT32 ? (void *)out32.data()
+                                                            : (void *)out16.data();
+        OCIO::PackedImageDesc outDesc(outData, 1, 1, 3, bitDepth,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO_CHECK_NO_THROW(cpu->apply(inDesc, outDesc));
+
+        const double res[3] = {
+            bitDepth == OCIO::BIT_DEPTH_UINT32 ? double(out32[0]) : double(out16[0]),
+            bitDepth == OCIO::BIT_DEPTH_UINT32 ? double(out32[1]) : double(out16[1]),
+            bitDepth == OCIO::BIT_DEPTH_UINT32 ? double(out32[2]) : double(out16[2]) };
+
+        // The LUT is interpolated in 32-bit float (i.e. the integer outputs are rounded).
+        OCIO_CHECK_EQUAL(res[0], outMax);
+        OCIO_CHECK_EQUAL(res[1], 0.);
+        OCIO_CHECK_CLOSE(res[2], 0.25 * outMax, std::max(1., 1e-6 * outMax));
+    }
+}
+
+namespace
+{
+
+// Check that the two CPU processors give exactly the same results for several image layouts.
+template<typename InType, typename OutType>
+void ValidateIntegerDomain(const OCIO::ConstCPUProcessorRcPtr & cpuRef,
+                           const OCIO::ConstCPUProcessorRcPtr & cpu,
+                           unsigned line)
+{
+    const OCIO::BitDepth inBD  = cpu->getInputBitDepth();
+    const OCIO::BitDepth outBD = cpu->getOutputBitDepth();
+
+    const unsigned inMax = unsigned(OCIO::GetBitDepthMaxValue(inBD));
+
+    constexpr long width  = 37;
+    constexpr long height = 5;
+    constexpr long numValues = width * height * 4;
+
+    std::vector<InType> in(numValues);
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        in[idx] = InType((idx * 7919 + 3) % (inMax + 1));
+    }
+
+    // Packed RGBA and RGB images.
+    for (const long numChannels : { 4, 3 })
+    {
+        std::vector<OutType> ref(numValues, 0);
+        std::vector<OutType> res(numValues, 0);
+
+        OCIO::PackedImageDesc inDesc(in.data(), width, height, numChannels, inBD,
+                                     OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc refDesc(ref.data(), width, height, numChannels, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PackedImageDesc resDesc(res.data(), width, height, numChannels, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+        OCIO_CHECK_NO_THROW_FROM(cpuRef->apply(inDesc, refDesc), line);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(inDesc, resDesc), line);
+        OCIO_CHECK_ASSERT_FROM(ref == res, line);
+    }
+
+    // Planar image.
+    {
+        std::vector<OutType> ref(numValues, 0);
+        std::vector<OutType> res(numValues, 0);
+
+        const long numPixels = width * height;
+        OCIO::PlanarImageDesc inDesc(&in[0], &in[numPixels], &in[2 * numPixels],
+                                     &in[3 * numPixels], width, height, inBD,
+                                     OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PlanarImageDesc refDesc(&ref[0], &ref[numPixels], &ref[2 * numPixels],
+                                      &ref[3 * numPixels], width, height, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride);
+        OCIO::PlanarImageDesc resDesc(&res[0], &res[numPixels], &res[2 * numPixels],
+                                      &res[3 * numPixels], width, height, outBD,
+                                      OCIO::AutoStride, OCIO::AutoStride);
+
+        OCIO_CHECK_NO_THROW_FROM(cpuRef->apply(inDesc, refDesc), line);
+        OCIO_CHECK_NO_THROW_FROM(cpu->apply(inDesc, resDesc), line);
+        OCIO_CHECK_ASSERT_FROM(ref == res, line);
+    }
+}
+
+// Return the max difference between the results of the two 8-bit CPU processors, in code
+// values, for all the red values and a subset of the green and blue values.
+double GetMaxIntegerDomainError(const OCIO::ConstCPUProcessorRcPtr & cpuRef,
+                                const OCIO::ConstCPUProcessorRcPtr & cpu)
+{
+    std::vector<uint8_t> in;
+    for (unsigned b = 0; b < 256; b += 5)
+    {
+        for (unsigned g = 0; g < 256; g += 5)
+        {
+            for (unsigned r = 0; r < 256; ++r)
+            {
+                in.push_back(uint8_t(r));
+                in.push_back(uint8_t(g));
+                in.push_back(uint8_t(b));
+            }
+        }
+    }
+
+    std::vector<uint8_t> ref(in.size(), 0);
+    std::vector<uint8_t> res(in.size(), 0);
+
+    const long height = long(in.size() / (256 * 3));
+    OCIO::PackedImageDesc inDesc(in.data(), 256, height, 3, OCIO::BIT_DEPTH_UINT8,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc refDesc(ref.data(), 256, height, 3, OCIO::BIT_DEPTH_UINT8,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc resDesc(res.data(), 256, height, 3, OCIO::BIT_DEPTH_UINT8,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+
+    cpuRef->apply(inDesc, refDesc);
+    cpu->apply(inDesc, resDesc);
+
+    double maxError = 0.;
+    for (size_t idx = 0; idx < ref.size(); ++idx)
+    {
+        maxError = std::max(maxError, std::fabs(double(ref[idx]) - double(res[idx])));
+    }
+    return maxError;
+}
+
+// Does one of the statistics entries include the name?
+bool HasStatisticsEntry(const OCIO::ConstCPUProcessorRcPtr & cpu, const std::string & name)
+{
+    for (const auto & entry : GetStatistics(*cpu))
+    {
+        if (std::string(entry.m_name).find(name) != std::string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // anon.
+
+OCIO_ADD_TEST(CPUProcessor, integer_domain_separable)
+{
+    // Without channel crosstalk, the look-up of all the integer input values gives exactly
+    // the results of the processing.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 2.2, 2.0, 1.8, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double scale4[4] = { 0.9, 0.8, 1.1, 0.5 };
+    double m44[16];
+    double offset4[4];
+    OCIO::MatrixTransform::Scale(m44, offset4, scale4);
+    matrix->setMatrix(m44);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(exponent);
+    group->appendTransform(matrix);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_INTEGER_DOMAIN);
+
+    const std::pair<OCIO::BitDepth, OCIO::BitDepth> bitDepths[] = {
+        { OCIO::BIT_DEPTH_UINT8,  OCIO::BIT_DEPTH_UINT8  },
+        { OCIO::BIT_DEPTH_UINT8,  OCIO::BIT_DEPTH_UINT16 },
+        { OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_UINT8  },
+        { OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_UINT10 },
+        { OCIO::BIT_DEPTH_UINT12, OCIO::BIT_DEPTH_UINT16 },
+        { OCIO::BIT_DEPTH_UINT16, OCIO::BIT_DEPTH_UINT16 },
+    };
+
+    for (const auto & bd : bitDepths)
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuRef, cpu;
+        OCIO_CHECK_NO_THROW(cpuRef = proc->getOptimizedCPUProcessor(bd.first, bd.second,
+                                                                     OCIO::OPTIMIZATION_DEFAULT));
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(bd.first, bd.second, flags));
+
+        cpu->enableStatistics(true);
+
+        if (bd.first == OCIO::BIT_DEPTH_UINT8 && bd.second == OCIO::BIT_DEPTH_UINT8)
+        {
+            ValidateIntegerDomain<uint8_t, uint8_t>(cpuRef, cpu, __LINE__);
+        }
+        else if (bd.first == OCIO::BIT_DEPTH_UINT8)
+        {
+            ValidateIntegerDomain<uint8_t, uint16_t>(cpuRef, cpu, __LINE__);
+        }
+        else if (bd.second == OCIO::BIT_DEPTH_UINT8)
+        {
+            ValidateIntegerDomain<uint16_t, uint8_t>(cpuRef, cpu, __LINE__);
+        }
+        else
+        {
+            ValidateIntegerDomain<uint16_t, uint16_t>(cpuRef, cpu, __LINE__);
+        }
+
+        const std::string name = std::string("lookup ") + OCIO::BitDepthToString(bd.first)
+                                 + " to " + OCIO::BitDepthToString(bd.second);
+        OCIO_CHECK_ASSERT(HasStatisticsEntry(cpu, name));
+    }
+
+    // The look-up also processes in place, and processes the out-of-range values (i.e. above
+    // 1023 for 10-bit) as the regular processing does.
+    OCIO::ConstCPUProcessorRcPtr cpuRef, cpu;
+    OCIO_CHECK_NO_THROW(cpuRef = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                                 OCIO::BIT_DEPTH_UINT10,
+                                                                 OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::BIT_DEPTH_UINT10,
+                                                              flags));
+
+    std::vector<uint16_t> ref = { 0, 1, 512, 1023,  1023, 0, 100, 1,  1500, 1024, 4095, 65535 };
+    std::vector<uint16_t> res = ref;
+
+    OCIO::PackedImageDesc refDesc(ref.data(), 3, 1, 4, OCIO::BIT_DEPTH_UINT10,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc resDesc(res.data(), 3, 1, 4, OCIO::BIT_DEPTH_UINT10,
+                                  OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW(cpuRef->apply(refDesc));
+    OCIO_CHECK_NO_THROW(cpu->apply(resDesc));
+    OCIO_CHECK_ASSERT(ref == res);
+
+    // The float images are not supported by the look-up.
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                              OCIO::BIT_DEPTH_UINT10,
+                                                              flags));
+    cpu->enableStatistics(true);
+    std::vector<float> in = { 0.5f, 0.5f, 0.5f, 1.0f,  1.0f, 0.0f, 0.1f, 0.0f,  0.f, 0.f, 0.f, 0.f };
+    OCIO::PackedImageDesc inDesc(in.data(), 3, 1, 4);
+    OCIO_CHECK_NO_THROW(cpu->apply(inDesc, resDesc));
+    OCIO_CHECK_ASSERT(!HasStatisticsEntry(cpu, "lookup"));
+
+    // The lossy optimization must be explicitly requested.
+    OCIO_CHECK_EQUAL((OCIO::OPTIMIZATION_ALL & OCIO::OPTIMIZATION_INTEGER_DOMAIN),
+                     OCIO::OPTIMIZATION_NONE);
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::BIT_DEPTH_UINT10,
+                                                              OCIO::OPTIMIZATION_DRAFT));
+    cpu->enableStatistics(true);
+    OCIO_CHECK_NO_THROW(cpu->apply(resDesc));
+    OCIO_CHECK_ASSERT(!HasStatisticsEntry(cpu, "lookup"));
+}
+
+OCIO_ADD_TEST(CPUProcessor, integer_domain_lut3d)
+{
+    // With channel crosstalk, the processing is replaced by a 3D LUT if its error is below
+    // one output code value.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.8, 0.1, 0.1, 0.0,
+                             0.2, 0.7, 0.1, 0.0,
+                             0.0, 0.3, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 1.0 };
+    matrix->setMatrix(m44);
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 1.8, 1.8, 1.8, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(matrix);
+    group->appendTransform(exponent);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+
+    const OCIO::OptimizationFlags flags
+        = OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT | OCIO::OPTIMIZATION_INTEGER_DOMAIN);
+
+    OCIO::ConstCPUProcessorRcPtr cpuRef, cpu;
+    OCIO_CHECK_NO_THROW(cpuRef = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                                 OCIO::BIT_DEPTH_UINT8,
+                                                                 OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                              OCIO::BIT_DEPTH_UINT8,
+                                                              flags));
+
+    cpu->enableStatistics(true);
+    OCIO_CHECK_LE(GetMaxIntegerDomainError(cpuRef, cpu), 1.);
+    OCIO_CHECK_ASSERT(HasStatisticsEntry(cpu, "<Lut3DOp>"));
+
+    // A steep curve cannot be approximated by a 3D LUT within the error bound so all the ops
+    // are processed.
+    const double steep[4] = { 20.0, 20.0, 20.0, 1.0 };
+    exponent->setValue(steep);
+
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+    OCIO_CHECK_NO_THROW(cpuRef = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                                 OCIO::BIT_DEPTH_UINT8,
+                                                                 OCIO::OPTIMIZATION_DEFAULT));
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                              OCIO::BIT_DEPTH_UINT8,
+                                                              flags));
+
+    cpu->enableStatistics(true);
+    OCIO_CHECK_EQUAL(GetMaxIntegerDomainError(cpuRef, cpu), 0.);
+    OCIO_CHECK_ASSERT(!HasStatisticsEntry(cpu, "<Lut3DOp>"));
+}
+
+OCIO_ADD_TEST(CPUProcessor, apply_images)
+{
+    // Processing several images at once gives exactly the results of processing the images
+    // one by one.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 2.2, 2.0, 1.8, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(exponent));
+
+    // Enough images of various sizes and layouts to be split between the threads.
+    constexpr size_t numImages = 37;
+
+    auto getWidth  = [](size_t idx) { return long(1 + idx * 3); };
+    auto getHeight = [](size_t idx) { return long(1 + idx % 5); };
+
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8,
+                                                                  OCIO::BIT_DEPTH_F32,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<std::vector<uint8_t>> srcValues(numImages);
+        std::vector<std::vector<float>> dstValues(numImages), refValues(numImages);
+
+        std::vector<std::unique_ptr<OCIO::ImageDesc>> srcImgs, dstImgs;
+        std::vector<const OCIO::ImageDesc *> srcs;
+        std::vector<OCIO::ImageDesc *> dsts;
+
+        for (size_t idx = 0; idx < numImages; ++idx)
+        {
+            const long width  = getWidth(idx);
+            const long height = getHeight(idx);
+            const size_t numValues = size_t(width * height * 4);
+
+            srcValues[idx].resize(numValues);
+            for (size_t v = 0; v < numValues; ++v)
+            {
+                srcValues[idx][v] = uint8_t((idx * 7 + v * 13) % 256);
+            }
+            dstValues[idx].resize(numValues, -1.0f);
+            refValues[idx].resize(numValues, -1.0f);
+
+            // Alternate the destination layouts.
+            const OCIO::ChannelOrdering dstOrder
+                = (idx % 2) ? OCIO::CHANNEL_ORDERING_BGRA : OCIO::CHANNEL_ORDERING_RGBA;
+
+            srcImgs.emplace_back(new OCIO::PackedImageDesc(srcValues[idx].data(), width, height,
+                                                           4, OCIO::BIT_DEPTH_UINT8,
+                                                           OCIO::AutoStride, OCIO::AutoStride,
+                                                           OCIO::AutoStride));
+            dstImgs.emplace_back(new OCIO::PackedImageDesc(dstValues[idx].data(), width, height,
+                                                           dstOrder));
+
+            OCIO::PackedImageDesc refImg(refValues[idx].data(), width, height, dstOrder);
+            OCIO_CHECK_NO_THROW(cpu->apply(*srcImgs.back(), refImg));
+
+            srcs.push_back(srcImgs.back().get());
+            dsts.push_back(dstImgs.back().get());
+        }
+
+        OCIO_CHECK_NO_THROW(cpu->apply(srcs.data(), dsts.data(), numImages));
+
+        for (size_t idx = 0; idx < numImages; ++idx)
+        {
+            OCIO_CHECK_ASSERT(dstValues[idx] == refValues[idx]);
+        }
+
+        // Nothing to process.
+        OCIO_CHECK_NO_THROW(cpu->apply(srcs.data(), dsts.data(), 0));
+
+        // All the images are validated.
+        dsts[numImages / 2] = nullptr;
+        OCIO_CHECK_THROW_WHAT(cpu->apply(srcs.data(), dsts.data(), numImages),
+                              OCIO::Exception, "null image");
+
+        dsts[numImages / 2] = dstImgs[numImages / 2 + 1].get();
+        OCIO_CHECK_THROW_WHAT(cpu->apply(srcs.data(), dsts.data(), numImages),
+                              OCIO::Exception, "Dimension inconsistency");
+    }
+
+    // The images are also processed in place.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu;
+        OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                  OCIO::BIT_DEPTH_F32,
+                                                                  OCIO::OPTIMIZATION_DEFAULT));
+
+        std::vector<std::vector<float>> values(numImages), refValues(numImages);
+
+        std::vector<std::unique_ptr<OCIO::ImageDesc>> imgs;
+        std::vector<OCIO::ImageDesc *> ptrs;
+
+        for (size_t idx = 0; idx < numImages; ++idx)
+        {
+            const long width  = getWidth(idx);
+            const long height = getHeight(idx);
+            const size_t numValues = size_t(width * height * 3);
+
+            values[idx].resize(numValues);
+            for (size_t v = 0; v < numValues; ++v)
+            {
+                values[idx][v] = float((idx * 7 + v * 13) % 256) / 200.0f - 0.1f;
+            }
+            refValues[idx] = values[idx];
+
+            imgs.emplace_back(new OCIO::PackedImageDesc(values[idx].data(), width, height, 3));
+
+            OCIO::PackedImageDesc refImg(refValues[idx].data(), width, height, 3);
+            OCIO_CHECK_NO_THROW(cpu->apply(refImg));
+
+            ptrs.push_back(imgs.back().get());
+        }
+
+        OCIO_CHECK_NO_THROW(cpu->apply(ptrs.data(), numImages));
+
+        for (size_t idx = 0; idx < numImages; ++idx)
+        {
+            OCIO_CHECK_ASSERT(values[idx] == refValues[idx]);
+        }
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, scratch_memory)
+{
+    // The scanline helper and its line buffers are drawn from the scratch memory of the
+    // thread, so the processing of the successive tiles reuses the same memory blocks.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 2.2, 2.0, 1.8, 1.0 };
+    exponent->setValue(gamma);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(exponent));
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                              OCIO::BIT_DEPTH_UINT8,
+                                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    constexpr long width  = 64;
+    constexpr long height = 64;
+
+    std::vector<uint16_t> src(width * height * 4);
+    for (size_t idx = 0; idx < src.size(); ++idx)
+    {
+        src[idx] = uint16_t(idx * 37);
+    }
+    std::vector<uint8_t> dst(width * height * 3, 0);
+
+    const OCIO::PackedImageDesc srcImg(src.data(), width, height, 4, OCIO::BIT_DEPTH_UINT16,
+                                       OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc dstImg(dst.data(), width, height, OCIO::CHANNEL_ORDERING_BGR,
+                                 OCIO::BIT_DEPTH_UINT8, OCIO::AutoStride, OCIO::AutoStride,
+                                 OCIO::AutoStride);
+
+    OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg));
+    const std::vector<uint8_t> ref = dst;
+
+    const size_t numBlocks = OCIO::GetNumScratchBlocks();
+    OCIO_CHECK_GE(numBlocks, 1u);
+
+    for (int tile = 0; tile < 10; ++tile)
+    {
+        std::fill(dst.begin(), dst.end(), uint8_t(0));
+        OCIO_CHECK_NO_THROW(cpu->apply(srcImg, dstImg));
+        OCIO_CHECK_ASSERT(dst == ref);
+
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), numBlocks);
+    }
+}
+
 OCIO_ADD_TEST(CPUProcessor, one_pixel)
 {
     OCIO::ConstCPUProcessorRcPtr cpuProcessor;
@@ -2675,6 +3928,135 @@ OCIO_ADD_TEST(CPUProcessor, one_pixel)
     }
 }
 
+OCIO_ADD_TEST(CPUProcessor, apply_pixels)
+{
+    // Processing a list of pixels gives exactly the results of processing the same values as
+    // an image.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+    OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+    const double gamma[4] = { 2.2, 2.0, 1.8, 1.5 };
+    exponent->setValue(gamma);
+    group->appendTransform(exponent);
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4] = { 0.1, -0.2, 0.05, 0.3 };
+    matrix->setOffset(offset);
+    group->appendTransform(matrix);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getDefaultCPUProcessor());
+
+    // Enough pixels to be split between the threads, and not a multiple of the batch size.
+    constexpr size_t numPixels = 100003;
+
+    for (long numChannels : { 3l, 4l })
+    {
+        std::vector<float> values(numPixels * numChannels);
+        for (size_t idx = 0; idx < values.size(); ++idx)
+        {
+            values[idx] = float(idx % 1013) / 900.0f - 0.05f;
+        }
+
+        std::vector<float> refValues = values;
+        OCIO::PackedImageDesc refImg(refValues.data(), long(numPixels), 1, numChannels);
+        OCIO_CHECK_NO_THROW(cpu->apply(refImg));
+
+        // Packed pixels.
+        {
+            std::vector<float> pixels = values;
+
+            if (numChannels == 3)
+            {
+                OCIO_CHECK_NO_THROW(cpu->applyRGB(pixels.data(), numPixels));
+            }
+            else
+            {
+                OCIO_CHECK_NO_THROW(cpu->applyRGBA(pixels.data(), numPixels));
+            }
+
+            OCIO_CHECK_ASSERT(pixels == refValues);
+        }
+
+        // Pixels with extra data in between, which is left untouched.
+        {
+            constexpr float padding = -123.0f;
+            const long stride = numChannels + 2;
+
+            std::vector<float> pixels(numPixels * stride, padding);
+            for (size_t idx = 0; idx < numPixels; ++idx)
+            {
+                std::copy_n(&values[idx * numChannels], numChannels, &pixels[idx * stride]);
+            }
+
+            const ptrdiff_t strideBytes = stride * sizeof(float);
+            if (numChannels == 3)
+            {
+                OCIO_CHECK_NO_THROW(cpu->applyRGB(pixels.data(), numPixels, strideBytes));
+            }
+            else
+            {
+                OCIO_CHECK_NO_THROW(cpu->applyRGBA(pixels.data(), numPixels, strideBytes));
+            }
+
+            for (size_t idx = 0; idx < numPixels; ++idx)
+            {
+                for (long chan = 0; chan < stride; ++chan)
+                {
+                    const float expected = chan < numChannels ? refValues[idx * numChannels + chan]
+                                                              : padding;
+                    if (pixels[idx * stride + chan] != expected)
+                    {
+                        OCIO_CHECK_EQUAL(pixels[idx * stride + chan], expected);
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    // The single pixel methods give the same results.
+    {
+        float pixels[2 * 3]{ 0.1f, 0.3f, 0.9f, 0.5f, 0.2f, 0.7f };
+        float pixel[3]{ 0.5f, 0.2f, 0.7f };
+
+        OCIO_CHECK_NO_THROW(cpu->applyRGB(pixels, 2, OCIO::AutoStride));
+        OCIO_CHECK_NO_THROW(cpu->applyRGB(pixel));
+
+        OCIO_CHECK_EQUAL(pixels[3], pixel[0]);
+        OCIO_CHECK_EQUAL(pixels[4], pixel[1]);
+        OCIO_CHECK_EQUAL(pixels[5], pixel[2]);
+    }
+
+    // Nothing to process.
+    OCIO_CHECK_NO_THROW(cpu->applyRGBA(nullptr, 0));
+
+    // Faulty cases.
+
+    float pixels[8]{ 0.0f };
+
+    OCIO_CHECK_THROW_WHAT(cpu->applyRGBA(nullptr, 2), OCIO::Exception, "pixels is null");
+
+    OCIO_CHECK_THROW_WHAT(cpu->applyRGBA(pixels, 2, 3 * sizeof(float)),
+                          OCIO::Exception, "Invalid pixel stride of 12 bytes");
+
+    OCIO_CHECK_THROW_WHAT(cpu->applyRGB(pixels, 2, 3 * sizeof(float) + 2),
+                          OCIO::Exception, "Invalid pixel stride of 14 bytes");
+
+    OCIO_CHECK_NO_THROW(cpu = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT16,
+                                                              OCIO::BIT_DEPTH_F32,
+                                                              OCIO::OPTIMIZATION_DEFAULT));
+
+    OCIO_CHECK_THROW_WHAT(cpu->applyRGBA(pixels, 2),
+                          OCIO::Exception, "requires 32-bit float input and output bit-depths");
+}
+
 namespace
 {
 
@@ -2853,3 +4235,159 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
     }
 }
 
+OCIO_ADD_TEST(CPUProcessor, specialize_dynamic_properties)
+{
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setStyle(OCIO::EXPOSURE_CONTRAST_LINEAR);
+    ec->makeExposureDynamic();
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(ec);
+
+    // Without the flag, the generic engine is always used.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+        float pixel[4]{ 0.5f, 0.25f, 0.125f, 1.0f };
+        for (int idx = 0; idx < 3; ++idx)
+        {
+            cpu->applyRGBA(pixel);
+            OCIO_CHECK_EQUAL(cpu->getLastEngineType(), OCIO::CPU_ENGINE_GENERIC);
+        }
+    }
+
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getOptimizedCPUProcessor(
+        OCIO::OptimizationFlags(OCIO::OPTIMIZATION_DEFAULT
+                                | OCIO::OPTIMIZATION_SPECIALIZE_DYNAMIC_PROPERTIES));
+
+    OCIO::DynamicPropertyRcPtr dp = cpu->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    OCIO::DynamicPropertyDoubleRcPtr exposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+
+    // Apply until the specialized engine (built in the background) is used.
+    auto applyUntilSpecialized = [&cpu](float expected)
+    {
+        for (int idx = 0; idx < 1000; ++idx)
+        {
+            float pixel[4]{ 0.5f, 0.25f, 0.125f, 1.0f };
+            cpu->applyRGBA(pixel);
+            OCIO_CHECK_CLOSE(pixel[0], 0.5f * expected, 1e-5f);
+            OCIO_CHECK_CLOSE(pixel[1], 0.25f * expected, 1e-5f);
+            OCIO_CHECK_CLOSE(pixel[2], 0.125f * expected, 1e-5f);
+
+            if (cpu->getLastEngineType() == OCIO::CPU_ENGINE_SPECIALIZED)
+            {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    exposure->setValue(1.0);
+    applyUntilSpecialized(2.0f);
+    OCIO_CHECK_EQUAL(cpu->getLastEngineType(), OCIO::CPU_ENGINE_SPECIALIZED);
+
+    // A value change immediately falls back to the generic engine.
+    exposure->setValue(2.0);
+    float pixel[4]{ 0.5f, 0.25f, 0.125f, 1.0f };
+    cpu->applyRGBA(pixel);
+    OCIO_CHECK_EQUAL(cpu->getLastEngineType(), OCIO::CPU_ENGINE_GENERIC);
+    OCIO_CHECK_CLOSE(pixel[0], 2.0f, 1e-5f);
+
+    // The image apply uses the engine specialized for the new value once it settles.
+    applyUntilSpecialized(4.0f);
+    OCIO_CHECK_EQUAL(cpu->getLastEngineType(), OCIO::CPU_ENGINE_SPECIALIZED);
+
+    std::vector<float> img{ 0.5f, 0.25f, 0.125f, 1.0f,  0.1f, 0.2f, 0.3f, 1.0f };
+    OCIO::PackedImageDesc desc(img.data(), 2, 1, 4);
+    cpu->apply(desc);
+    OCIO_CHECK_EQUAL(cpu->getLastEngineType(), OCIO::CPU_ENGINE_SPECIALIZED);
+    OCIO_CHECK_CLOSE(img[0], 2.0f, 1e-5f);
+    OCIO_CHECK_CLOSE(img[6], 1.2f, 1e-5f);
+}
+
+OCIO_ADD_TEST(CPUProcessor, statistics)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::MatrixTransformRcPtr offset1 = OCIO::MatrixTransform::Create();
+    const double off1[4]{ 0.1, 0.1, 0.1, 0. };
+    offset1->setOffset(off1);
+
+    OCIO::MatrixTransformRcPtr offset2 = OCIO::MatrixTransform::Create();
+    const double off2[4]{ 0.2, 0.2, 0.2, 0. };
+    offset2->setOffset(off2);
+
+    OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+    range->setMinInValue(0.);
+    range->setMinOutValue(0.);
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(offset1);
+    group->appendTransform(offset2);
+    group->appendTransform(range);
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(group);
+    OCIO::ConstCPUProcessorRcPtr cpu
+        = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_UINT8, OCIO::BIT_DEPTH_F32,
+                                         OCIO::OPTIMIZATION_NONE);
+
+    std::vector<uint8_t> inImg{ 0, 51, 102, 255,  255, 255, 255, 255,  0, 0, 0, 0 };
+    std::vector<float> outImg(inImg.size(), -1.0f);
+
+    OCIO::PackedImageDesc inDesc(inImg.data(), 3, 1, 4, OCIO::BIT_DEPTH_UINT8,
+                                 OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO::PackedImageDesc outDesc(outImg.data(), 3, 1, 4);
+
+    // The statistics are disabled by default.
+    OCIO_CHECK_ASSERT(!cpu->isStatisticsEnabled());
+    cpu->apply(inDesc, outDesc);
+    OCIO_CHECK_EQUAL(cpu->getNumStatistics(), 0);
+
+    cpu->enableStatistics(true);
+    OCIO_CHECK_ASSERT(cpu->isStatisticsEnabled());
+
+    cpu->apply(inDesc, outDesc);
+    OCIO_CHECK_CLOSE(outImg[0], 0.3f, 1e-6f);
+    OCIO_CHECK_CLOSE(outImg[2], 0.7f, 1e-6f);
+
+    cpu->apply(inDesc, outDesc);
+
+    // The steps are listed in the processing order. The last op converts to the output
+    // bit-depth.
+    std::vector<OCIO::CPUOpStatistics> stats = GetStatistics(*cpu);
+    OCIO_REQUIRE_EQUAL(stats.size(), 4);
+    OCIO_CHECK_EQUAL(std::string(stats[0].m_name), "unpack 8ui");
+    OCIO_CHECK_EQUAL(std::string(stats[1].m_name), "0: <MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(stats[2].m_name), "1: <MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(stats[3].m_name), "2: <RangeOp> + pack 32f");
+    for (const auto & step : stats)
+    {
+        OCIO_CHECK_EQUAL(step.m_numPixels, 6);
+        OCIO_CHECK_ASSERT(step.m_seconds >= 0.);
+    }
+    OCIO_CHECK_THROW_WHAT(cpu->getStatistics(4), OCIO::Exception, "Invalid CPU processor statistics index 4.");
+
+    // A reset only clears the accumulated values.
+    cpu->resetStatistics();
+    OCIO_CHECK_EQUAL(cpu->getNumStatistics(), 0);
+
+    cpu->enableStatistics(false);
+    cpu->apply(inDesc, outDesc);
+    OCIO_CHECK_EQUAL(cpu->getNumStatistics(), 0);
+
+    // The single pixel methods are also measured.
+    OCIO::ConstCPUProcessorRcPtr cpuF32
+        = proc->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                         OCIO::OPTIMIZATION_NONE);
+    cpuF32->enableStatistics(true);
+
+    float pixel[3]{ 0.5f, 0.5f, 0.5f };
+    cpuF32->applyRGB(pixel);
+    OCIO_CHECK_CLOSE(pixel[0], 0.8f, 1e-6f);
+
+    stats = GetStatistics(*cpuF32);
+    OCIO_REQUIRE_EQUAL(stats.size(), 3);
+    OCIO_CHECK_EQUAL(std::string(stats[0].m_name), "unpack 32f + 0: <MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(stats[1].m_name), "1: <MatrixOffsetOp>");
+    OCIO_CHECK_EQUAL(std::string(stats[2].m_name), "2: <RangeOp> + pack 32f");
+    OCIO_CHECK_EQUAL(stats[1].m_numPixels, 1);
+}
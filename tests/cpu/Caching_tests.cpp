@@ -5,6 +5,7 @@
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
 
@@ -42,6 +43,31 @@ struct Guard
     
     const std::string m_envvar;
 };
+
+// Get the statistics of the caches of a config, processor or context instance.
+template<typename Instance>
+std::vector<OCIO::CacheStatistics> GetStatistics(const Instance & instance)
+{
+    std::vector<OCIO::CacheStatistics> stats;
+    for (int idx = 0; idx < instance.getNumCacheStatistics(); ++idx)
+    {
+        stats.push_back(instance.getCacheStatistics(idx));
+    }
+    return stats;
+}
+
+OCIO::CacheStatistics FindStatistics(const std::vector<OCIO::CacheStatistics> & stats,
+                                     const std::string & name)
+{
+    for (const auto & stat : stats)
+    {
+        if (stat.m_name == name)
+        {
+            return stat;
+        }
+    }
+    throw OCIO::Exception(("Missing cache statistics for " + name).c_str());
+}
     
 }
 
@@ -106,6 +132,46 @@ OCIO_ADD_TEST(Caching, generic_cache)
     }
 }
 
+OCIO_ADD_TEST(Caching, generic_cache_max_entries)
+{
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+    cache.setMaxEntries(2);
+
+    {
+        OCIO::AutoMutex m(cache.lock());
+
+        cache["entry1"] = std::make_shared<Data>();
+        cache["entry2"] = std::make_shared<Data>();
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+
+        // Accessing an existing entry does not evict anything.
+        OCIO_CHECK_ASSERT(cache["entry1"]);
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+
+        // The oldest entry is evicted to make room for the new one.
+        cache["entry3"] = std::make_shared<Data>();
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+
+        cache["entry4"] = std::make_shared<Data>();
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+        OCIO_CHECK_ASSERT(cache.exists("entry4"));
+    }
+
+    // The insertion order is reset with the entries.
+    OCIO_CHECK_NO_THROW(cache.clear());
+
+    OCIO::AutoMutex m(cache.lock());
+
+    cache["entry5"] = std::make_shared<Data>();
+    cache["entry6"] = std::make_shared<Data>();
+    OCIO_CHECK_ASSERT(cache.exists("entry5"));
+    OCIO_CHECK_ASSERT(cache.exists("entry6"));
+}
+
 OCIO_ADD_TEST(Caching, processor_cache)
 {
     // A unit test to check the ProcessorCache class.
@@ -139,3 +205,140 @@ OCIO_ADD_TEST(Caching, processor_cache)
     }
 }
 
+
+OCIO_ADD_TEST(Caching, cache_statistics)
+{
+    OCIO::GenericCache<std::string, DataRcPtr> cache;
+
+    {
+        OCIO::AutoMutex m(cache.lock());
+        cache["entry1"] = std::make_shared<Data>();
+        cache["entry12"] = std::make_shared<Data>();
+    }
+
+    cache.counters().addHit();
+    cache.counters().addHit();
+    {
+        OCIO::CacheMissTimer timer(cache.counters());
+    }
+
+    auto entryBytes = [](const std::string & key, const DataRcPtr &) { return key.size(); };
+
+    OCIO::CacheStatistics stats = cache.getStatistics("test", entryBytes);
+    OCIO_CHECK_EQUAL(stats.m_name, std::string("test"));
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_approximateBytes, 13);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 2);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 1);
+    OCIO_CHECK_ASSERT(stats.m_missTime >= 0.);
+
+    // Clearing the cache does not reset the counters.
+    cache.clear();
+    stats = cache.getStatistics("test", entryBytes);
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+    OCIO_CHECK_EQUAL(stats.m_approximateBytes, 0);
+    OCIO_CHECK_EQUAL(stats.m_numHits, 2);
+    OCIO_CHECK_EQUAL(stats.m_numMisses, 1);
+}
+
+OCIO_ADD_TEST(Caching, global_cache_statistics)
+{
+    OCIO::ClearAllCaches();
+
+    OCIO::CacheStatistics stats = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE);
+    OCIO_CHECK_EQUAL(std::string(stats.m_name), "file");
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+    OCIO_CHECK_EQUAL(stats.m_approximateBytes, 0);
+    stats = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE_HASH);
+    OCIO_CHECK_EQUAL(std::string(stats.m_name), "file_hash");
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+    stats = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_OP_COMPOSITION);
+    OCIO_CHECK_EQUAL(std::string(stats.m_name), "op_composition");
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 0);
+
+    const unsigned long long numHits
+        = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE).m_numHits;
+    const unsigned long long numMisses
+        = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE).m_numMisses;
+
+    // Use two configs so the second processor is not found in the processor cache.
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor("lut1d_1.spi1d"));
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor("lut1d_1.spi1d"));
+
+    const OCIO::CacheStatistics fileStats = OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE);
+    OCIO_CHECK_EQUAL(fileStats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(fileStats.m_numHits, numHits + 1);
+    OCIO_CHECK_EQUAL(fileStats.m_numMisses, numMisses + 1);
+    OCIO_CHECK_ASSERT(fileStats.m_missTime > 0.);
+    // The LUT entries are accounted for.
+    OCIO_CHECK_ASSERT(fileStats.m_approximateBytes > 512 * sizeof(float));
+
+    OCIO_CHECK_ASSERT(
+        OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE_HASH).m_numEntries >= 1);
+
+    // Clear only one cache.
+    OCIO_CHECK_NO_THROW(OCIO::ClearCache(OCIO::GLOBAL_CACHE_FILE));
+    OCIO_CHECK_EQUAL(OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE).m_numEntries, 0);
+    OCIO_CHECK_ASSERT(
+        OCIO::GetCacheStatistics(OCIO::GLOBAL_CACHE_FILE_HASH).m_numEntries >= 1);
+
+    OCIO_CHECK_THROW_WHAT(OCIO::ClearCache(OCIO::GlobalCacheType(42)), OCIO::Exception,
+                          "Invalid global cache type 42.");
+    OCIO_CHECK_THROW_WHAT(OCIO::GetCacheStatistics(OCIO::GlobalCacheType(-1)), OCIO::Exception,
+                          "Invalid global cache type -1.");
+}
+
+OCIO_ADD_TEST(Caching, instance_cache_statistics)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    OCIO::FileTransformRcPtr transform = OCIO::CreateFileTransform("lut1d_1.spi1d");
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(transform));
+    OCIO_CHECK_NO_THROW(config->getProcessor(transform));
+
+    std::vector<OCIO::CacheStatistics> stats = GetStatistics(*config);
+    OCIO_REQUIRE_EQUAL(stats.size(), 1);
+    OCIO_CHECK_EQUAL(stats[0].m_name, std::string("processor"));
+    OCIO_CHECK_EQUAL(stats[0].m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stats[0].m_numHits, 1);
+    OCIO_CHECK_EQUAL(stats[0].m_numMisses, 1);
+
+    config->clearProcessorCache();
+    OCIO_CHECK_EQUAL(config->getCacheStatistics(0).m_numEntries, 0);
+    OCIO_CHECK_THROW_WHAT(config->getCacheStatistics(1), OCIO::Exception,
+                          "Invalid cache statistics index 1.");
+
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+
+    stats = GetStatistics(*proc);
+    OCIO_REQUIRE_EQUAL(stats.size(), 3);
+    const OCIO::CacheStatistics cpuStats = FindStatistics(stats, "cpu_processor");
+    OCIO_CHECK_EQUAL(cpuStats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(cpuStats.m_numHits, 1);
+    OCIO_CHECK_EQUAL(cpuStats.m_numMisses, 1);
+    OCIO_CHECK_EQUAL(FindStatistics(stats, "gpu_processor").m_numEntries, 0);
+
+    proc->clearCaches();
+    OCIO_CHECK_EQUAL(FindStatistics(GetStatistics(*proc), "cpu_processor").m_numEntries, 0);
+
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+    context->setStringVar("SHOT", "0010");
+    OCIO_CHECK_EQUAL(std::string(context->resolveStringVar("shot_$SHOT")), "shot_0010");
+    OCIO_CHECK_EQUAL(std::string(context->resolveStringVar("shot_$SHOT")), "shot_0010");
+
+    stats = GetStatistics(*context);
+    OCIO_REQUIRE_EQUAL(stats.size(), 2);
+    const OCIO::CacheStatistics stringStats = FindStatistics(stats, "resolved_string");
+    OCIO_CHECK_EQUAL(stringStats.m_numEntries, 1);
+    OCIO_CHECK_EQUAL(stringStats.m_numHits, 1);
+    OCIO_CHECK_EQUAL(stringStats.m_numMisses, 1);
+    OCIO_CHECK_ASSERT(stringStats.m_approximateBytes > 0);
+
+    context->clearCaches();
+    OCIO_CHECK_EQUAL(FindStatistics(GetStatistics(*context),
+                                    "resolved_string").m_numEntries, 0);
+    OCIO_CHECK_THROW_WHAT(context->getCacheStatistics(2), OCIO::Exception,
+                          "Invalid cache statistics index 2.");
+}
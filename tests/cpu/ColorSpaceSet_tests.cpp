@@ -314,3 +314,61 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_index)
+{
+    // The name & alias lookups use an index which must stay in sync with the list.
+
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    OCIO::ColorSpaceRcPtr cs1 = OCIO::ColorSpace::Create();
+    cs1->setName("cs1");
+    cs1->addAlias("alias1");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs1));
+
+    OCIO::ColorSpaceRcPtr cs2 = OCIO::ColorSpace::Create();
+    cs2->setName("cs2");
+    cs2->addAlias("alias2");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs2));
+
+    OCIO::ColorSpaceRcPtr cs3 = OCIO::ColorSpace::Create();
+    cs3->setName("cs3");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs3));
+
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("CS2"), 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Alias2"), 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs3"), 2);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("unknown"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(""), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(nullptr), -1);
+
+    // Removing a color space changes the index of the following ones.
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("cs1"));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs1"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias1"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs3"), 1);
+
+    // Replacing a color space updates its aliases.
+    OCIO::ColorSpaceRcPtr cs2bis = OCIO::ColorSpace::Create();
+    cs2bis->setName("CS2");
+    cs2bis->addAlias("alias2bis");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs2bis));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), 2);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2bis"), 0);
+    OCIO_CHECK_EQUAL(std::string(css->getColorSpaceNameByIndex(0)), "CS2");
+
+    // The alias is now free to be used by another color space.
+    cs1->removeAlias("alias1");
+    cs1->addAlias("alias2");
+    OCIO_CHECK_NO_THROW(css->addColorSpace(cs1));
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias2"), 2);
+
+    // Copies have their own index.
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("cs3"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("cs3"), 1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("ALIAS2"), 2);
+}
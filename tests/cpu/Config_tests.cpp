@@ -3,6 +3,7 @@
 
 
 #include <sys/stat.h>
+#include <thread>
 
 #include "Config.cpp"
 #include "utils/StringUtils.h"
@@ -6900,6 +6901,194 @@ colorspaces:
     }
 }
 
+OCIO_ADD_TEST(Config, processor_cache_concurrency)
+{
+    // The processors are concurrently created and the cache still returns a single instance.
+
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<BuiltinTransform> {style: ACEScct_to_ACES2065-1}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<ColorSpaceTransform> {src: ref, dst: cs1}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    constexpr size_t numThreads = 8;
+    std::vector<OCIO::ConstProcessorRcPtr> processors(numThreads);
+
+    std::vector<std::thread> threads;
+    for (size_t idx = 0; idx < numThreads; ++idx)
+    {
+        threads.emplace_back([&config, &processors, idx]()
+        {
+            processors[idx] = config->getProcessor("ref", idx % 2 ? "cs1" : "cs2");
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto & processor : processors)
+    {
+        OCIO_REQUIRE_ASSERT(processor);
+        OCIO_CHECK_EQUAL(processor.get(), config->getProcessor("ref", "cs1").get());
+    }
+
+    OCIO_REQUIRE_EQUAL(config->getNumCacheStatistics(), 1);
+    const OCIO::CacheStatistics stats = config->getCacheStatistics(0);
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 2);
+    OCIO_CHECK_EQUAL(stats.m_numHits + stats.m_numMisses, numThreads + numThreads);
+}
+
+OCIO_ADD_TEST(Config, get_processors)
+{
+    constexpr const char * CONFIG_CUSTOM {
+R"(ocio_profile_version: 2
+
+search_path: ""
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: ref
+
+file_rules:
+  - !<Rule> {name: Default, colorspace: default}
+
+displays:
+  Disp1:
+    - !<View> {name: View1, colorspace: cs1}
+    - !<View> {name: View2, colorspace: cs2}
+
+colorspaces:
+  - !<ColorSpace>
+    name: ref
+
+  - !<ColorSpace>
+    name: cs1
+    from_scene_reference: !<BuiltinTransform> {style: ACEScct_to_ACES2065-1}
+
+  - !<ColorSpace>
+    name: cs2
+    from_scene_reference: !<ExponentTransform> {value: 2.2}
+)"};
+
+    std::istringstream iss;
+    iss.str(CONFIG_CUSTOM);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    std::vector<OCIO::ConstTransformRcPtr> transforms;
+    for (const char * view : { "View1", "View2" })
+    {
+        OCIO::DisplayViewTransformRcPtr dv = OCIO::DisplayViewTransform::Create();
+        dv->setSrc("ref");
+        dv->setDisplay("Disp1");
+        dv->setView(view);
+        transforms.push_back(dv);
+    }
+
+    // An invalid transform returns a null processor.
+    OCIO::ColorSpaceTransformRcPtr cst = OCIO::ColorSpaceTransform::Create();
+    cst->setSrc("ref");
+    cst->setDst("unknown");
+    transforms.push_back(cst);
+
+    // The error of the invalid transform is thrown but the other processors are returned.
+    std::vector<OCIO::ConstProcessorRcPtr> processors(transforms.size());
+    OCIO_CHECK_THROW_WHAT(config->getProcessors(config->getCurrentContext(),
+                                                transforms.data(),
+                                                transforms.size(),
+                                                OCIO::TRANSFORM_DIR_FORWARD,
+                                                OCIO::BIT_DEPTH_UINT8,
+                                                OCIO::BIT_DEPTH_UINT8,
+                                                OCIO::OPTIMIZATION_DEFAULT,
+                                                processors.data()),
+                          OCIO::Exception, "unknown");
+    OCIO_REQUIRE_ASSERT(processors[0]);
+    OCIO_REQUIRE_ASSERT(processors[1]);
+    OCIO_CHECK_ASSERT(!processors[2]);
+
+    // The processors are in the processor cache.
+    OCIO_CHECK_EQUAL(processors[0].get(), config->getProcessor("ref", "Disp1", "View1",
+                                                               OCIO::TRANSFORM_DIR_FORWARD).get());
+    OCIO_CHECK_EQUAL(processors[1].get(), config->getProcessor("ref", "Disp1", "View2",
+                                                               OCIO::TRANSFORM_DIR_FORWARD).get());
+
+    // The CPU processors are in the processor caches.
+    OCIO_REQUIRE_EQUAL(processors[1]->getNumCacheStatistics(), 3);
+    const OCIO::CacheStatistics stats = processors[1]->getCacheStatistics(1);
+    OCIO_CHECK_EQUAL(stats.m_name, std::string("cpu_processor"));
+    OCIO_CHECK_EQUAL(stats.m_numEntries, 1);
+
+    OCIO_CHECK_THROW_WHAT(config->getProcessors(OCIO::ConstContextRcPtr(),
+                                                transforms.data(),
+                                                transforms.size(),
+                                                OCIO::TRANSFORM_DIR_FORWARD,
+                                                processors.data()),
+                          OCIO::Exception, "Context is null");
+
+    // The views of a non-trivial source color space share its conversion ops, and the
+    // processors match the ones built one by one.
+    transforms.clear();
+    for (const char * view : { "View1", "View2" })
+    {
+        OCIO::DisplayViewTransformRcPtr dv = OCIO::DisplayViewTransform::Create();
+        dv->setSrc("cs2");
+        dv->setDisplay("Disp1");
+        dv->setView(view);
+        transforms.push_back(dv);
+    }
+
+    processors.resize(transforms.size());
+    OCIO_CHECK_NO_THROW(config->getProcessors(config->getCurrentContext(),
+                                              transforms.data(),
+                                              transforms.size(),
+                                              OCIO::TRANSFORM_DIR_FORWARD,
+                                              processors.data()));
+
+    OCIO::ConfigRcPtr other = config->createEditableCopy();
+    for (size_t idx = 0; idx < transforms.size(); ++idx)
+    {
+        OCIO_REQUIRE_ASSERT(processors[idx]);
+        OCIO::ConstProcessorRcPtr processor;
+        OCIO_CHECK_NO_THROW(processor = other->getProcessor(transforms[idx]));
+        OCIO_CHECK_EQUAL(std::string(processors[idx]->getCacheID()),
+                         std::string(processor->getCacheID()));
+    }
+}
+
 OCIO_ADD_TEST(Config, context_variables_typical_use_cases)
 {
     // Case 1 - No context variables used in the config.
@@ -8217,3 +8406,246 @@ OCIO_ADD_TEST(Config, get_processor_alias)
                          OCIO::TRANSFORM_TYPE_FIXED_FUNCTION);
     }
 }
+
+OCIO_ADD_TEST(Config, lazy_loading)
+{
+    constexpr char CONFIG[] = { R"(ocio_profile_version: 2
+
+environment:
+  {}
+roles:
+  default: raw
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+looks:
+  - !<Look>
+    name: look
+    process_space: raw
+    transform: !<ExponentTransform> {value: [2.2, 2.2, 2.2, 1]}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+
+  - !<ColorSpace>
+    name: cs1
+    to_scene_reference: !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}
+
+  - !<ColorSpace>
+    name: bad_matrix
+    to_scene_reference: !<MatrixTransform> {matrix: [1, 2]}
+
+  - !<ColorSpace>
+    name: bad_reference
+    from_scene_reference: !<ColorSpaceTransform> {src: raw, dst: unknown}
+)" };
+
+    {
+        // By default, the whole config is loaded at once.
+        std::istringstream is(CONFIG);
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromStream(is),
+                              OCIO::Exception,
+                              "'matrix' values must be 16 numbers. Found '2'.");
+    }
+
+    class Guard
+    {
+    public:
+        Guard()
+        {
+            OCIO::Platform::Setenv(OCIO::OCIO_LAZY_LOADING_ENVVAR, "1");
+        }
+        ~Guard()
+        {
+            OCIO::Platform::Unsetenv(OCIO::OCIO_LAZY_LOADING_ENVVAR);
+        }
+    } guard;
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 4);
+    OCIO_CHECK_EQUAL(config->getNumLooks(), 1);
+
+    // The transforms of the elements are not yet validated.
+    OCIO_CHECK_NO_THROW(config->validate());
+
+    // The transforms are built on first access.
+
+    OCIO::ConstColorSpaceRcPtr cs;
+    OCIO_CHECK_NO_THROW(cs = config->getColorSpace("cs1"));
+    OCIO_REQUIRE_ASSERT(cs);
+    OCIO_REQUIRE_ASSERT(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+    OCIO_CHECK_EQUAL(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE)->getTransformType(),
+                     OCIO::TRANSFORM_TYPE_MATRIX);
+
+    OCIO::ConstLookRcPtr look;
+    OCIO_CHECK_NO_THROW(look = config->getLook("look"));
+    OCIO_REQUIRE_ASSERT(look);
+    OCIO_REQUIRE_ASSERT(look->getTransform());
+    OCIO_CHECK_EQUAL(look->getTransform()->getTransformType(), OCIO::TRANSFORM_TYPE_EXPONENT);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("cs1", "raw"));
+    OCIO_REQUIRE_ASSERT(proc);
+    OCIO_CHECK_EQUAL(proc->createGroupTransform()->getNumTransforms(), 1);
+
+    // Errors are reported when the element is used (and each time it is used).
+
+    OCIO_CHECK_THROW_WHAT(config->getColorSpace("bad_matrix"),
+                          OCIO::Exception,
+                          "'matrix' values must be 16 numbers. Found '2'.");
+    OCIO_CHECK_THROW_WHAT(config->getProcessor("bad_matrix", "raw"),
+                          OCIO::Exception,
+                          "'matrix' values must be 16 numbers. Found '2'.");
+
+    // As the config was already validated, the transforms of an element are validated when
+    // they are built.
+    OCIO_CHECK_THROW_WHAT(config->getColorSpace("bad_reference"),
+                          OCIO::Exception,
+                          "This config references a color space, 'unknown', which is not defined.");
+
+    // A copy needs all the transforms.
+    OCIO_CHECK_THROW(config->createEditableCopy(), OCIO::Exception);
+}
+
+OCIO_ADD_TEST(Config, precompiled_file)
+{
+    constexpr char CONFIG[] = { R"(ocio_profile_version: 2
+
+environment:
+  {}
+search_path: luts
+roles:
+  default: raw
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    aliases: [data]
+    description: |
+      Multi-line
+      description.
+
+  - !<ColorSpace>
+    name: cs1
+    categories: [input]
+    to_scene_reference: !<GroupTransform>
+      children:
+        - !<MatrixTransform> {offset: [0.1, 0.2, 0.3, 0]}
+        - !<ExponentTransform> {value: 2.2, style: mirror}
+)" };
+
+    struct Guard
+    {
+        explicit Guard(const std::string & filename)
+            :   m_filename(filename)
+        {
+        }
+        ~Guard()
+        {
+            std::remove(m_filename.c_str());
+            std::remove((m_filename + "c").c_str());
+        }
+        const std::string m_filename;
+    };
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ocio");
+    Guard guard(filename);
+
+    {
+        std::ofstream ostream(filename.c_str());
+        ostream << CONFIG;
+    }
+
+    OCIO::ConstConfigRcPtr ref;
+    OCIO_CHECK_NO_THROW(ref = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(ref);
+
+    OCIO_CHECK_NO_THROW(OCIO::Config::PrecompileFile(filename.c_str()));
+    OCIO_CHECK_ASSERT(std::ifstream(filename + "c").good());
+
+    // The precompiled config gives the same config.
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(config);
+
+    std::ostringstream refStr, configStr;
+    ref->serialize(refStr);
+    config->serialize(configStr);
+    OCIO_CHECK_EQUAL(refStr.str(), configStr.str());
+    OCIO_CHECK_EQUAL(std::string(ref->getWorkingDir()), config->getWorkingDir());
+    OCIO_CHECK_EQUAL(std::string(config->getCanonicalName("data")), "raw");
+
+    // A corrupted precompiled config is ignored i.e. the config file is parsed instead.
+
+    std::string content;
+    {
+        std::ifstream istream(filename + "c", std::ios_base::in | std::ios_base::binary);
+        content.assign(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream ostream(filename + "c",
+                              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        ostream.write(content.data(), content.size() - 10);
+    }
+
+    {
+        OCIO::LogGuard logGuard;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromFile(filename.c_str()));
+        OCIO_CHECK_NE(logGuard.output().find("Corrupted precompiled config."), std::string::npos);
+    }
+    OCIO_REQUIRE_ASSERT(config);
+    configStr.str("");
+    config->serialize(configStr);
+    OCIO_CHECK_EQUAL(refStr.str(), configStr.str());
+
+    // The precompiled config is ignored when the config file changed, even if the size and the
+    // modification time are the same.
+
+    OCIO_CHECK_NO_THROW(OCIO::Config::PrecompileFile(filename.c_str()));
+    {
+        std::string text = CONFIG;
+        text.replace(text.find("name: cs1"), 9, "name: cs9");
+
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::trunc);
+        ostream << text;
+    }
+
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(config);
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 2);
+    OCIO_CHECK_ASSERT(config->getColorSpace("cs9"));
+    OCIO_CHECK_ASSERT(!config->getColorSpace("cs1"));
+
+    {
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::app);
+        ostream << "\n# A comment.\n";
+    }
+
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(config);
+    OCIO_CHECK_EQUAL(config->getNumColorSpaces(), 2);
+
+    // Only a valid config can be precompiled.
+
+    {
+        std::ofstream ostream(filename.c_str(), std::ios_base::out | std::ios_base::trunc);
+        ostream << CONFIG << "\n  - !<ColorSpace>\n"
+                << "    name: cs2\n"
+                << "    from_scene_reference: !<ColorSpaceTransform> {src: raw, dst: unknown}\n";
+    }
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Config::PrecompileFile(filename.c_str()),
+                          OCIO::Exception,
+                          "This config references a color space, 'unknown', which is not defined.");
+}
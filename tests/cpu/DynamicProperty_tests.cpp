@@ -2,7 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 #include "DynamicProperty.cpp"
 
@@ -422,4 +424,87 @@ OCIO_ADD_TEST(DynamicPropertyImpl, get_as)
     gplog.m_pivot = 0.12;
     asPrimary->setValue(gplog);
     OCIO_CHECK_EQUAL(dpImpl0->getValue(), gplog);
-}
\ No newline at end of file
+}
+OCIO_ADD_TEST(DynamicProperty, concurrent_set_and_apply)
+{
+    // Each apply call uses one consistent set of values even if the dynamic property is changed
+    // by another thread.
+
+    OCIO::GradingPrimaryTransformRcPtr gpt = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LIN);
+    gpt->makeDynamic();
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(gpt));
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = processor->getDefaultCPUProcessor());
+
+    OCIO::DynamicPropertyRcPtr dp;
+    OCIO_CHECK_NO_THROW(dp = cpuProcessor->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY));
+    OCIO::DynamicPropertyGradingPrimaryRcPtr dpPrimary;
+    OCIO_CHECK_NO_THROW(dpPrimary = OCIO::DynamicPropertyValue::AsGradingPrimary(dp));
+    OCIO_REQUIRE_ASSERT(dpPrimary);
+
+    OCIO::GradingPrimary valueA{ OCIO::GRADING_LIN };
+    valueA.m_exposure = OCIO::GradingRGBM(0.1, 0.2, 0.3, 0.5);
+    valueA.m_offset   = OCIO::GradingRGBM(0.01, 0.02, 0.03, 0.0);
+    valueA.m_saturation = 1.2;
+
+    OCIO::GradingPrimary valueB{ OCIO::GRADING_LIN };
+    valueB.m_exposure = OCIO::GradingRGBM(-0.3, -0.2, -0.1, -0.5);
+    valueB.m_contrast = OCIO::GradingRGBM(1.1, 1.0, 0.9, 1.2);
+    valueB.m_saturation = 0.8;
+
+    constexpr long numPixels = 512;
+    std::vector<float> inImg(numPixels * 4);
+    for (long idx = 0; idx < numPixels * 4; ++idx)
+    {
+        inImg[idx] = float(idx % 97) / 96.0f;
+    }
+
+    auto apply = [&cpuProcessor, &inImg]()
+    {
+        std::vector<float> outImg(inImg);
+        OCIO::PackedImageDesc desc(outImg.data(), numPixels, 1, 4);
+        cpuProcessor->apply(desc);
+        return outImg;
+    };
+
+    auto impl = OCIO_DYNAMIC_POINTER_CAST<OCIO::DynamicPropertyGradingPrimaryImpl>(dp);
+    OCIO_REQUIRE_ASSERT(impl);
+    const uint64_t version = impl->getRenderBuffer().getVersion();
+
+    dpPrimary->setValue(valueA);
+    const std::vector<float> refA = apply();
+    dpPrimary->setValue(valueB);
+    const std::vector<float> refB = apply();
+    OCIO_CHECK_ASSERT(refA != refB);
+
+    // Each change publishes new values.
+    OCIO_CHECK_EQUAL(impl->getRenderBuffer().getVersion(), version + 2);
+
+    std::atomic<bool> done{ false };
+    std::thread writer([&dpPrimary, &done, &valueA, &valueB]()
+    {
+        for (unsigned idx = 0; !done; ++idx)
+        {
+            dpPrimary->setValue((idx % 2) ? valueA : valueB);
+            std::this_thread::yield();
+        }
+    });
+
+    unsigned numInconsistent = 0;
+    for (unsigned idx = 0; idx < 200; ++idx)
+    {
+        const std::vector<float> outImg = apply();
+        if (outImg != refA && outImg != refB)
+        {
+            ++numInconsistent;
+        }
+    }
+
+    done = true;
+    writer.join();
+
+    OCIO_CHECK_EQUAL(numInconsistent, 0u);
+}
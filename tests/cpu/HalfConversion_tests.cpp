@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "HalfConversion.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+typedef void (*HalfToFloat)(const half *, float *, size_t);
+typedef void (*FloatToHalf)(const float *, half *, size_t);
+
+void ValidateHalfToFloat(HalfToFloat convert)
+{
+    // All the half values. The size is not a multiple of 4 to also check the remaining values.
+    std::vector<half> in(65536 + 3);
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        in[idx].setBits(static_cast<unsigned short>(idx));
+    }
+
+    std::vector<float> out(in.size());
+    convert(in.data(), out.data(), in.size());
+
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        const float ref = in[idx];
+        if (in[idx].isNan())
+        {
+            OCIO_CHECK_ASSERT(std::isnan(out[idx]));
+        }
+        else
+        {
+            // Also check the signed zeros.
+            OCIO_CHECK_EQUAL(out[idx], ref);
+            OCIO_CHECK_EQUAL(std::signbit(out[idx]), std::signbit(ref));
+        }
+    }
+}
+
+void ValidateFloatToHalf(FloatToHalf convert)
+{
+    std::vector<float> in;
+
+    // All the half values and the values halfway between them (i.e. round to nearest even)
+    // and around.
+    for (unsigned bits = 0; bits < 0x7c00; ++bits)
+    {
+        half h;
+        h.setBits(static_cast<unsigned short>(bits));
+        half next;
+        next.setBits(static_cast<unsigned short>(bits + 1));
+
+        const float value = h;
+        const float middle = (value + float(next)) * 0.5f;
+        for (const float v : { value, middle,
+                               std::nextafter(middle, 0.0f), std::nextafter(middle, 1e9f) })
+        {
+            in.push_back(v);
+            in.push_back(-v);
+        }
+    }
+
+    // Overflows, infinities, NaNs, and float denormalized values.
+    const float inf = std::numeric_limits<float>::infinity();
+    for (const float v : { 65504.0f, 65519.99f, 65520.0f, 65536.0f, 1e10f, inf,
+                           std::numeric_limits<float>::quiet_NaN(),
+                           std::numeric_limits<float>::denorm_min(), 1e-40f, 2.98023224e-08f })
+    {
+        in.push_back(v);
+        in.push_back(-v);
+    }
+
+    // Plenty of other values.
+    for (uint64_t bits = 0; bits < 0x100000000ULL; bits += 65521)
+    {
+        float v;
+        const uint32_t b = static_cast<uint32_t>(bits);
+        memcpy(&v, &b, sizeof(v));
+        in.push_back(v);
+    }
+
+    std::vector<half> out(in.size());
+    convert(in.data(), out.data(), in.size());
+
+    for (size_t idx = 0; idx < in.size(); ++idx)
+    {
+        const half ref = in[idx];
+        if (ref.isNan())
+        {
+            OCIO_CHECK_ASSERT(out[idx].isNan());
+        }
+        else
+        {
+            OCIO_CHECK_EQUAL(out[idx].bits(), ref.bits());
+        }
+    }
+}
+
+} // anon.
+
+OCIO_ADD_TEST(HalfConversion, half_to_float)
+{
+    ValidateHalfToFloat(OCIO::ConvertHalfToFloat);
+
+#ifdef USE_SSE
+    ValidateHalfToFloat(OCIO::HalfToFloatSSE2);
+    if (OCIO::HasF16C())
+    {
+        ValidateHalfToFloat(OCIO::HalfToFloatF16C);
+    }
+#endif
+}
+
+OCIO_ADD_TEST(HalfConversion, float_to_half)
+{
+    ValidateFloatToHalf(OCIO::ConvertFloatToHalf);
+
+#ifdef USE_SSE
+    ValidateFloatToHalf(OCIO::FloatToHalfSSE2);
+    if (OCIO::HasF16C())
+    {
+        ValidateFloatToHalf(OCIO::FloatToHalfF16C);
+    }
+#endif
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "ImageDesc.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(PackedImageDesc, strided_image)
+{
+    // Process in place every other pixel of an image (e.g. a strided NumPy array) where the lines
+    // interleave i.e. the x stride multiplied by the width exceeds the y stride.
+
+    OCIO::ConstConfigRcPtr config = OCIO::Config::CreateRaw();
+
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    constexpr double offset[4] = { 0.1, 0.2, 0.3, 0.4 };
+    matrix->setOffset(offset);
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = config->getProcessor(matrix)->getDefaultCPUProcessor());
+
+    constexpr long width     = 3;
+    constexpr long height    = 2;
+    constexpr long numValues = width * height * 4;
+
+    std::vector<float> values(numValues);
+    for (long idx = 0; idx < numValues; ++idx)
+    {
+        values[idx] = float(idx) / 10.0f;
+    }
+    std::vector<float> processed = values;
+
+    // The pixels of columns 0 and 2.
+    OCIO::PackedImageDesc img(processed.data(), 2, height, 4, OCIO::BIT_DEPTH_F32,
+                              sizeof(float), 2 * 4 * sizeof(float), width * 4 * sizeof(float));
+    OCIO_CHECK_NO_THROW(cpu->apply(img));
+
+    std::vector<float> expected = values;
+    for (long idx = 0; idx < width * height; ++idx)
+    {
+        if (idx % width != 1)
+        {
+            OCIO_CHECK_NO_THROW(cpu->applyRGBA(&expected[idx * 4]));
+        }
+    }
+
+    OCIO_CHECK_ASSERT(processed == expected);
+
+    // The lines must still not overlap.
+    OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(processed.data(), 2, height, 4,
+                                                OCIO::BIT_DEPTH_F32, sizeof(float),
+                                                2 * 4 * sizeof(float), 5 * sizeof(float)),
+                          OCIO::Exception, "The x and y strides are inconsistent");
+}
+
+OCIO_ADD_TEST(PackedImageDesc, line_bytes)
+{
+    // The last pixel of a line ends with its last channel, even when the channels are spaced
+    // (e.g. one of two interleaved images).
+
+    std::vector<float> values(64);
+
+    // The last pixel spans 3 channel strides of 8 bytes plus one channel of 4 bytes.
+    OCIO_CHECK_NO_THROW(OCIO::PackedImageDesc(values.data(), 2, 2, 4, OCIO::BIT_DEPTH_F32,
+                                              8, 32, 32 + 28));
+    OCIO_CHECK_THROW_WHAT(OCIO::PackedImageDesc(values.data(), 2, 2, 4, OCIO::BIT_DEPTH_F32,
+                                                8, 32, 32 + 27),
+                          OCIO::Exception, "The x and y strides are inconsistent");
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "Profiling.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(Profiling, processor_creation)
+{
+    std::vector<OCIO::ProcessorProfile> profiles;
+    OCIO::SetProcessorProfilingFunction([&profiles](const OCIO::ProcessorProfile & profile)
+    {
+        profiles.push_back(profile);
+    });
+    OCIO::ClearAllCaches();
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    // The same file is used twice and the two LUTs are then combined.
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("lut1d_green.ctf");
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(file);
+    group->appendTransform(file);
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(group));
+
+    OCIO_REQUIRE_EQUAL(profiles.size(), 1);
+    OCIO_CHECK_EQUAL(std::string(profiles[0].m_type), "Processor");
+    OCIO_CHECK_EQUAL(profiles[0].m_numFilesLoaded, 1);
+    OCIO_CHECK_EQUAL(profiles[0].m_numFilesCached, 1);
+    OCIO_CHECK_ASSERT(profiles[0].m_buildOpsTime > 0.);
+    OCIO_CHECK_ASSERT(profiles[0].m_fileLoadingTime > 0.);
+    OCIO_CHECK_ASSERT(profiles[0].m_fileLoadingTime <= profiles[0].m_buildOpsTime);
+    OCIO_CHECK_ASSERT(profiles[0].m_totalTime
+                        >= profiles[0].m_buildOpsTime + profiles[0].m_finalizeTime);
+    OCIO_CHECK_EQUAL(profiles[0].m_numOptimizationPasses, 0);
+
+    OCIO::ConstCPUProcessorRcPtr cpu;
+    OCIO_CHECK_NO_THROW(cpu = proc->getDefaultCPUProcessor());
+
+    OCIO_REQUIRE_EQUAL(profiles.size(), 2);
+    OCIO_CHECK_EQUAL(std::string(profiles[1].m_type), "CPUProcessor");
+    OCIO_CHECK_EQUAL(profiles[1].m_numFilesLoaded, 0);
+    OCIO_CHECK_ASSERT(profiles[1].m_numOptimizationPasses >= 1);
+    OCIO_CHECK_EQUAL(profiles[1].m_numOpsCombined, 1);
+    OCIO_CHECK_ASSERT(profiles[1].m_lutCompositionTime > 0.);
+    OCIO_CHECK_ASSERT(profiles[1].m_lutCompositionTime <= profiles[1].m_optimizeTime);
+    OCIO_CHECK_ASSERT(profiles[1].m_rendererTime > 0.);
+
+    // The processors found in the caches are not reported.
+    OCIO_CHECK_NO_THROW(config->getProcessor(group));
+    OCIO_CHECK_NO_THROW(proc->getDefaultCPUProcessor());
+    OCIO_CHECK_EQUAL(profiles.size(), 2);
+
+    // The profiling is disabled.
+    OCIO::SetProcessorProfilingFunction(nullptr);
+    OCIO_CHECK_NO_THROW(proc->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_NONE));
+    OCIO_CHECK_EQUAL(profiles.size(), 2);
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include "ScratchArena.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Run the test in a new thread i.e. starting with an empty arena.
+void RunInNewThread(const std::function<void()> & test)
+{
+    std::thread thread(test);
+    thread.join();
+}
+
+} // anon.
+
+OCIO_ADD_TEST(ScratchArena, reserve)
+{
+    RunInNewThread([]()
+    {
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 0u);
+
+        {
+            OCIO::ScratchBuffer buffer;
+            OCIO_CHECK_ASSERT(buffer.data() == nullptr);
+            OCIO_CHECK_EQUAL(buffer.capacity(), 0u);
+
+            float * values = nullptr;
+            OCIO_CHECK_NO_THROW(values = buffer.reserve<float>(100));
+            OCIO_REQUIRE_ASSERT(values);
+            OCIO_CHECK_EQUAL(reinterpret_cast<uintptr_t>(values) % OCIO::SCRATCH_ALIGNMENT, 0u);
+            OCIO_CHECK_GE(buffer.capacity(), 100 * sizeof(float));
+
+            // The whole block is usable.
+            std::fill_n(static_cast<char *>(buffer.data()), buffer.capacity(), 0x5A);
+
+            // A smaller (or equal) size keeps the block.
+            OCIO_CHECK_EQUAL(buffer.reserve<float>(10), values);
+            OCIO_CHECK_EQUAL(buffer.reserve(buffer.capacity()), buffer.data());
+
+            // A larger size replaces the block, which goes back to the arena.
+            const size_t capacity = buffer.capacity();
+            char * bytes = nullptr;
+            OCIO_CHECK_NO_THROW(bytes = buffer.reserve<char>(capacity + 1));
+            OCIO_CHECK_EQUAL(reinterpret_cast<uintptr_t>(bytes) % OCIO::SCRATCH_ALIGNMENT, 0u);
+            OCIO_CHECK_GE(buffer.capacity(), capacity + 1);
+            std::fill_n(bytes, buffer.capacity(), 0x5A);
+
+            OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 1u);
+        }
+
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 2u);
+    });
+}
+
+OCIO_ADD_TEST(ScratchArena, recycle)
+{
+    RunInNewThread([]()
+    {
+        void * data1 = nullptr;
+        void * data2 = nullptr;
+        {
+            OCIO::ScratchBuffer buffer1, buffer2;
+            data1 = buffer1.reserve(1000);
+            data2 = buffer2.reserve(20000);
+
+            OCIO_CHECK_NE(data1, data2);
+        }
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 2u);
+
+        // The same blocks are used again (i.e. no allocation), the smallest fitting block first.
+        {
+            OCIO::ScratchBuffer buffer1, buffer2;
+            OCIO_CHECK_EQUAL(buffer2.reserve(20000), data2);
+            OCIO_CHECK_EQUAL(buffer1.reserve(1000), data1);
+            OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 0u);
+
+            buffer1.release();
+            OCIO_CHECK_ASSERT(buffer1.data() == nullptr);
+            OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 1u);
+        }
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 2u);
+
+        // The large blocks are not kept.
+        {
+            OCIO::ScratchBuffer buffer;
+            buffer.reserve(OCIO::MAX_KEPT_BLOCK_SIZE + 1);
+        }
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), 2u);
+
+        // Nor too many blocks.
+        {
+            OCIO::ScratchBuffer buffers[OCIO::MAX_KEPT_BLOCKS + 3];
+            for (auto & buffer : buffers)
+            {
+                buffer.reserve(100);
+            }
+        }
+        OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), OCIO::MAX_KEPT_BLOCKS);
+    });
+}
+
+OCIO_ADD_TEST(ScratchArena, threads)
+{
+    // Each thread has its own arena.
+    const size_t numBlocks = OCIO::GetNumScratchBlocks();
+
+    RunInNewThread([]()
+    {
+        OCIO::ScratchBuffer buffer;
+        buffer.reserve(1000);
+    });
+
+    OCIO_CHECK_EQUAL(OCIO::GetNumScratchBlocks(), numBlocks);
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <future>
+#include <thread>
+
+#include "TaskScheduler.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(TaskScheduler, parallel_for)
+{
+    OCIO_CHECK_GE(OCIO::GetNumThreads(), 1u);
+
+    std::vector<int> values(10007, 0);
+
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(values.size(), 16, [&values](size_t begin, size_t end)
+    {
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            values[idx] += int(idx);
+        }
+    }));
+
+    // Each item is processed once.
+    for (size_t idx = 0; idx < values.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(values[idx], int(idx));
+    }
+
+    // Nothing to process.
+    bool called = false;
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(0, 16, [&called](size_t, size_t) { called = true; }));
+    OCIO_CHECK_ASSERT(!called);
+}
+
+OCIO_ADD_TEST(TaskScheduler, parallel_for_nested)
+{
+    std::atomic<size_t> count{ 0 };
+
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(64, 1, [&count](size_t begin, size_t end)
+    {
+        for (size_t idx = begin; idx < end; ++idx)
+        {
+            OCIO::ParallelFor(100, 1, [&count](size_t b, size_t e) { count += (e - b); });
+        }
+    }));
+
+    OCIO_CHECK_EQUAL(count.load(), size_t(6400));
+}
+
+OCIO_ADD_TEST(TaskScheduler, parallel_for_exception)
+{
+    OCIO_CHECK_THROW_WHAT(OCIO::ParallelFor(1000, 1, [](size_t begin, size_t)
+                          {
+                              if (begin == 0)
+                              {
+                                  throw OCIO::Exception("Chunk failure.");
+                              }
+                          }),
+                          OCIO::Exception,
+                          "Chunk failure.");
+}
+
+OCIO_ADD_TEST(TaskScheduler, set_num_threads)
+{
+    const unsigned defaultNumThreads = OCIO::GetNumThreads();
+
+    // A single thread processes everything on the calling thread.
+    OCIO::SetNumThreads(1);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(), 1u);
+
+    const std::thread::id callerId = std::this_thread::get_id();
+    bool sameThread = true;
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(1000, 1, [&](size_t, size_t)
+    {
+        sameThread = sameThread && std::this_thread::get_id() == callerId;
+    }));
+    OCIO_CHECK_ASSERT(sameThread);
+
+    // The asynchronous tasks still run on a worker thread.
+    std::promise<std::thread::id> taskId;
+    OCIO::RunAsync([&taskId]() { taskId.set_value(std::this_thread::get_id()); });
+    OCIO_CHECK_NE(taskId.get_future().get(), callerId);
+
+    // More threads than the hardware ones is allowed.
+    OCIO::SetNumThreads(4);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(), 4u);
+
+    std::atomic<size_t> count{ 0 };
+    OCIO_CHECK_NO_THROW(OCIO::ParallelFor(1000, 1, [&count](size_t b, size_t e)
+    {
+        count += (e - b);
+    }));
+    OCIO_CHECK_EQUAL(count.load(), size_t(1000));
+
+    // Restore the default.
+    OCIO::SetNumThreads(0);
+    OCIO_CHECK_EQUAL(OCIO::GetNumThreads(), defaultNumThreads);
+}
@@ -760,3 +760,56 @@ OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_rev)
     ApplyGamma(ops[0], input_32f, expected_32f, numPixels, __LINE__, errorThreshold);
 }
 
+
+OCIO_ADD_TEST(GammaOpCPU, apply_moncurve_mirror_style_channel_signs)
+{
+    // Each channel is mirrored using its own sign i.e. a negative blue value with a positive
+    // red value (and the opposite) must give the mirrored results of the positive values.
+
+    const long numPixels = 2;
+
+    const float input_32f[numPixels * 4] = {
+         0.25f,  0.5f, -0.75f,  1.5f,
+        -0.25f, -0.5f,  0.75f, -1.5f };
+
+    const OCIO::GammaOpData::Params redParams = { 2.4, 0.1 };
+    const OCIO::GammaOpData::Params greenParams = { 2.2, 0.2 };
+    const OCIO::GammaOpData::Params blueParams = { 2.0, 0.4 };
+    const OCIO::GammaOpData::Params alphaParams = { 1.8, 0.6 };
+
+    for (const auto style : { OCIO::GammaOpData::MONCURVE_MIRROR_FWD,
+                              OCIO::GammaOpData::MONCURVE_MIRROR_REV })
+    {
+        auto gammaData = std::make_shared<OCIO::GammaOpData>(style,
+                                                             redParams,
+                                                             greenParams,
+                                                             blueParams,
+                                                             alphaParams);
+        OCIO::OpRcPtrVec ops;
+        OCIO_CHECK_NO_THROW(OCIO::CreateGammaOp(ops, gammaData, OCIO::TRANSFORM_DIR_FORWARD));
+        OCIO_CHECK_NO_THROW(ops.finalize());
+        OCIO_REQUIRE_EQUAL(ops.size(), 1);
+
+        // Both the scalar and the SSE renderers.
+        for (const bool fastPower : { false, true })
+        {
+            const auto cpu = ops[0]->getCPUOp(fastPower);
+
+            float positive_32f[numPixels * 4];
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                positive_32f[idx] = std::fabs(input_32f[idx]);
+            }
+            OCIO_CHECK_NO_THROW(cpu->apply(positive_32f, positive_32f, numPixels));
+
+            float image_32f[numPixels * 4];
+            OCIO_CHECK_NO_THROW(cpu->apply(input_32f, image_32f, numPixels));
+
+            for (long idx = 0; idx < numPixels * 4; ++idx)
+            {
+                OCIO_CHECK_EQUAL(image_32f[idx],
+                                 std::copysign(positive_32f[idx], input_32f[idx]));
+            }
+        }
+    }
+}
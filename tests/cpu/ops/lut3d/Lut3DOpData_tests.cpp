@@ -290,6 +290,52 @@ OCIO_ADD_TEST(Lut3DOpData, compose_2)
     OCIO_CHECK_CLOSE(a[14738], 4088.30493164f / 4095.0f, 1e-6f);
 }
 
+OCIO_ADD_TEST(Lut3DOpData, compose_cache)
+{
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(BuildOpsTest(ops, "clf/lut3d_bizarre.clf", context,
+                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(2, ops.size());
+
+    OCIO::OpRcPtrVec ops1;
+    OCIO_CHECK_NO_THROW(BuildOpsTest(ops1, "clf/lut3d_17x17x17_10i_12i.clf", context,
+                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(2, ops1.size());
+
+    OCIO::ConstOpRcPtr op0 = ops[1];
+    OCIO::ConstOpRcPtr op1 = ops1[1];
+    OCIO::ConstLut3DOpDataRcPtr lutData0 =
+        OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op0->data());
+    OCIO::ConstLut3DOpDataRcPtr lutData1 =
+        OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op1->data());
+    OCIO_REQUIRE_ASSERT(lutData0);
+    OCIO_REQUIRE_ASSERT(lutData1);
+
+    OCIO::ClearAllCaches();
+
+    // The first composition computes the LUT, the second one reuses the memoized result.
+    OCIO::Lut3DOpDataRcPtr composed1;
+    OCIO_CHECK_NO_THROW(composed1 = OCIO::Lut3DOpData::Compose(lutData0, lutData1));
+    OCIO::Lut3DOpDataRcPtr composed2;
+    OCIO_CHECK_NO_THROW(composed2 = OCIO::Lut3DOpData::Compose(lutData0, lutData1));
+
+    OCIO_REQUIRE_ASSERT(composed1 && composed2);
+    OCIO_CHECK_ASSERT(composed1 != composed2);
+    OCIO_CHECK_ASSERT(composed1->getArray() == composed2->getArray());
+    OCIO_CHECK_EQUAL(composed1->getCacheID(), composed2->getCacheID());
+
+    // Composing the inverse must not reuse the forward result.
+    OCIO::ConstLut3DOpDataRcPtr invLutData1 = lutData1->inverse();
+    OCIO::Lut3DOpDataRcPtr composed3;
+    OCIO_CHECK_NO_THROW(composed3 = OCIO::Lut3DOpData::Compose(lutData0, invLutData1));
+    OCIO_REQUIRE_ASSERT(composed3);
+    OCIO_CHECK_ASSERT(!(composed1->getArray() == composed3->getArray()));
+
+    OCIO::ClearAllCaches();
+}
+
 OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
 {
     const std::string fileName("clf/lut3d_17x17x17_10i_12i.clf");
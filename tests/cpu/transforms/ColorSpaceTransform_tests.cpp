@@ -836,5 +836,64 @@ OCIO_ADD_TEST(ColorSpaceTransform, context_variables)
                      usedContextVars->getStringVarByIndex(0));
 }
 
+OCIO_ADD_TEST(ColorSpaceTransform, shared_colorspace_ops)
+{
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    auto cs = OCIO::ColorSpace::Create(OCIO::REFERENCE_SPACE_SCENE);
+    cs->setName("cs");
+    auto ff = OCIO::FixedFunctionTransform::Create(OCIO::FIXED_FUNCTION_ACES_GLOW_03);
+    cs->setTransform(ff, OCIO::COLORSPACE_DIR_FROM_REFERENCE);
+    config->addColorSpace(cs);
+
+    OCIO::ConstColorSpaceRcPtr colorSpace = config->getColorSpace("cs");
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    OCIO::SharedColorSpaceOps sharedOps;
+
+    // Each conversion is only built once.
+    int numBuilds = 0;
+    auto build = [&numBuilds](OCIO::OpRcPtrVec &) { ++numBuilds; };
+    OCIO::OpRcPtrVec ops;
+    sharedOps.append(ops, context, colorSpace, true, build);
+    sharedOps.append(ops, context, colorSpace, true, build);
+    OCIO_CHECK_EQUAL(numBuilds, 1);
+    sharedOps.append(ops, context, colorSpace, false, build);
+    OCIO_CHECK_EQUAL(numBuilds, 2);
+
+    // A failed build is retried.
+    OCIO::ConstColorSpaceRcPtr other = config->getColorSpace("raw");
+    OCIO_CHECK_THROW_WHAT(sharedOps.append(ops, context, other, true,
+                                           [](OCIO::OpRcPtrVec &)
+                                           {
+                                               throw OCIO::Exception("Build failed.");
+                                           }),
+                          OCIO::Exception, "Build failed.");
+    sharedOps.append(ops, context, other, true, build);
+    OCIO_CHECK_EQUAL(numBuilds, 3);
+
+    // The op builders use the shared ops of the scope, and each caller gets its own ops.
+    OCIO::OpRcPtrVec ops1, ops2, ops3;
+    {
+        OCIO::SharedColorSpaceOps scopeOps;
+        OCIO::SharedColorSpaceOpsScope scope(scopeOps);
+        OCIO_CHECK_NO_THROW(OCIO::BuildColorSpaceToReferenceOps(ops1, *config, context,
+                                                                colorSpace, true));
+        OCIO_CHECK_NO_THROW(OCIO::BuildColorSpaceToReferenceOps(ops2, *config, context,
+                                                                colorSpace, true));
+    }
+    OCIO_CHECK_NO_THROW(OCIO::BuildColorSpaceToReferenceOps(ops3, *config, context,
+                                                            colorSpace, true));
+
+    OCIO_REQUIRE_EQUAL(ops1.size(), 2);
+    OCIO_REQUIRE_EQUAL(ops2.size(), 2);
+    OCIO_REQUIRE_EQUAL(ops3.size(), 2);
+    OCIO_CHECK_NE(ops1[1].get(), ops2[1].get());
+    OCIO::ConstOpRcPtr op1 = ops1[1];
+    OCIO::ConstOpRcPtr op2 = ops2[1];
+    OCIO::ConstOpRcPtr op3 = ops3[1];
+    OCIO_CHECK_ASSERT(*op1->data() == *op2->data());
+    OCIO_CHECK_ASSERT(*op1->data() == *op3->data());
+}
+
 // Please see (Config, named_transform_processor) in NamedTransform_tests.cpp for coverage of
 // ColorSpaceTransform where the arguments are NamedTransforms.
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <fstream>
+
+#include "transforms/PersistentFileCache.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+struct CacheDirGuard
+{
+    CacheDirGuard()
+    {
+        const std::string tmpFilename = OCIO::Platform::CreateTempFilename("");
+        m_cacheDir = pystring::os::path::dirname(tmpFilename);
+        OCIO::Platform::Setenv(OCIO::OCIO_FILE_CACHE_DIR, m_cacheDir);
+        OCIO::ClearAllCaches();
+    }
+
+    ~CacheDirGuard()
+    {
+        for (const auto & entry : m_entries)
+        {
+            std::remove(entry.c_str());
+        }
+        OCIO::Platform::Unsetenv(OCIO::OCIO_FILE_CACHE_DIR);
+        OCIO::ClearAllCaches();
+    }
+
+    std::string getEntry(const std::string & fileName)
+    {
+        const std::string filePath(OCIO::GetTestFilesDir() + "/" + fileName);
+        const std::string entry = OCIO::GetCacheEntryFilename(filePath, OCIO::INTERP_DEFAULT);
+        m_entries.push_back(entry);
+        return entry;
+    }
+
+    std::string m_cacheDir;
+    std::vector<std::string> m_entries;
+};
+
+std::vector<float> ApplyProcessor(const std::string & fileName)
+{
+    std::vector<float> pixels{ 0.0f,  0.0f,  0.0f,
+                               0.1f,  0.5f,  0.9f,
+                               0.25f, 0.75f, 0.33f,
+                               1.0f,  1.0f,  1.0f };
+
+    OCIO::ConstProcessorRcPtr proc = OCIO::GetFileTransformProcessor(fileName);
+    OCIO::ConstCPUProcessorRcPtr cpu = proc->getDefaultCPUProcessor();
+
+    OCIO::PackedImageDesc desc(pixels.data(), 4, 1, 3);
+    cpu->apply(desc);
+
+    return pixels;
+}
+
+bool EntryExists(const std::string & entry)
+{
+    std::ifstream istream(entry.c_str(), std::ios_base::in | std::ios_base::binary);
+    return istream.good();
+}
+
+} // anon.
+
+
+OCIO_ADD_TEST(PersistentFileCache, lut_files)
+{
+    const std::vector<std::string> fileNames{
+        "iridas_1d.cube", "iridas_3d.cube", "lut1d_1.spi1d", "lut3d_1.spi3d", "discreet-3d-lut.3dl"
+    };
+
+    // Reference results without the persistent file cache.
+    std::vector<std::vector<float>> refPixels;
+    for (const auto & fileName : fileNames)
+    {
+        OCIO::ClearAllCaches();
+        refPixels.push_back(ApplyProcessor(fileName));
+    }
+
+    CacheDirGuard guard;
+
+    for (size_t idx = 0; idx < fileNames.size(); ++idx)
+    {
+        const std::string & fileName = fileNames[idx];
+        const std::string filePath(OCIO::GetTestFilesDir() + "/" + fileName);
+        const std::string entry = guard.getEntry(fileName);
+        OCIO_REQUIRE_ASSERT(!entry.empty());
+        std::remove(entry.c_str());
+
+        // The first load parses the file and saves the cache entry.
+        OCIO::ClearAllCaches();
+        OCIO_CHECK_ASSERT(refPixels[idx] == ApplyProcessor(fileName));
+        OCIO_CHECK_ASSERT(EntryExists(entry));
+
+        OCIO::FileFormat * format = nullptr;
+        OCIO::CachedFileRcPtr cachedFile;
+        OCIO_CHECK_ASSERT(OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                         OCIO::INTERP_DEFAULT));
+        OCIO_CHECK_ASSERT(format);
+        OCIO_CHECK_ASSERT(cachedFile);
+
+        // The next loads (i.e. mimic another process) only read the cache entry.
+        OCIO::ClearAllCaches();
+        OCIO_CHECK_ASSERT(refPixels[idx] == ApplyProcessor(fileName));
+    }
+}
+
+OCIO_ADD_TEST(PersistentFileCache, invalid_entries)
+{
+    CacheDirGuard guard;
+
+    const std::string fileName("lut1d_1.spi1d");
+    const std::string filePath(OCIO::GetTestFilesDir() + "/" + fileName);
+    const std::string entry = guard.getEntry(fileName);
+    OCIO_REQUIRE_ASSERT(!entry.empty());
+
+    const std::vector<float> refPixels = ApplyProcessor(fileName);
+    OCIO_REQUIRE_ASSERT(EntryExists(entry));
+
+    // A truncated entry is ignored.
+    {
+        std::ifstream istream(entry.c_str(), std::ios_base::in | std::ios_base::binary);
+        const std::string content((std::istreambuf_iterator<char>(istream)),
+                                  std::istreambuf_iterator<char>());
+        istream.close();
+
+        std::ofstream ostream(entry.c_str(),
+                              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        ostream.write(content.data(), content.size() / 2);
+    }
+
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr cachedFile;
+    OCIO_CHECK_ASSERT(!OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                      OCIO::INTERP_DEFAULT));
+
+    // The file is parsed again and the entry replaced.
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_ASSERT(refPixels == ApplyProcessor(fileName));
+    OCIO_CHECK_ASSERT(OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                     OCIO::INTERP_DEFAULT));
+
+    // File formats not supporting the persistent file cache do not have entries.
+    const std::string ctfName("lut1d_green.ctf");
+    const std::string ctfEntry = guard.getEntry(ctfName);
+    OCIO_CHECK_NO_THROW(ApplyProcessor(ctfName));
+    OCIO_CHECK_ASSERT(!EntryExists(ctfEntry));
+
+    // The persistent file cache is disabled.
+    OCIO::Platform::Unsetenv(OCIO::OCIO_FILE_CACHE_DIR);
+    OCIO_CHECK_ASSERT(!OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                      OCIO::INTERP_DEFAULT));
+}
+
+OCIO_ADD_TEST(PersistentFileCache, forged_entries)
+{
+    CacheDirGuard guard;
+
+    const std::string fileName("lut1d_1.spi1d");
+    const std::string filePath(OCIO::GetTestFilesDir() + "/" + fileName);
+    const std::string entry = guard.getEntry(fileName);
+    OCIO_REQUIRE_ASSERT(!entry.empty());
+
+    OCIO::ClearAllCaches();
+    const std::vector<float> refPixels = ApplyProcessor(fileName);
+
+    // Write a spi1d entry with a valid header but possibly forged LUT fields.
+    auto writeEntry = [&entry](uint32_t length, uint32_t numComponents, int32_t interp)
+    {
+        std::ofstream ostream(entry.c_str(),
+                              std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        OCIO::PersistentCacheWriter writer(ostream);
+        writer.write(OCIO::CacheMagic, sizeof(OCIO::CacheMagic));
+        writer.write(OCIO::CacheFormatVersion);
+        writer.write(static_cast<uint32_t>(OCIO::GetVersionHex()));
+        writer.write(OCIO::CacheByteOrderMark);
+        writer.writeString("spi1d");
+
+        writer.write(static_cast<uint8_t>(1));
+        writer.write(static_cast<int32_t>(OCIO::Lut1DOpData::LUT_STANDARD));
+        writer.write(static_cast<int32_t>(OCIO::HUE_NONE));
+        writer.write(interp);
+        writer.write(static_cast<int32_t>(OCIO::TRANSFORM_DIR_FORWARD));
+        writer.write(static_cast<int32_t>(OCIO::BIT_DEPTH_F32));
+        writer.write(length);
+        writer.write(numComponents);
+        const float values[6] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+        writer.write(values, 6);
+        writer.write(0.0f);
+        writer.write(1.0f);
+    };
+
+    OCIO::FileFormat * format = nullptr;
+    OCIO::CachedFileRcPtr cachedFile;
+
+    // The well-formed entry is used.
+    writeEntry(2, 3, OCIO::INTERP_LINEAR);
+    OCIO_CHECK_ASSERT(OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                     OCIO::INTERP_DEFAULT));
+
+    // The sizes are checked against the entry size before allocating the LUT.
+    writeEntry(0x40000000, 3, OCIO::INTERP_LINEAR);
+    OCIO_CHECK_ASSERT(!OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                      OCIO::INTERP_DEFAULT));
+
+    writeEntry(2, 0xFFFFFFFF, OCIO::INTERP_LINEAR);
+    OCIO_CHECK_ASSERT(!OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                      OCIO::INTERP_DEFAULT));
+
+    // The enumeration values are checked.
+    writeEntry(2, 3, 99);
+    OCIO_CHECK_ASSERT(!OCIO::LoadPersistentCachedFile(format, cachedFile, filePath,
+                                                      OCIO::INTERP_DEFAULT));
+
+    // The file is parsed again.
+    OCIO::ClearAllCaches();
+    OCIO_CHECK_ASSERT(refPixels == ApplyProcessor(fileName));
+
+    // The 3D LUT grid size cannot overflow the size check.
+    for (const uint32_t gridSize : { 0xFFFFFFFFu, 2000u, 1u })
+    {
+        std::ostringstream ostream;
+        OCIO::PersistentCacheWriter writer(ostream);
+        writer.write(static_cast<uint8_t>(1));
+        writer.write(static_cast<int32_t>(OCIO::INTERP_TETRAHEDRAL));
+        writer.write(static_cast<int32_t>(OCIO::TRANSFORM_DIR_FORWARD));
+        writer.write(static_cast<int32_t>(OCIO::BIT_DEPTH_F32));
+        writer.write(gridSize);
+        const std::vector<float> values(2 * 2 * 2 * 3, 0.5f);
+        writer.write(values.data(), values.size());
+
+        const std::string buffer = ostream.str();
+        OCIO::PersistentCacheReader reader(buffer.data(), buffer.size());
+        OCIO::Lut3DOpDataRcPtr lut;
+        OCIO_CHECK_THROW_WHAT(reader.readLut3D(lut),
+                              OCIO::Exception,
+                              "Corrupted persistent file cache entry.");
+        OCIO_CHECK_ASSERT(!lut);
+    }
+}
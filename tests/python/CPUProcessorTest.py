@@ -361,6 +361,40 @@ class CPUProcessorTest(unittest.TestCase):
                 delta=self.FLOAT_DELTA
             )
 
+    def test_apply_images(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # Wrap buffers in ImageDesc
+        arrs = [self.float_rgb_3d.copy() for i in range(5)]
+        images = [OCIO.PackedImageDesc(arr, 7, 3, 3) for arr in arrs]
+        dst_arrs = [np.zeros_like(self.float_rgb_3d) for i in range(5)]
+        dst_images = [OCIO.PackedImageDesc(arr, 7, 3, 3) for arr in dst_arrs]
+
+        # Forward transform modifies values in place
+        self.default_cpu_proc_fwd.apply(images)
+
+        # Inverse transform roundtrips values in the dst images (src are unchanged)
+        self.default_cpu_proc_inv.apply(images, dst_images)
+
+        for arr, dst_arr in zip(arrs, dst_arrs):
+            for i in range(arr.size):
+                self.assertAlmostEqual(
+                    arr.flat[i],
+                    self.float_rgb_3d.flat[i] * 0.5,
+                    delta=self.FLOAT_DELTA
+                )
+                self.assertAlmostEqual(
+                    dst_arr.flat[i],
+                    self.float_rgb_3d.flat[i],
+                    delta=self.FLOAT_DELTA
+                )
+
+        # The image lists must match
+        with self.assertRaises(OCIO.Exception):
+            self.default_cpu_proc_inv.apply(images, dst_images[1:])
+
     def test_apply_rgb_list(self):
         # Forward transform returns modified values
         fwd_result = self.default_cpu_proc_fwd.applyRGB(self.float_rgb_list)
@@ -624,3 +658,79 @@ class CPUProcessorTest(unittest.TestCase):
                         arr.flat[i],
                         delta=self.UINT_DELTA
                     )
+
+    def test_apply_buffer_strided(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        for arr, cpu_proc_fwd in [
+            (self.float_rgba_3d, self.default_cpu_proc_fwd),
+            (self.half_rgba_3d, self.half_cpu_proc_fwd),
+            (self.uint16_rgba_3d, self.uint16_cpu_proc_fwd),
+            (self.uint8_rgba_3d, self.uint8_cpu_proc_fwd),
+        ]:
+            # Strided views are processed in place, leaving the other 
+            # values unchanged, with the results of contiguous arrays
+            for view_func, apply_name in [
+                (lambda a: a[..., :3], 'applyRGB'),
+                (lambda a: a[:, ::2, :], 'applyRGBA'),
+                (lambda a: a[::-1, :, :], 'applyRGBA'),
+                (lambda a: a[:, 1], 'applyRGBA'),
+                (lambda a: a.reshape([21, 4])[::3, :3], 'applyRGB'),
+            ]:
+                arr_copy = arr.copy()
+                view = view_func(arr_copy)
+                self.assertFalse(view.flags.c_contiguous)
+
+                expected = np.ascontiguousarray(view)
+                getattr(cpu_proc_fwd, apply_name)(expected)
+
+                getattr(cpu_proc_fwd, apply_name)(view)
+                self.assertTrue(np.array_equal(view, expected))
+
+                # Values outside of the view are unchanged
+                untouched = np.ones(arr.shape, dtype=bool)
+                view_func(untouched)[...] = False
+                self.assertTrue(
+                    np.array_equal(arr_copy[untouched], arr[untouched])
+                )
+
+        # Strided arrays need the channels in the last dimension
+        arr_copy = self.float_rgb_1d.copy()
+        with self.assertRaises(RuntimeError):
+            self.default_cpu_proc_fwd.applyRGB(arr_copy[::3])
+
+    def test_apply_buffer_threads(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # Large enough images to be split in bands processed in parallel
+        for arr, cpu_proc_fwd in [
+            (
+                np.linspace(-1.0, 1.0, 512*300*4).astype(np.float32), 
+                self.default_cpu_proc_fwd
+            ),
+            (
+                (np.arange(512*300*4) % 251).astype(np.uint8), 
+                self.uint8_cpu_proc_fwd
+            ),
+        ]:
+            results = []
+            for shape in [(512*300*4,), (300, 512, 4)]:
+                for num_threads in [0, 1, 3, 64]:
+                    arr_copy = arr.reshape(shape).copy()
+                    cpu_proc_fwd.applyRGBA(arr_copy, numThreads=num_threads)
+                    results.append(arr_copy.reshape(arr.shape))
+
+            for result in results[1:]:
+                self.assertTrue(np.array_equal(result, results[0]))
+
+            # The RGB values of a strided image too (alpha is unchanged by
+            # the transform)
+            arr_copy = arr.reshape([300, 512, 4]).copy()
+            cpu_proc_fwd.applyRGB(arr_copy[..., :3], numThreads=4)
+            self.assertTrue(
+                np.array_equal(arr_copy.reshape(arr.shape), results[0])
+            )
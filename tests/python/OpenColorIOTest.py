@@ -26,3 +26,17 @@ class OpenColorIOTest(unittest.TestCase):
         OCIO.SetEnvVariable(value='TOTO', name='MY_ENVAR')
         self.assertTrue(OCIO.IsEnvVariablePresent(name='MY_ENVAR'))
         self.assertEqual(OCIO.GetEnvVariable(name='MY_ENVAR'), 'TOTO')
+
+    def test_num_threads(self):
+        """
+        Test Get/SetNumThreads().
+        """
+        defaultNumThreads = OCIO.GetNumThreads()
+        self.assertGreaterEqual(defaultNumThreads, 1)
+
+        OCIO.SetNumThreads(1)
+        self.assertEqual(OCIO.GetNumThreads(), 1)
+
+        # Restore the default.
+        OCIO.SetNumThreads(numThreads=0)
+        self.assertEqual(OCIO.GetNumThreads(), defaultNumThreads)